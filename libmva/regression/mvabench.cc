@@ -0,0 +1,139 @@
+/*  -*- c++ -*-
+ * Microbenchmark for the approximate MVA solvers.
+ *
+ * Solves a closed model of FCFS stations and one delay station
+ * repeatedly with Bard-Schweitzer and Linearizer and reports the time
+ * per solution and per call to Server::wait().  The model only uses
+ * the public solver interface so the same source can be built against
+ * older versions of the library for comparison.
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <getopt.h>
+#include <map>
+#include <string>
+#include "mva.h"
+#include "server.h"
+#include "pop.h"
+#include "vector.h"
+
+struct option longopts[] = {
+    { "classes",	required_argument, nullptr, 'k' },
+    { "customers",	required_argument, nullptr, 'n' },
+    { "entries",	required_argument, nullptr, 'e' },
+    { "help",		no_argument,	   nullptr, 'h' },
+    { "linearizer",	no_argument,	   nullptr, 'l' },
+    { "repeat",		required_argument, nullptr, 'r' },
+    { "schweitzer",	no_argument,	   nullptr, 's' },
+    { "stations",	required_argument, nullptr, 'm' },
+    { nullptr,		0,		   nullptr, '\0' }
+};
+
+static const std::map<const std::string, MVA::new_solver> solvers = {
+    { "Bard-Schweitzer", Schweitzer::create },
+    { "Linearizer",	 Linearizer::create }
+};
+
+static unsigned
+number( const char * arg )
+{
+    char * endptr = nullptr;
+    const unsigned long value = strtoul( arg, &endptr, 10 );
+    if ( *endptr != '\0' || value == 0 ) {
+	std::cerr << "mvabench: invalid argument -- " << arg << std::endl;
+	exit( 1 );
+    }
+    return value;
+}
+
+
+int main ( int argc, char * argv[] )
+{
+    unsigned n_stations = 16;
+    unsigned n_chains = 4;
+    unsigned n_entries = 2;
+    unsigned n_customers = 8;
+    unsigned n_repeat = 200;
+    bool schweitzer = false;
+    bool linearizer = false;
+
+    for ( ;; ) {
+	const int c = getopt_long( argc, argv, "e:hk:lm:n:r:s", longopts, nullptr );
+	if ( c == EOF ) break;
+
+	switch ( c ) {
+	case 'e':	n_entries = number( optarg ); break;
+	case 'k':	n_chains = number( optarg ); break;
+	case 'l':	linearizer = true; break;
+	case 'm':	n_stations = number( optarg ); break;
+	case 'n':	n_customers = number( optarg ); break;
+	case 'r':	n_repeat = number( optarg ); break;
+	case 's':	schweitzer = true; break;
+	default:
+	    std::cerr << "mvabench: unknown option " << static_cast<char>(c) << std::endl;
+	    /* Fall through */
+	case 'h':
+	    std::cerr << "Usage: mvabench [-m stations] [-k classes] [-e entries] [-n customers] [-r repeat] [-s] [-l]" << std::endl;
+	    return c == 'h' ? 0 : 1;
+	}
+    }
+    if ( !schweitzer && !linearizer ) {
+	schweitzer = true;
+	linearizer = true;
+    }
+
+    /* The model: FCFS stations with entries visited by every class, plus terminals. */
+
+    Vector<Server *> station( n_stations + 1 );
+    Population customers( n_chains );
+    VectorMath<double> thinkTime( n_chains );
+    VectorMath<unsigned> priority( n_chains );
+
+    for ( unsigned m = 1; m <= n_stations; ++m ) {
+	station[m] = new FCFS_Server( n_entries, n_chains );
+	for ( unsigned e = 1; e <= n_entries; ++e ) {
+	    for ( unsigned k = 1; k <= n_chains; ++k ) {
+		station[m]->setService( e, k, 1, 0.5 + 0.1 * ((m + e + k) % 7) );
+		station[m]->setVisits( e, k, 1, 1.0 + ((m * k + e) % 3) );
+	    }
+	}
+    }
+    station[n_stations+1] = new Infinite_Server( n_chains );
+    for ( unsigned k = 1; k <= n_chains; ++k ) {
+	station[n_stations+1]->setService( k, 1.0 ).setVisits( k, 1.0 );
+	customers[k] = n_customers;
+	thinkTime[k] = 0.0;
+	priority[k] = 0;
+    }
+
+    std::cout << "stations=" << n_stations << ", classes=" << n_chains << ", entries=" << n_entries
+	      << ", customers=" << n_customers << ", repeat=" << n_repeat << std::endl;
+    for ( std::map<const std::string, MVA::new_solver>::const_iterator solver = solvers.begin(); solver != solvers.end(); ++solver ) {
+	if ( (solver->first == "Linearizer" && !linearizer) || (solver->first == "Bard-Schweitzer" && !schweitzer) ) continue;
+
+	MVA * model = (*solver->second)( station, customers, thinkTime, priority, nullptr );
+	unsigned long waits = 0;
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for ( unsigned i = 0; i < n_repeat; ++i ) {
+	    model->reset();
+	    model->solve();
+	    waits += model->waits();
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << std::setw(16) << std::left << solver->first << std::right
+		  << std::setw(12) << std::setprecision(4) << elapsed.count() * 1.0e6 / n_repeat << " us/solve"
+		  << std::setw(12) << std::setprecision(4) << elapsed.count() * 1.0e9 / waits << " ns/wait"
+		  << "  X_1=" << model->throughput( 1 ) << std::endl;
+	delete model;
+    }
+
+    for ( unsigned m = 1; m <= n_stations + 1; ++m ) {
+	delete station[m];
+    }
+    return 0;
+}
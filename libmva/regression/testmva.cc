@@ -21,6 +21,7 @@
 #include <config.h>
 #endif
 #include "testmva.h"
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <unistd.h>
@@ -32,6 +33,7 @@
 
 static bool doIt( const solverId, Vector<Server *>& Q, const Population & NCust, const VectorMath<double>& thinkTime, const VectorMath<unsigned>& priority, const unsigned special );
 static bool run( const unsigned solver_set, const unsigned special );
+static bool same_as_serial( const MVA&, Vector<Server *>&, const Population&, const VectorMath<double>&, const VectorMath<unsigned>& );
 static void usage();
 char * progname;
 
@@ -49,15 +51,17 @@ const struct option longopts[] =
     { "linearizer",      no_argument,       0, 'l' },
     { "no-check",        no_argument,       0, 'n' },
     { "print",           no_argument,       0, 'p' },
+    { "rolling-storage", no_argument,       0, 'r' },
     { "silent",          no_argument,       0, 's' },
     { "test-number",     required_argument, 0, 't' },
+    { "threads",         required_argument, 0, 'T' },
     { "verbose",         no_argument,       0, 'v' },
     { 0, 0, 0, 0 }
 };
 #else
 #warning No getopt_long
 #endif
-const char opts[]	= "abdefhi:lnpst:v";
+const char opts[]	= "abdefhi:lnprst:T:v";
 const char * opthelp[]  = {
     /* "all",             */    "Test using all MVA solvers.",
     /* "bard-schweitzer", */    "Test using Bard-Schweitzer solver.",
@@ -69,8 +73,10 @@ const char * opthelp[]  = {
     /* "linearizer",      */    "Test using Generic Linearizer.",
     /* "no-check",        */    "Do not check solution against \"correct\" values.",
     /* "print"		  */	"Print out station info.",
+    /* "rolling-storage", */    "Use two level storage for Exact MVA and check against the full solution.",
     /* "silent",          */    "",
     /* "test",            */    "Select test ARG.  Arg is an integer.",
+    /* "threads",         */    "Use ARG threads for Exact MVA and check against the serial solution.",
     /* "verbose",         */    "",
     0
 };
@@ -154,6 +160,10 @@ int main (int argc, char *argv[])
 	    print_flag = 1;
 	    break;
 			    
+	case 'r':
+	    MVA::__rolling = true;
+	    break;
+
 	case 's':
 	    silencio_flag = 1;
 	    break;
@@ -165,6 +175,13 @@ int main (int argc, char *argv[])
 	    }
 	    break;
 			
+	case 'T':
+	    if ( sscanf( optarg, "%u", &MVA::__threads ) != 1 || MVA::__threads == 0 ) {
+		std::cerr << "Bogus thread count: " << optarg << std::endl;
+		exit( 1 );
+	    }
+	    break;
+
 	case 'v':
 	    verbose_flag = 1;
 	    break;
@@ -307,11 +324,68 @@ doIt( solverId solver, Vector<Server *>& Q, const Population & N, const VectorMa
 	if ( !nocheck_flag ) {
 	    ok = check( (int)solver, *model, special );
 	}
+	if ( solver == EXACT_SOLVER && (MVA::__threads > 1 || MVA::__rolling)
+	     && std::all_of( Q.begin(), Q.end(), []( const Server * q ){ return q->independentSteps(); } ) ) {
+	    ok = same_as_serial( *model, Q, N, Z, priority ) && ok;
+	}
     }
 	
     delete model;
     return ok;
 }
+
+
+/*
+ * The wavefront and two level solutions must be bit-identical to the
+ * serial solution over the full population.
+ */
+
+static bool
+same_as_serial( const MVA& parallel, Vector<Server *>& Q, const Population & N, const VectorMath<double> &Z, const VectorMath<unsigned>& priority )
+{
+    const unsigned threads = MVA::__threads;
+    const bool rolling = MVA::__rolling;
+    const unsigned M = Q.size();
+    const unsigned K = N.size();
+    Vector<double> X( K );
+    Vector<double> L( M * K );
+    Vector<double> U( M * K );
+    Vector<double> W( M * K );
+
+    for ( unsigned m = 1; m <= M; ++m ) {
+	for ( unsigned k = 1; k <= K; ++k ) {
+	    L[(m-1)*K+k] = parallel.queueLength( *Q[m], k );
+	    U[(m-1)*K+k] = parallel.utilization( *Q[m], k );
+	    W[(m-1)*K+k] = Q[m]->R( k );
+	}
+    }
+    for ( unsigned k = 1; k <= K; ++k ) {
+	X[k] = parallel.throughput( k );
+    }
+
+    MVA::__threads = 1;
+    MVA::__rolling = false;
+    ExactMVA serial( Q, N, Z, priority );
+    serial.solve();
+    MVA::__threads = threads;
+    MVA::__rolling = rolling;
+
+    bool ok = parallel.iterations() == serial.iterations() && parallel.waits() == serial.waits();
+    for ( unsigned m = 1; m <= M; ++m ) {
+	for ( unsigned k = 1; k <= K; ++k ) {
+	    ok = ok && L[(m-1)*K+k] == serial.queueLength( *Q[m], k )
+		&& U[(m-1)*K+k] == serial.utilization( *Q[m], k )
+		&& W[(m-1)*K+k] == Q[m]->R( k );
+	}
+    }
+    for ( unsigned k = 1; k <= K; ++k ) {
+	ok = ok && X[k] == serial.throughput( k );
+    }
+    if ( !ok ) {
+	std::cerr << "Exact MVA with " << threads << " threads" << (rolling ? " and two level storage" : "") << " differs from the serial solution." << std::endl;
+    }
+    return ok;
+}
 
 static void
 usage() 
@@ -0,0 +1,104 @@
+/*  -*- c++ -*-
+ * Contiguous storage for the station arrays of the MVA solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October, 2026
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include "arena.h"
+
+Arena::Arena()
+    : _storage(), _values(nullptr), _capacity(0), _used(0), _rows(), _used_rows(0), _tables(), _used_tables(0)
+{
+}
+
+
+/*
+ * Drop everything and make room for the number of values (rounded by
+ * the caller with round()), rows and tables given.
+ */
+
+void
+Arena::reserve( const size_t values, const size_t rows, const size_t tables )
+{
+    _storage.reset( values > 0 ? new double[values + __line] : nullptr );
+    _values = _storage.get();
+    if ( _values ) {
+	const size_t misaligned = reinterpret_cast<std::uintptr_t>(_values) % (__line * sizeof(double));
+	if ( misaligned ) {
+	    _values += (__line * sizeof(double) - misaligned) / sizeof(double);
+	}
+    }
+    _capacity = values;
+    _used = 0;
+    _rows.assign( rows, nullptr );
+    _used_rows = 0;
+    _tables.assign( tables, nullptr );
+    _used_tables = 0;
+}
+
+
+void
+Arena::swap( Arena& arena )
+{
+    std::swap( _storage, arena._storage );
+    std::swap( _values, arena._values );
+    std::swap( _capacity, arena._capacity );
+    std::swap( _used, arena._used );
+    std::swap( _rows, arena._rows );
+    std::swap( _used_rows, arena._used_rows );
+    std::swap( _tables, arena._tables );
+    std::swap( _used_tables, arena._used_tables );
+}
+
+
+/*
+ * Return n zeroed values starting on a cache line.
+ */
+
+double *
+Arena::values( const size_t n )
+{
+    const size_t size = round( n );
+    assert( _used + size <= _capacity );
+    double * values = &_values[_used];
+    std::fill( values, values + size, 0.0 );
+    _used += size;
+    return values;
+}
+
+
+/*
+ * Return a table of n rows.  All are null.
+ */
+
+double **
+Arena::rows( const size_t n )
+{
+    assert( _used_rows + n <= _rows.size() );
+    double ** rows = _rows.data() + _used_rows;
+    _used_rows += n;
+    return rows;
+}
+
+
+/*
+ * Return a table of n tables.  All are null.
+ */
+
+double ***
+Arena::tables( const size_t n )
+{
+    assert( _used_tables + n <= _tables.size() );
+    double *** tables = _tables.data() + _used_tables;
+    _used_tables += n;
+    return tables;
+}
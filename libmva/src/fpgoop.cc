@@ -31,6 +31,7 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 #if HAVE_SIGNAL_H
 #include <signal.h>
 #endif
@@ -245,18 +246,22 @@ fp_status_bits()
 }
 
 /*
- * return factorial.  Cache results.
+ * return factorial.  Cache results.  The caches are filled once (and
+ * thread safely) on first use as the MVA solvers may run in parallel.
  */
 
 double
 factorial( unsigned n )
 {
-    static double a[101];
-    if ( n == 1 || n == 0 ) return 1.0;
-    if ( n <= 100 ) {
-	if ( a[n] == 0 ) {
-	    a[n] = static_cast<double>(n) * factorial(n-1);
+    static const std::vector<double> a = []{
+	std::vector<double> a( 101, 1.0 );
+	for ( unsigned i = 2; i <= 100; ++i ) {
+	    a[i] = static_cast<double>(i) * a[i-1];
 	}
+	return a;
+    }();
+
+    if ( n <= 100 ) {
 	return a[n];
     } else {
 	double product;
@@ -275,14 +280,16 @@ factorial( unsigned n )
 double
 log_factorial( const unsigned n )
 {
-    static double a[101];	/* Automatically initialized to zero! */
-	
+    static const std::vector<double> a = []{
+	std::vector<double> a( 101, 0.0 );
+	for ( unsigned i = 2; i <= 100; ++i ) {
+	    a[i] = std::lgamma( i + 1.0 );
+	}
+	return a;
+    }();
+
     if ( n == 0 ) throw std::domain_error( "log_factorial(0)" );
-    if ( n == 1 ) return 0.0;
     if ( n <= 100 ) {
-	if ( a[n] == 0 ) {
-	    a[n] = std::lgamma( n + 1.0 );
-	}
 	return a[n];
     } else {
 	return std::lgamma( n + 1.0 );
@@ -0,0 +1,64 @@
+/* -*- c++ -*-
+ * Contiguous storage for the station arrays of the MVA solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October, 2026
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#if	!defined(LIBMVA_ARENA_H)
+#define	LIBMVA_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/*
+ * The solvers index their results through pointer tables, e.g.,
+ * L[n][m][e][k] and W[e][k][p].  An arena holds all of the values for
+ * an array in one cache aligned block and the pointer tables in two
+ * more, so the existing indexing is unchanged but the rows that the
+ * inner loops walk are adjacent in memory.  Space is handed out in
+ * order and is only returned when the arena is destroyed.
+ */
+
+class Arena
+{
+public:
+    static const size_t __line = 64 / sizeof(double);	/* Doubles per cache line.	*/
+
+    Arena();
+    ~Arena() {}
+
+private:
+    Arena( const Arena& ) = delete;
+    Arena& operator=( const Arena& ) = delete;
+
+public:
+    /* Round n up to a whole number of cache lines. */
+    static size_t round( const size_t n ) { return (n + __line - 1) / __line * __line; }
+
+    void reserve( const size_t values, const size_t rows, const size_t tables );
+    void swap( Arena& );
+
+    double * values( const size_t );
+    double ** rows( const size_t );
+    double *** tables( const size_t );
+
+    size_t size() const { return _capacity; }
+
+private:
+    std::unique_ptr<double[]> _storage;
+    double * _values;			/* _storage on a cache line.	*/
+    size_t _capacity;			/* Doubles in _values.		*/
+    size_t _used;			/* Doubles handed out.		*/
+    std::vector<double *> _rows;	/* Tables of rows.		*/
+    size_t _used_rows;
+    std::vector<double **> _tables;	/* Tables of tables.		*/
+    size_t _used_tables;
+};
+#endif
@@ -332,6 +332,7 @@ public:
     virtual void openWait() const { return Reiser_Multi_Server::openWait(); }
 
     virtual unsigned int getMarginalProbabilitiesSize() const { return 0; }	/* No need for marginals	*/
+    virtual bool independentSteps() const { return false; }			/* filter() uses last W		*/
 
     virtual const std::string& typeStr() const { return __type_str; }
 
@@ -520,6 +521,7 @@ public:
     virtual void openWait() const { return Reiser_Multi_Server::openWait(); }
 
     virtual unsigned int getMarginalProbabilitiesSize() const { return 0; }	/* No need for marginals	*/
+    virtual bool previousLevelOnly() const { return false; }		/* Uses throughput at NCust	*/
 
     virtual const std::string& typeStr() const { return __type_str; }
 
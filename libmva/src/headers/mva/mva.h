@@ -21,12 +21,16 @@
 #define BUG_471		1
 
 #include <vector>
+#include "arena.h"
 #include "pop.h"
 #include "prob.h"
 #include "vector.h"
 
 class MVA;
 class Server;
+class FCFS_Server;
+class PS_Server;
+class Infinite_Server;
 
 std::ostream& operator<<( std::ostream &, MVA& );
 
@@ -142,11 +146,14 @@ public:
 protected:
     void dimension( const size_t );
     bool dimension( std::vector<double **>&, const size_t );
+    void clear( const size_t );
     void setMaxP();
     virtual const PopulationMap& getMap() const = 0;
     unsigned offset( const Population& N ) const { return getMap().offset( N ); }
     unsigned offset_e_j( const Population& N, const unsigned j ) const { return getMap().offset_e_j( N, j ); }
     void clearCount() { waitCount = 0; stepCount = 0; faultCount = 0; }
+    void batchStations();
+    virtual bool batchWaits() const { return true; }		/* False if sumOf_L_m() or sumOf_SL_m() are redefined. */
 
 public:
     double throughput( const unsigned m, const unsigned k, const Population& N ) const;
@@ -157,6 +164,7 @@ public:
 
 protected:
     void step( const Population& );
+    void priorityStep( const Population& );
     void step( const Population&, const unsigned );
     virtual void marginalQueueProbabilities( const unsigned m, const Population& N ) = 0;
     virtual void marginalStateProbabilities( const unsigned m, const Population& N ) = 0;
@@ -170,6 +178,9 @@ protected:
     std::ostream& printStateP( std::ostream& output, const unsigned m, const Population& N ) const;
 
 private:
+    double sumOf_L_m( const Server& station, const Population &N, const unsigned j, const unsigned Nej ) const;
+    double sumOf_SL_m( const Server& station, const Population &N, const unsigned j, const unsigned Nej ) const;
+    bool scaled( const Server& station ) const;
     double tau_overlap( const Server&, const unsigned j, const unsigned k, const Population& N ) const;
     double tau( const Server&, const unsigned j, const unsigned k, const Population& ) const;
 
@@ -182,6 +193,8 @@ public:
 
 public:
     static int __bounds_limit;		/* Enable bounds limiting.	*/
+    static unsigned __threads;		/* Threads for Exact MVA.	*/
+    static bool __rolling;		/* Two level storage for Exact.	*/
     static double MOL_multiserver_underrelaxation;
 #if DEBUG_MVA
     static bool debug_D;
@@ -215,10 +228,19 @@ protected:
     Vector<size_t> maxP;		/* Dimension of P[][][J]	*/
 
 private:
+    Arena _arena;			/* Storage for L, U and X.	*/
+    std::vector<const FCFS_Server *> _fcfs;	/* Stations for the batched	*/
+    std::vector<const PS_Server *> _ps;		/* wait() in step().  All	*/
+    std::vector<const Infinite_Server *> _delay;/* others are in _other.	*/
+    std::vector<Server *> _other;
     unsigned nPrio;			/* Number of unique priorities	*/
     Vector<unsigned> sortedPrio;	/* sorted and uniq priorities	*/
+
+protected:
     unsigned long stepCount;		/* Number of iterations of step	*/
     unsigned long waitCount;		/* Number of calls to wait	*/
+
+private:
     Vector<unsigned> _isThread;
 };
 
@@ -236,17 +258,25 @@ public:
     virtual double filter() const { return 1.0; }
     virtual bool isExactMVA() const {return true;}
 private:
-    unsigned offset( const Population& N ) const { return map.offset( N ); }
-    unsigned offset_e_j( const Population& N, const unsigned j ) const { return map.offset_e_j( N, j ); }
+    class Wavefront;
+
+    unsigned offset( const Population& N ) const { return _rolling ? levels.offset( N ) : map.offset( N ); }
+    unsigned offset_e_j( const Population& N, const unsigned j ) const { return _rolling ? levels.offset_e_j( N, j ) : map.offset_e_j( N, j ); }
+
+    bool independentSteps() const;
+    bool previousLevelOnly() const;
+    void solveByLevel();
 
 private:
     virtual void marginalQueueProbabilities( const unsigned m, const Population& N );
     virtual void marginalStateProbabilities( const unsigned m, const Population& N );
 
-    virtual const PopulationMap& getMap() const { return map; }
+    virtual const PopulationMap& getMap() const { if ( _rolling ) return levels; else return map; }
 
 private:
     FullPopulationMap map;
+    LevelPopulationMap levels;		/* Also used to find levels.	*/
+    bool _rolling;			/* Only two levels are stored.	*/
     static const char * const __typeName;
 };
 
@@ -268,7 +298,8 @@ protected:
     void core( const Population &, const unsigned );
 
     virtual void estimate_L( const Population & );
-    void estimate_Lm( const unsigned m, const Population & N, const unsigned n ) const;
+    void estimate_Lm( const unsigned m, const std::vector<double>& N_k, const unsigned n, const unsigned j, const unsigned Nej ) const;
+    static std::vector<double> customers( const Population& N );
     virtual void estimate_P( const Population & N ) = 0;
 
 private:
@@ -278,7 +309,7 @@ private:
     virtual void marginalQueueProbabilities( const unsigned m, const Population& N );
     virtual void marginalStateProbabilities( const unsigned m, const Population& N );
 
-    virtual double D_mekj( const unsigned, const unsigned, const unsigned, const unsigned ) const { return 0.0; }
+    virtual const double * D_mej( const unsigned, const unsigned, const unsigned ) const { return nullptr; }
 
 protected:
     const double termination_test;
@@ -339,7 +370,7 @@ protected:
     virtual unsigned offset_e_c_e_j( const unsigned c, const unsigned j ) const { return getMap().offset_e_c_e_j( c, j ); }
 
     virtual void update_Delta( const Population & N );
-    double D_mekj( const unsigned m, const unsigned e, const unsigned k, const unsigned j ) const { return D[m][e][k][j]; }
+    const double * D_mej( const unsigned m, const unsigned e, const unsigned j ) const { return D[m][e][j]; }
     std::ostream& printD( std::ostream&, const Population& ) const;
 
     virtual void estimate_P( const Population & N );
@@ -352,7 +383,7 @@ protected:
     N_m_e_k saved_L;			/* Saved queue length.		*/
     N_m_e_k saved_U;			/* Saved utilization.		*/
     std::vector<double **> saved_P;	/* Saved marginal queue.	*/
-    double ****D;			/* Delta Fraction of jobs.	*/
+    double ****D;			/* Delta Fraction of jobs [m][e][j][k].	*/
     unsigned c;				/* Customer from class c removed*/
     PartialPopulationMap map;
 private:
@@ -388,6 +419,7 @@ public:
     virtual double sumOf_SL_m( const Server&, const Population &, const unsigned ) const;
 
 protected:
+    virtual bool batchWaits() const { return false; }
     void update_Delta( const Population & );
     void estimate_L( const Population & );
 
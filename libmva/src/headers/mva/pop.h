@@ -18,6 +18,7 @@
 #define	POPULATION_H
 
 #include <numeric>
+#include <vector>
 #include "vector.h"
 
 #if __MSYS__
@@ -208,4 +209,33 @@ public:
     unsigned offset( const Population & N ) const;
     unsigned offset_e_j( const Population & N, const unsigned j ) const;
 };
+
+//Only support two adjacent levels (total number of customers) of the
+//full population.  Levels alternate between the lower and upper half
+//of the arrays, so solving level n overwrites level n-2.
+class LevelPopulationMap : public PopulationMap
+{
+public:
+    LevelPopulationMap( const Population & );
+    virtual ~LevelPopulationMap();
+    const PopulationMap& dimension( const Population & );
+
+    unsigned offset( const Population & N ) const;
+    unsigned offset_e_j( const Population & N, const unsigned j ) const;
+
+    size_t size( const unsigned n ) const { return count( 1, n ); }
+    size_t width() const { return _width; }
+    void level( const unsigned n, std::vector<Population>& ) const;
+
+private:
+    size_t count( const unsigned k, const unsigned n ) const { return _count[k*(_total+1)+n]; }
+    size_t rank( const unsigned k, const unsigned i, const unsigned n ) const { return _rank[_base[k]+i*(_total+1)+n]; }
+
+private:
+    unsigned _total;			/* Customers in _maxN.		*/
+    size_t _width;			/* Size of the largest level.	*/
+    std::vector<size_t> _count;		/* Populations of classes k..K	*/
+    std::vector<size_t> _rank;		/* Populations before N[k]=i	*/
+    std::vector<size_t> _base;		/* Start of class k in _rank	*/
+};
 #endif
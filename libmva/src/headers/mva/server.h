@@ -18,6 +18,8 @@
 #if	!defined(LIBMVA_SERVER_H)
 #define	LIBMVA_SERVER_H
 
+#include <vector>
+#include "arena.h"
 #include "pop.h"
 #include "prob.h"
 #include "vector.h"
@@ -41,6 +43,43 @@ std::ostream& operator<<( std::ostream&, const Server& );
 
 class Server
 {
+public:
+    /*
+     * Waiting time storage indexed by [entry][class][phase].  ExactMVA
+     * may step several populations concurrently (see
+     * ExactMVA::solveByLevel()), so each worker thread writes to its own
+     * slot.  Slot 0 belongs to the calling thread and holds the results.
+     */
+
+    class Waits {
+    public:
+	Waits() : E(0), K(0), _slot(), _arena() {}
+	~Waits() {}
+
+    private:
+	Waits( const Waits& ) = delete;
+	Waits& operator=( const Waits& ) = delete;
+
+    public:
+	double ** operator[]( const unsigned e ) const { return _slot[__slot][e]; }
+
+	void dimension( const unsigned, const unsigned );
+	void slots( const unsigned );
+	unsigned slots() const { return _slot.size(); }
+
+    private:
+	void allocate( Arena&, std::vector<double ***>&, const unsigned ) const;
+
+    public:
+	static thread_local unsigned __slot;	/* Slot for this thread.	*/
+
+    private:
+	unsigned E;
+	unsigned K;
+	std::vector<double ***> _slot;
+	Arena _arena;			/* One cache aligned block per slot.	*/
+    };
+
 public:
     /* Initialization */
 
@@ -87,6 +126,8 @@ public:
     virtual bool infiniteServer() const { return false; }
     virtual bool priorityServer() const { return false; }
     virtual bool hasVariance() const { return false; }
+    virtual bool independentSteps() const { return true; }	/* wait() uses no state from prior steps */
+    virtual bool previousLevelOnly() const { return !priorityServer(); }	/* wait() uses only N and N-e_k */
 
     double S() const;
     double S( const MVA& solver, const Population& ) const;
@@ -153,7 +194,7 @@ private:
     void initialize();
 
 public:
-    double ***W;		/* Waiting time per visit.	*/
+    Waits W;			/* Waiting time per visit.	*/
     unsigned openIndex;		/* Not used locally.		*/
     unsigned closedIndex;	/* Not used locally.		*/
 
@@ -163,6 +204,7 @@ protected:
     const unsigned P;		/* Number of phases.		*/
 
 private:
+    Arena _arena;		/* Storage for s and v.		*/
     double ***s;		/* Service Time per phase.	*/
     double ***v;		/* Visit ratios per phase.	*/
     Probability ** IL;		/* Interlocking probability.	*/
@@ -226,6 +268,7 @@ public:
     virtual ~PS_Server() {}
 
     virtual void wait( const MVA& solver, const unsigned k, const Population & N ) const;
+    void setWait( const unsigned k, const Positive sum ) const;
     virtual void openWait() const;
 
     virtual const std::string& typeStr() const { return __type_str; }
@@ -288,6 +331,7 @@ public:
     virtual bool hasTau() const { return true; }
 
     virtual void wait( const MVA& solver, const unsigned k, const Population & N ) const;
+    void setWait( const unsigned k, const Positive sum ) const;
     virtual void openWait() const;
 
     virtual const std::string& typeStr() const { return __type_str; }
@@ -138,10 +138,17 @@
 #include <iomanip>
 #include <cmath>
 #include <algorithm>
+#include <atomic>
+#include <cfenv>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <thread>
+#include <typeinfo>
 #include "mva.h"
 #include "mvaexception.h"
 #include "fpgoop.h"
@@ -149,6 +156,8 @@
 #include "prob.h"
 
 int MVA::__bounds_limit = 0;		/* Enable bounds limiting if non-zero */
+unsigned MVA::__threads = 1;		/* Threads used by ExactMVA::solve() */
+bool MVA::__rolling = false;		/* ExactMVA keeps only two levels */
 double MVA::MOL_multiserver_underrelaxation = 0.5;	/* For MOL Multiservers */
 #if DEBUG_MVA
 bool MVA::debug_D = false;
@@ -191,7 +200,7 @@ MVA::MVA( Vector<Server *>& q, const Population& N,
 	  const Vector<double>* of )
     : NCust(N), M(q.size()), K(N.size()), Q(q), Z(thinkTime),
       priority(prio), overlapFactor(of), L(), U(), P(), X(),
-      faultCount(0), maxP(q.size()),
+      faultCount(0), maxP(q.size()), _arena(),
       nPrio(0), sortedPrio(), stepCount(0), waitCount(0), _isThread()
 {
     assert( M > 0 && K > 0 );
@@ -212,6 +221,9 @@ MVA::~MVA()
 
 /*
  * Allocate queue length storage for all M stations and K classes.
+ * L, U and X for each population are laid out next to each other in
+ * one arena, so each resize rebuilds the whole arena and copies over
+ * the values of the populations that are kept.
  */
 
 void
@@ -219,79 +231,74 @@ MVA::dimension( const size_t size )
 {
     const size_t old_size = L.size();
     
-    if ( old_size < size ) {
+    if ( old_size != size ) {
 
-	/* If array got bigger, add more space */
+	size_t rows = 0;			/* Per population.	*/
+	size_t values = 0;
+	for ( unsigned m = 1; m <= M; ++m ) {
+	    const unsigned E = Q[m]->nEntries();
+	    rows   += E + 1;
+	    values += E * (K + 1);
+	}
+	const size_t block = 2 * values + K + 1;	/* L, U then X.		*/
 
-	L.resize(size);
-	U.resize(size);
-	P.resize(size);
-	X.resize(size);
+	Arena arena;
+	arena.reserve( size * Arena::round( block ), size * 2 * rows, size * 2 * (M + 1) );
+	N_m_e_k new_L( size );
+	N_m_e_k new_U( size );
+	std::vector<double *> new_X( size );
 
-	for ( unsigned n = old_size; n < size; ++n) {
-	    L[n] = new double ** [M+1];
-	    U[n] = new double ** [M+1];
-	    P[n] = new double * [M+1];
-	    L[n][0] = nullptr;
-	    U[n][0] = nullptr;
-	    P[n][0] = nullptr;
+	for ( unsigned n = 0; n < size; ++n ) {
+	    double * value = arena.values( block );
+	    new_L[n] = arena.tables( M + 1 );
+	    new_U[n] = arena.tables( M + 1 );
 
 	    for ( unsigned m = 1; m <= M; ++m ) {
 		const unsigned E = Q[m]->nEntries();
-		L[n][m] = new double * [E+1];
-		U[n][m] = new double * [E+1];
-		P[n][m] = nullptr;
-		L[n][m][0] = nullptr;
-		U[n][m][0] = nullptr;
-
-		for ( unsigned e = 1; e <= E; ++e ) {
-		    L[n][m][e] = new double [K+1];
-		    U[n][m][e] = new double [K+1];
-
-		    for ( unsigned k = 0; k <= K; k++ ) {
-			L[n][m][e][k] = 0.0;
-			U[n][m][e][k] = 0.0;
-		    }
+		new_L[n][m] = arena.rows( E + 1 );
+		new_U[n][m] = arena.rows( E + 1 );
+		for ( unsigned e = 1; e <= E; ++e, value += K + 1 ) {
+		    new_L[n][m][e] = value;
+		}
+		for ( unsigned e = 1; e <= E; ++e, value += K + 1 ) {
+		    new_U[n][m][e] = value;
 		}
 	    }
-
-	    X[n] = new double [K+1];
-
-	    for ( unsigned k = 1; k <= K; ++k ) {
-		X[n][k] = 0.0;
+	    new_X[n] = value;
+
+	    if ( n < old_size ) {
+		for ( unsigned m = 1; m <= M; ++m ) {
+		    const unsigned E = Q[m]->nEntries();
+		    for ( unsigned e = 1; e <= E; ++e ) {
+			std::copy( &L[n][m][e][0], &L[n][m][e][K+1], &new_L[n][m][e][0] );
+			std::copy( &U[n][m][e][0], &U[n][m][e][K+1], &new_U[n][m][e][0] );
+		    }
+		}
+		std::copy( &X[n][0], &X[n][K+1], &new_X[n][0] );
 	    }
 	}
 
-    } else if ( size < old_size ) {
-
-	/* if the array got smaller, delete space from the end. */
+	/* Marginals are sized per station, so they live outside of the arena. */
 
-	for ( unsigned n = old_size; n > size; ) {
+	for ( size_t n = old_size; n > size; ) {
 	    n -= 1;
 	    for ( unsigned m = 1; m <= M; ++m ) {
-		const unsigned E = Q[m]->nEntries();
-
-		for ( unsigned e = 1; e <= E; ++e ) {
-		    delete [] L[n][m][e];
-		    delete [] U[n][m][e];
-		}
-
-		delete [] L[n][m];
-		delete [] U[n][m];
 		delete [] P[n][m];
 	    }
-
-	    delete [] L[n];
-	    delete [] U[n];
 	    delete [] P[n];
-	    delete [] X[n];
-
+	}
+	P.resize( size );
+	for ( size_t n = old_size; n < size; ++n ) {
+	    P[n] = new double * [M+1];
+	    for ( unsigned m = 0; m <= M; ++m ) {
+		P[n][m] = nullptr;
+	    }
 	}
 
-	L.resize(size);
-	U.resize(size);
-	X.resize(size);
-	P.resize(size);
+	L.swap( new_L );
+	U.swap( new_U );
+	X.swap( new_X );
+	_arena.swap( arena );
     }
 
     dimension( P, size );
@@ -356,36 +363,48 @@ MVA::reset()
     dimension( P, size );
 
     for ( unsigned n = 0; n < size; ++n) {
-	assert( L[n][0] == nullptr );
-	assert( U[n][0] == nullptr );
+	clear( n );
+    }
 
-	for ( unsigned m = 1; m <= M; ++m ) {
-	    const unsigned E = Q[m]->nEntries();
-	    assert( L[n][m][0] == nullptr );
-	    assert( U[n][m][0] == nullptr );
+    setMaxP();
+}
 
-	    for ( unsigned e = 1; e <= E; ++e ) {
-		for ( unsigned k = 0; k <= K; k++ ) {
-		    L[n][m][e][k] = 0.0;
-		    U[n][m][e][k] = 0.0;
-		}
-	    }
 
-	    if ( P[n][m] ) {
-		const unsigned J = Q[m]->getMarginalProbabilitiesSize();
-		for ( unsigned j = 0; j <= J; ++j ) {
-		    P[n][m][j] = 0.0;
-		}
-		P[n][m][0] = 1.0;	// Initially, no servers busy with zero customers.
+
+/*
+ * Reset the results for population offset n back to zero.
+ */
+
+void
+MVA::clear( const size_t n )
+{
+    assert( L[n][0] == nullptr );
+    assert( U[n][0] == nullptr );
+
+    for ( unsigned m = 1; m <= M; ++m ) {
+	const unsigned E = Q[m]->nEntries();
+	assert( L[n][m][0] == nullptr );
+	assert( U[n][m][0] == nullptr );
+
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    for ( unsigned k = 0; k <= K; k++ ) {
+		L[n][m][e][k] = 0.0;
+		U[n][m][e][k] = 0.0;
 	    }
 	}
 
-	for ( unsigned k = 1; k <= K; ++k ) {
-	    X[n][k] = 0.0;
+	if ( P[n][m] ) {
+	    const unsigned J = Q[m]->getMarginalProbabilitiesSize();
+	    for ( unsigned j = 0; j <= J; ++j ) {
+		P[n][m][j] = 0.0;
+	    }
+	    P[n][m][0] = 1.0;	// Initially, no servers busy with zero customers.
 	}
     }
 
-    setMaxP();
+    for ( unsigned k = 1; k <= K; ++k ) {
+	X[n][k] = 0.0;
+    }
 }
 
 
@@ -435,13 +454,27 @@ MVA::initialize()
 
 
 /*
- * Step by priority.
+ * Step by priority.  Every chain has exactly one priority, so wait()
+ * is called M * K times per step.
  */
 
 void
 MVA::step( const Population& N )
 {
     stepCount += 1;
+    waitCount += M * K;
+    priorityStep( N );
+}
+
+
+/*
+ * Step by priority without counting.  ExactMVA calls this directly
+ * from worker threads.
+ */
+
+void
+MVA::priorityStep( const Population& N )
+{
     for ( unsigned m = 1; m <= M; ++m ) {
 	Q[m]->initStep( *this );
     }
@@ -453,6 +486,39 @@ MVA::step( const Population& N )
 }
 
 
+/*
+ * Sort the stations by type for step().  Plain FCFS, PS and delay
+ * stations are the bulk of most models.  Their waiting times are
+ * found in batches with the offset of N - e_k found once for all of
+ * them rather than by each call to wait().  Everything else,
+ * including any subclass of these three, goes through wait().
+ * Called at the start of solve() as stations may be replaced between
+ * solutions.
+ */
+
+void
+MVA::batchStations()
+{
+    _fcfs.clear();
+    _ps.clear();
+    _delay.clear();
+    _other.clear();
+
+    for ( unsigned m = 1; m <= M; ++m ) {
+	const std::type_info& type = typeid( *Q[m] );
+	if ( batchWaits() && type == typeid( FCFS_Server ) ) {
+	    _fcfs.push_back( dynamic_cast<const FCFS_Server *>(Q[m]) );
+	} else if ( batchWaits() && type == typeid( PS_Server ) ) {
+	    _ps.push_back( dynamic_cast<const PS_Server *>(Q[m]) );
+	} else if ( type == typeid( Infinite_Server ) ) {
+	    _delay.push_back( dynamic_cast<const Infinite_Server *>(Q[m]) );
+	} else {
+	    _other.push_back( Q[m] );
+	}
+    }
+}
+
+
 /*
  * MVA core solver.  NB: the waiting time for each entry and class for a
  * particular station m, Q[m]->W[e][k], is solved based on the class of
@@ -466,11 +532,22 @@ MVA::step( const Population& N, const unsigned currPri )
     unsigned m;			/* Station index.		*/
     unsigned e;			/* Entry index.			*/
     unsigned k;			/* Class index.			*/
-    for ( m = 1; m <= M; ++m ) {
-	for ( k = 1; k <= K; ++k ) {
-	    if ( priority[k] != currPri ) continue;
-	    waitCount += 1;
-	    Q[m]->wait( *this, k, N );					/* Eq:1 */
+    assert( _fcfs.size() + _ps.size() + _delay.size() + _other.size() == M );	/* batchStations() */
+    for ( k = 1; k <= K; ++k ) {
+	if ( priority[k] != currPri ) continue;
+	const unsigned Nek = N[k] > 0 ? offset_e_j( N, k ) : 0;	/* Hoist */
+
+	for ( std::vector<const FCFS_Server *>::const_iterator station = _fcfs.begin(); station != _fcfs.end(); ++station ) {
+	    (*station)->setWait( k, N[k] > 0 ? sumOf_SL_m( **station, N, k, Nek ) : 0.0 );	/* Eq:1 */
+	}
+	for ( std::vector<const PS_Server *>::const_iterator station = _ps.begin(); station != _ps.end(); ++station ) {
+	    (*station)->setWait( k, 1.0 + (N[k] > 0 ? sumOf_L_m( **station, N, k, Nek ) : 0.0) );
+	}
+	for ( std::vector<const Infinite_Server *>::const_iterator station = _delay.begin(); station != _delay.end(); ++station ) {
+	    (*station)->Infinite_Server::wait( *this, k, N );
+	}
+	for ( std::vector<Server *>::const_iterator station = _other.begin(); station != _other.end(); ++station ) {
+	    (*station)->wait( *this, k, N );
 	}
     }
 
@@ -488,8 +565,9 @@ MVA::step( const Population& N, const unsigned currPri )
 	for ( m = 1; m <= M; ++m ) {
 	    const unsigned E = Q[m]->nEntries();
 	    for ( e = 1; e <= E; ++e ) {
-		if ( std::isfinite( Q[m]->R(e,k) ) ) {
-		    sum += Q[m]->R(e,k);
+		const double R = Q[m]->R(e,k);
+		if ( std::isfinite( R ) ) {
+		    sum += R;
 		} else {
 		    sum = std::numeric_limits<double>::infinity();
 		    break;
@@ -562,17 +640,30 @@ MVA::sumOf_L_m( const Server& station, const Population &N, const unsigned j ) c
 
     if ( N[j] < 1 ) return 0.0;
 
+    return sumOf_L_m( station, N, j, offset_e_j(N,j) );
+}
+
+
+/*
+ * As above, with the offset of N - e_j, Nej, found by the caller.
+ */
+
+double
+MVA::sumOf_L_m( const Server& station, const Population &N, const unsigned j, const unsigned Nej ) const
+{
     const unsigned m   = station.closedIndex;
     const unsigned E   = station.nEntries();
-    const unsigned Nej = offset_e_j(N,j);					/* Hoist */
+    const bool priorityServer = station.priorityServer();		/* Hoist */
+    const bool scale = scaled( station );
+    double ** const L_m = L[Nej][m];
 
     double sum = 0.0;
     for ( unsigned k = 1; k <= K; ++k ) {
-	if ( station.priorityServer() && priority[k] < priority[j] ) continue;
-	const double scaling = tau_overlap( station, j, k, N );
+	if ( priorityServer && priority[k] < priority[j] ) continue;
+	const double scaling = scale ? tau_overlap( station, j, k, N ) : 1.0;
 
 	for ( unsigned e = 1; e <= E; ++e ) {
-	    sum += L[Nej][m][e][k] * scaling;
+	    sum += L_m[e][k] * scaling;
 	}
     }
     return sum;
@@ -595,19 +686,32 @@ MVA::sumOf_SL_m( const Server& station, const Population &N, const unsigned j )
 
     if ( N[j] < 1 ) return 0.0;
 
+    return sumOf_SL_m( station, N, j, offset_e_j(N,j) );
+}
+
+
+/*
+ * As above, with the offset of N - e_j, Nej, found by the caller.
+ */
+
+double
+MVA::sumOf_SL_m( const Server& station, const Population &N, const unsigned j, const unsigned Nej ) const
+{
     const unsigned m   = station.closedIndex;
     const unsigned E   = station.nEntries();
-    const unsigned Nej = offset_e_j(N,j);					/* Hoist */
+    const bool priorityServer = station.priorityServer();		/* Hoist */
+    const bool scale = scaled( station );
+    double ** const L_m = L[Nej][m];
 
     double sum = 0.0;
     for ( unsigned k = 1; k <= K; ++k ) {
-	if ( station.priorityServer() && priority[k] < priority[j] ) continue;
-	const double scaling = tau_overlap( station, j, k, N );			/* BUG 145 */
+	if ( priorityServer && priority[k] < priority[j] ) continue;
+	const double scaling = scale ? tau_overlap( station, j, k, N ) : 1.0;	/* BUG 145 */
 
 	for ( unsigned e = 1; e <= E; ++e ) {
 	    const double s = station.S(e,k);
 	    if ( !std::isfinite(s) ) return s;					/* Infinitiy */
-	    sum += s * L[Nej][m][e][k] * scaling;
+	    sum += s * L_m[e][k] * scaling;
 	}
     }
     return sum;
@@ -1589,6 +1693,17 @@ MVA::nrFactor( const Server& station, const unsigned e, const unsigned k ) const
  * Common expression: tau and overlap corrections
  */
 
+/*
+ * True if tau_overlap() may return something other than one.
+ */
+
+bool
+MVA::scaled( const Server& station ) const
+{
+    return overlapFactor != nullptr || (station.hasTau() && __bounds_limit > 0);
+}
+
+
 double
 MVA::tau_overlap( const Server& station, const unsigned j, const unsigned k, const Population& N ) const
 {
@@ -1936,7 +2051,7 @@ MVA::printStateP( std::ostream& output, const unsigned m, const Population& N )
 const char * const ExactMVA::__typeName = "Exact MVA";
 
 ExactMVA::ExactMVA( Vector<Server *>&q, const Population& N, const Vector<double>& z, const Vector<unsigned>& prio, const Vector<double>* of )
-    : MVA( q, N, z, prio, of), map(N)
+    : MVA( q, N, z, prio, of), map(N), levels(N), _rolling(false)
 {
 }
 
@@ -1944,6 +2059,10 @@ ExactMVA::ExactMVA( Vector<Server *>&q, const Population& N, const Vector<double
 /*
  * Recursively solve for population vector N starting at [0,0,...,0]
  * to nCust.  The dimensionality of N is limited by stack size...
+ * With __rolling set, only the results for the current and previous
+ * number of customers are kept (the full lattice is needed if any
+ * station looks further back), so only the results at NCust are
+ * valid once solve() returns.
  */
 
 bool
@@ -1951,19 +2070,212 @@ ExactMVA::solve()
 {
     /* Allocate array space and initialize */
     reset();				/* Reset all vectors to zero. */
-    dimension( map.dimension( NCust ).maxOffset() );
+    levels.dimension( NCust );
+    _rolling = __rolling && independentSteps() && previousLevelOnly();
+    dimension( _rolling ? levels.maxOffset() : map.dimension( NCust ).maxOffset() );
     clearCount();
+    batchStations();
 
     /* Let er rip! */
 
-    for ( PopulationMap::iterator n = map.begin(); n != map.end(); ++n ) {
-	step( *n );
+    if ( _rolling || (__threads > 1 && independentSteps()) ) {
+	solveByLevel();
+    } else {
+	for ( PopulationMap::iterator n = map.begin(); n != map.end(); ++n ) {
+	    step( *n );
+	}
+    }
+    return true;
+}
+
+
+
+/*
+ * Populations can only be solved out of order if no station carries
+ * state from one step to the next.
+ */
+
+bool
+ExactMVA::independentSteps() const
+{
+    for ( unsigned m = 1; m <= M; ++m ) {
+	if ( !Q[m]->independentSteps() ) return false;
+    }
+    return true;
+}
+
+
+
+/*
+ * Two level storage can only be used if no station needs results for
+ * populations other than N and N less one customer.
+ */
+
+bool
+ExactMVA::previousLevelOnly() const
+{
+    for ( unsigned m = 1; m <= M; ++m ) {
+	if ( !Q[m]->previousLevelOnly() ) return false;
     }
     return true;
 }
 
 
 
+/*
+ * Worker threads for solveByLevel().  The calling thread posts a
+ * level (all of the populations with the same number of customers),
+ * then works on it along with the workers until it is done.  Each
+ * thread uses its own copy of the station waiting times
+ * (Server::Waits).  Floating point status and the first exception
+ * raised by any thread are passed back to the calling thread.
+ */
+
+class ExactMVA::Wavefront
+{
+public:
+    Wavefront( ExactMVA& solver, const unsigned n )
+	: _solver(solver), _mutex(), _start(), _done(), _threads(), _level(nullptr),
+	  _next(0), _generation(0), _busy(0), _finished(false), _error(), _env(), _raised(0)
+	{
+	    for ( unsigned i = 1; i < n; ++i ) {
+		_threads.push_back( std::thread( &Wavefront::worker, this, i ) );
+	    }
+	}
+
+    ~Wavefront()
+	{
+	    {
+		std::lock_guard<std::mutex> lock( _mutex );
+		_finished = true;
+	    }
+	    _start.notify_all();
+	    for ( std::vector<std::thread>::iterator thread = _threads.begin(); thread != _threads.end(); ++thread ) {
+		thread->join();
+	    }
+	}
+
+    void operator()( const std::vector<Population>& level )
+	{
+	    {
+		std::lock_guard<std::mutex> lock( _mutex );
+		std::fegetenv( &_env );
+		_level = &level;
+		_next = 0;
+		_busy = _threads.size();
+		_generation += 1;
+	    }
+	    _start.notify_all();
+	    run();
+	    std::unique_lock<std::mutex> lock( _mutex );
+	    _done.wait( lock, [this]{ return _busy == 0; } );
+	    std::feraiseexcept( _raised );
+	    _raised = 0;
+	    if ( _error ) {
+		std::exception_ptr error = _error;
+		_error = nullptr;
+		std::rethrow_exception( error );
+	    }
+	}
+
+private:
+    void worker( const unsigned slot )
+	{
+	    Server::Waits::__slot = slot;
+	    unsigned long generation = 0;
+	    for ( ;; ) {
+		{
+		    std::unique_lock<std::mutex> lock( _mutex );
+		    _start.wait( lock, [&]{ return _finished || _generation != generation; } );
+		    if ( _finished ) return;
+		    generation = _generation;
+		    std::fesetenv( &_env );
+		}
+		run();
+		const int raised = std::fetestexcept( FE_ALL_EXCEPT );
+		std::lock_guard<std::mutex> lock( _mutex );
+		_raised |= raised;
+		_busy -= 1;
+		if ( _busy == 0 ) _done.notify_one();
+	    }
+	}
+
+    void run()
+	{
+	    const size_t size = _level->size();
+	    for ( size_t i = _next++; i < size; i = _next++ ) {
+		try {
+		    _solver.priorityStep( (*_level)[i] );
+		}
+		catch ( ... ) {
+		    std::lock_guard<std::mutex> lock( _mutex );
+		    if ( !_error ) _error = std::current_exception();
+		    _next = size;		/* Stop everyone. */
+		}
+	    }
+	}
+
+private:
+    ExactMVA& _solver;
+    std::mutex _mutex;
+    std::condition_variable _start;		/* Level posted.		*/
+    std::condition_variable _done;		/* All workers finished.	*/
+    std::vector<std::thread> _threads;
+    const std::vector<Population>* _level;	/* Populations to solve.	*/
+    std::atomic<size_t> _next;			/* Next population in _level.	*/
+    unsigned long _generation;			/* Number of levels posted.	*/
+    unsigned _busy;				/* Workers still running.	*/
+    bool _finished;
+    std::exception_ptr _error;
+    std::fenv_t _env;				/* Caller's FP environment.	*/
+    int _raised;				/* FP exceptions from workers.	*/
+};
+
+
+
+/*
+ * Solve the populations as a wavefront.  All populations with the
+ * same total number of customers depend only on populations with one
+ * customer fewer, so each level can be stepped in parallel.  Levels
+ * with only one population, including NCust, are stepped by the
+ * calling thread, so the waiting times left in each station (and all
+ * results) are the same as from the serial loop.  With two level
+ * storage, the results from two levels back are cleared first.
+ */
+
+void
+ExactMVA::solveByLevel()
+{
+    const unsigned n = std::max( std::min( static_cast<size_t>(__threads), levels.width() ), static_cast<size_t>(1) );
+
+    for ( unsigned m = 1; m <= M; ++m ) {
+	Q[m]->W.slots( n );
+    }
+
+    Wavefront wavefront( *this, n );
+    std::vector<Population> level;
+    const unsigned total = NCust.sum();
+    for ( unsigned i = 1; i <= total; ++i ) {
+	levels.level( i, level );
+	if ( _rolling && i > 1 ) {
+	    for ( std::vector<Population>::const_iterator N = level.begin(); N != level.end(); ++N ) {
+		clear( offset( *N ) );
+	    }
+	}
+	if ( level.size() > 1 && n > 1 ) {
+	    wavefront( level );
+	    stepCount += level.size();
+	    waitCount += level.size() * M * K;
+	} else {
+	    for ( std::vector<Population>::const_iterator N = level.begin(); N != level.end(); ++N ) {
+		step( *N );
+	    }
+	}
+    }
+}
+
+
+
 /*
  * Compute the probabilities that servers are idle.  PB(N) == P(J,N)
  * is the probability that all servers are busy.  Subclasses assign
@@ -2377,53 +2689,77 @@ void
 SchweitzerCommon::estimate_L( const Population & N )
 {
     const unsigned n = offset(N);
-    for ( unsigned m = 1; m <= M; ++m ) {
-	estimate_Lm( m, N, n );
+    const std::vector<double> N_k = customers( N );
+
+    for ( unsigned j = 1; j <= K; ++j ) {
+	if ( N[j] < 1 ) continue;				/* Eq:11 */
+	const unsigned Nej = offset_e_j(N, j);			/* Hoist */
+
+	for ( unsigned m = 1; m <= M; ++m ) {
+	    estimate_Lm( m, N_k, n, j, Nej );
+	}
     }
 }
 
 
 
 /*
- * Core step of estimate_L.
+ * Core step of estimate_L for station m and N - e_j.  N_k is the
+ * population, by class, as doubles.  The inner loop runs over the
+ * classes, which are adjacent in L, U and D, and has no branches so
+ * that it can be vectorized.  Classes with no customers or with an
+ * infinite queue length are left as is.  Their terms are computed
+ * with safe values so that no floating point exceptions are raised.
  */
 
 void
-SchweitzerCommon::estimate_Lm( const unsigned m, const Population & N, const unsigned n ) const
+SchweitzerCommon::estimate_Lm( const unsigned m, const std::vector<double>& N_k, const unsigned n, const unsigned j, const unsigned Nej ) const
 {
     const unsigned E = Q[m]->nEntries();
 
-    for ( unsigned j = 1; j <= K; ++j ) {
-	if ( N[j] < 1 ) continue;				/* Eq:11 */
-	const unsigned Nej = offset_e_j(N, j);
+    for ( unsigned e = 1; e <= E; ++e ) {
+	const double * const L_n = L[n][m][e];
+	const double * const U_n = U[n][m][e];
+	double * const L_ej = L[Nej][m][e];
+	double * const U_ej = U[Nej][m][e];
+	const double * const D = D_mej( m, e, j );		/* Null for Schweitzer */
 
 	for ( unsigned k = 1; k <= K; ++k ) {
-	    if ( N[k] < 1 ) continue;
-	    const double N_k = static_cast<double>(N[k]);
-
-	    for ( unsigned e = 1; e <= E; ++e ) {
-		const double L_n_m_e_k = L[n][m][e][k];
-		if ( !std::isfinite( L_n_m_e_k ) ) continue;
+	    const bool ok = N_k[k] >= 1.0 && std::isfinite( L_n[k] );
+	    const double N = ok ? N_k[k] : 1.0;
+	    const double L_n_m_e_k = ok ? L_n[k] : 0.0;
 
-		const double F  = L_n_m_e_k / N_k;		/* Eq:9 */
-		const double L_ej = std::max( (N_k - static_cast<double>( k == j )) * (F + D_mekj(m,e,k,j)), 0. );
+	    const double F  = L_n_m_e_k / N;			/* Eq:9 */
+	    const double L_e = std::max( (N - static_cast<double>( k == j )) * (F + (D ? D[k] : 0.0)), 0. );
 
-		L[Nej][m][e][k] = L_ej;
+	    L_ej[k] = ok ? L_e : L_ej[k];
 
-		/* Now estimate utilizations based on queue lengths. */
+	    /* Now estimate utilizations based on queue lengths. */
 
-		if ( L_n_m_e_k > 0.0 ) {
-		    U[Nej][m][e][k] = L_ej / L_n_m_e_k * U[n][m][e][k];
-		} else {
-		    U[Nej][m][e][k] = 0.0;
-		}
-	    }
+	    const double U_e = L_e / (L_n_m_e_k > 0.0 ? L_n_m_e_k : 1.0) * U_n[k];
+	    U_ej[k] = !ok ? U_ej[k] : L_n_m_e_k > 0.0 ? U_e : 0.0;
 	}
     }
 }
 
 
 
+/*
+ * Return N by class as doubles for estimate_Lm() and update_Delta().
+ */
+
+std::vector<double>
+SchweitzerCommon::customers( const Population& N )
+{
+    std::vector<double> N_k( N.size() + 1, 0.0 );
+    for ( unsigned k = 1; k <= N.size(); ++k ) {
+	N_k[k] = static_cast<double>(N[k]);
+    }
+    return N_k;
+}
+
+
+
 /*
  * Compute marginal probabilities component.  This version is based on:
  *
@@ -2576,15 +2912,16 @@ SchweitzerCommon::max_delta_L( const unsigned n, const Population &N ) const
 {
     /* Iteration termination test. */
 
+    const std::vector<double> N_k = customers( N );
     double max_delta = 0.0;
     for ( unsigned m = 1; m <= M; ++m ) {
 	const unsigned E = Q[m]->nEntries();
 	for ( unsigned e = 1; e <= E; ++e ) {
+	    const double * const L_n = L[n][m][e];
+	    const double * const last = last_L[m][e];
 	    for ( unsigned k = 1; k <= K; ++k ) {
-		if ( N[k] == 0 ) continue;
-
-		double temp = fabs( L[n][m][e][k] - last_L[m][e][k] ) / N[k];
-		if ( temp > max_delta ) max_delta = temp;
+		const double temp = fabs( L_n[k] - last[k] ) / (N_k[k] > 0.0 ? N_k[k] : 1.0);
+		max_delta = std::max( max_delta, N_k[k] > 0.0 ? temp : 0.0 );	/* Ignores NaN */
 	    }
 	}
     }
@@ -2680,6 +3017,7 @@ Schweitzer::solve()
 {
     map.dimension( NCust );				/* Reset ALL associated arrays */
     clearCount();
+    batchStations();
 
     bool reset = !initialized;
     reset = dimension( P, getMap().maxOffset() ) || reset;
@@ -2723,6 +3061,7 @@ OneStepMVA::solve()
 {
     map.dimension( NCust );				/* Reset ALL associated arrays */
     clearCount();
+    batchStations();
 
     bool reset = !initialized;
     reset = dimension( P, getMap().maxOffset() ) || reset;
@@ -2897,6 +3236,7 @@ Linearizer::solve()
 
     map.dimension( NCust );		/* Reset ALL associated arrays */
     clearCount();
+    batchStations();
 
     /* Initialize */
 
@@ -3060,13 +3400,16 @@ Linearizer::estimate_P( const Population & N )
 
 
 /*
- * Update fraction of jobs at station.
+ * Update fraction of jobs at station.  D is stored by j then k so
+ * that, like estimate_Lm(), the inner loop runs over adjacent
+ * values and has no branches.
  */
 
 void
 Linearizer::update_Delta( const Population & N )
 {
     const unsigned n = offset_e_c_e_j(0, 0);			/* Hoist */
+    const std::vector<double> N_k = customers( N );
 
     for ( unsigned m = 1; m <= M; ++m ) {
 	const unsigned E = Q[m]->nEntries();
@@ -3076,13 +3419,16 @@ Linearizer::update_Delta( const Population & N )
 	    const unsigned Nej = offset_e_c_e_j(0, j);		/* Hoist */
 
 	    for ( unsigned e = 1; e <= E; ++e ) {
+		const double * const L_n = L[n][m][e];
+		const double * const L_ej = L[Nej][m][e];
+		double * const D_j = D[m][e][j];
+
 		for ( unsigned k = 1; k <= K; ++k ) {
-		    if ( N[k] > ( k == j ) ) {
-			D[m][e][k][j] = ( L[Nej][m][e][k] / (N[k] - ( k == j )) )
-			    -  ( L[n][m][e][k] / N[k] );
-		    } else {
-			D[m][e][k][j] = 0.0;
-		    }
+		    const double N_ej = N_k[k] - static_cast<double>( k == j );
+		    const bool ok = N_ej > 0.0;
+		    const double delta = ( (ok ? L_ej[k] : 0.0) / (ok ? N_ej : 1.0) )
+			-  ( (ok ? L_n[k] : 0.0) / (ok ? N_k[k] : 1.0) );
+		    D_j[k] = ok ? delta : 0.0;
 		}
 	    }
 	}
@@ -3107,7 +3453,7 @@ Linearizer::printD( std::ostream& output, const Population & N ) const
 	for ( unsigned e = 1; e <= E; ++e ) {
 	    for ( unsigned k = 1; k <= K; ++k ) {
 		for ( unsigned j = 1; j <= K; ++j ) {
-		    output << "D_{" << m << e << k << j << "}" << N << " = " << D[m][e][k][j] << "\t";
+		    output << "D_{" << m << e << k << j << "}" << N << " = " << D[m][e][j][k] << "\t";
 		}
 	    }
 	    output << std::endl;
@@ -3144,6 +3490,7 @@ OneStepLinearizer::solve()
 
     map.dimension( NCust );		/* Reset ALL associated arrays 	*/
     clearCount();
+    batchStations();
 
     c = 0;
 
@@ -3278,7 +3625,7 @@ Linearizer2::update_Delta( const Population & N )
 		    } else {
 			temp = 0.0;
 		    }
-		    D[m][e][k][j] = temp;
+		    D[m][e][j][k] = temp;
 		    D_k[m][e][j] += Q[m]->S(e,k) * N[k] * temp;		/* $$$ */
 		}
 	    }
@@ -3302,6 +3649,7 @@ void
 Linearizer2::estimate_L( const Population & N )
 {
     const unsigned n = offset_e_c_e_j(c, 0);			/* Hoist */
+    const std::vector<double> N_k = customers( N );
 
     for ( unsigned m = 1; m <= M; ++m ) {
 	const unsigned E = Q[m]->nEntries();
@@ -3310,10 +3658,9 @@ Linearizer2::estimate_L( const Population & N )
 	    if ( N[j] < 1 ) continue;
 	    const unsigned Nej = offset_e_c_e_j(c, j);		/* Hoist */
 	    Lm[Nej][m] = 0.0;
+	    estimate_Lm( m, N_k, n, j, Nej );			// Needed for U and termination tests...
 	}
 
-	estimate_Lm( m, N, n );				// Needed for U and termination tests...
-
 	for ( unsigned e = 1; e <= E; ++e ) {
 
 	    double sum = 0.0;
@@ -3329,7 +3676,7 @@ Linearizer2::estimate_L( const Population & N )
 		double temp = Q[m]->S(e,j) * ((L[n][m][e][j] / N[j]) + D[m][e][j][j]);
 
 		if ( c != 0 ) {
-		    temp += Q[m]->S(e,c) * D[m][e][c][j];		/* $9$ */
+		    temp += Q[m]->S(e,c) * D[m][e][j][c];		/* $9$ */
 		}
 
 
@@ -457,3 +457,124 @@ SinglePopulationMap::offset_e_j( const Population &N, const unsigned j ) const
     }
 }
 
+//Only support the current and the previous level of the full population.
+LevelPopulationMap::LevelPopulationMap( const Population & N ) 
+    : PopulationMap( N ), _total(0), _width(0), _count(), _rank(), _base()
+{
+    dimension( N );
+}
+
+
+LevelPopulationMap::~LevelPopulationMap()
+{
+}
+
+
+/*
+ * (Re)set the size of the arrays.  _count[k][n] is the number of
+ * populations of classes k through K with n customers.  Populations
+ * within a level are ranked in lexicographic order, so _rank[k][i][n]
+ * is the number of populations with n customers in classes k through
+ * K where class k has fewer than i customers.
+ */
+
+const PopulationMap&
+LevelPopulationMap::dimension( const Population& N )
+{
+    assert( N.size() == _dimN );
+
+    _maxN = N;
+    _total = N.sum();
+
+    const unsigned T = _total + 1;
+    _count.assign( (_dimN + 2) * T, 0 );
+    _count[(_dimN+1)*T] = 1;
+    for ( unsigned k = _dimN; k > 0; --k ) {
+	for ( unsigned n = 0; n <= _total; ++n ) {
+	    for ( unsigned i = 0; i <= std::min( N[k], n ); ++i ) {
+		_count[k*T+n] += count( k + 1, n - i );
+	    }
+	}
+    }
+
+    _base.assign( _dimN + 2, 0 );
+    for ( unsigned k = 1; k <= _dimN; ++k ) {
+	_base[k+1] = _base[k] + (N[k] + 1) * T;
+    }
+    _rank.assign( _base[_dimN+1], 0 );
+    for ( unsigned k = 1; k <= _dimN; ++k ) {
+	for ( unsigned n = 0; n <= _total; ++n ) {
+	    for ( unsigned i = 1; i <= std::min( N[k], n ); ++i ) {
+		_rank[_base[k]+i*T+n] = rank( k, i - 1, n ) + count( k + 1, n - (i - 1) );
+	    }
+	}
+    }
+
+    _width = 1;
+    for ( unsigned n = 0; n <= _total; ++n ) {
+	_width = std::max( _width, size( n ) );
+    }
+    _end = 2 * _width;
+    return *this;
+}
+
+
+
+unsigned 
+LevelPopulationMap::offset( const Population & N ) const
+{
+    assert( N.size() == _dimN );
+    const unsigned sum = N.sum();
+    size_t i = (sum & 1) * _width;
+    unsigned n = sum;
+    for ( unsigned k = 1; k <= _dimN; ++k ) {
+	assert( N[k] <= _maxN[k] );
+	i += rank( k, N[k], n );
+	n -= N[k];
+    }
+    return i;
+}
+
+
+
+unsigned 
+LevelPopulationMap::offset_e_j( const Population &N, const unsigned j ) const
+{
+    assert( N[j] > 0 );
+    const unsigned sum = N.sum() - 1;
+    size_t i = (sum & 1) * _width;
+    unsigned n = sum;
+    for ( unsigned k = 1; k <= _dimN; ++k ) {
+	const unsigned N_k = (k == j) ? N[k] - 1 : N[k];
+	i += rank( k, N_k, n );
+	n -= N_k;
+    }
+    return i;
+}
+
+
+
+/*
+ * Return all of the populations with n customers in rank order.
+ */
+
+void
+LevelPopulationMap::level( const unsigned n, std::vector<Population>& populations ) const
+{
+    const size_t size = this->size( n );
+    populations.assign( size, Population( _dimN ) );
+    for ( size_t r = 0; r < size; ++r ) {
+	Population& N = populations[r];
+	size_t i = r;
+	unsigned remaining = n;
+	for ( unsigned k = 1; k <= _dimN; ++k ) {
+	    unsigned N_k = 0;
+	    while ( i >= count( k + 1, remaining - N_k ) ) {
+		i -= count( k + 1, remaining - N_k );
+		N_k += 1;
+	    }
+	    N[k] = N_k;
+	    remaining -= N_k;
+	}
+    }
+}
@@ -37,6 +37,8 @@
  * ------------------------------------------------------------------------
  */
 
+#include <algorithm>
+#include <cassert>
 #include <cstdlib>
 #include <cmath>
 #include <limits>
@@ -61,6 +63,81 @@ operator<<( std::ostream& output, const Server& self )
     return self.print( output );
 }
 
+/* ------------------------- Waiting Times. -------------------------- */
+
+thread_local unsigned Server::Waits::__slot = 0;
+
+/*
+ * Allocate the storage for the calling thread (slot 0).
+ */
+
+void
+Server::Waits::dimension( const unsigned e, const unsigned k )
+{
+    assert( _slot.empty() );
+    E = e;
+    K = k;
+    allocate( _arena, _slot, 1 );
+}
+
+
+/*
+ * Set the number of slots to n.  The waiting times in slot 0 are
+ * copied to all of the other slots so that values which are not
+ * recomputed at each step (e.g., entries not visited by a chain) are
+ * the same for all threads.
+ */
+
+void
+Server::Waits::slots( const unsigned n )
+{
+    const unsigned size = std::max( n, 1U );
+    if ( size != _slot.size() ) {
+	Arena arena;
+	std::vector<double ***> slot;
+	allocate( arena, slot, size );
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    for ( unsigned k = 0; k <= K; ++k ) {
+		std::copy( &_slot[0][e][k][0], &_slot[0][e][k][MAX_PHASES+1], &slot[0][e][k][0] );
+	    }
+	}
+	_slot.swap( slot );
+	_arena.swap( arena );
+    }
+    for ( unsigned i = 1; i < _slot.size(); ++i ) {
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    for ( unsigned k = 0; k <= K; ++k ) {
+		std::copy( &_slot[0][e][k][0], &_slot[0][e][k][MAX_PHASES+1], &_slot[i][e][k][0] );
+	    }
+	}
+    }
+}
+
+
+/*
+ * Lay out n slots in arena.  Each slot starts on a cache line so
+ * that threads do not share lines.
+ */
+
+void
+Server::Waits::allocate( Arena& arena, std::vector<double ***>& slot, const unsigned n ) const
+{
+    const size_t values = E * (K + 1) * (MAX_PHASES + 1);
+    arena.reserve( n * Arena::round( values ), n * E * (K + 1), n * (E + 1) );
+    slot.resize( n );
+    for ( unsigned i = 0; i < n; ++i ) {
+	double * value = arena.values( values );
+	double *** W = arena.tables( E + 1 );
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    W[e] = arena.rows( K + 1 );
+	    for ( unsigned k = 0; k <= K; ++k, value += MAX_PHASES + 1 ) {
+		W[e][k] = value;
+	    }
+	}
+	slot[i] = W;
+    }
+}
+
 /* ----------------------- Abstract Superclass. ----------------------- */
 
 /*
@@ -80,44 +157,36 @@ Server::initialize()
 	throw std::out_of_range( "Server::initialize -- phases" );
     }
 
-    W = new double ** [E+1];
-    v = new double ** [E+1];
-    s = new double ** [E+1];
+    W.dimension( E, K );
+
+    /* s and v share one arena.  v[0] is used to cache totals */
+
+    const size_t v_size = (E + 1) * (K + 1) * (MAX_PHASES + 1);
+    const size_t s_size = E * (K + 1) * (P + 1);
+    _arena.reserve( Arena::round( v_size ) + Arena::round( s_size ), (2 * E + 1) * (K + 1), 2 * (E + 1) );
+    double * v_value = _arena.values( v_size );
+    double * s_value = _arena.values( s_size );
+    v = _arena.tables( E + 1 );
+    s = _arena.tables( E + 1 );
+    for ( e = 0; e <= E; ++e ) {
+	v[e] = _arena.rows( K + 1 );
+	for ( k = 0; k <= K; ++k, v_value += MAX_PHASES + 1 ) {
+	    v[e][k] = v_value;
+	}
+    }
+    for ( e = 1; e <= E; ++e ) {
+	s[e] = _arena.rows( K + 1 );
+	for ( k = 0; k <= K; ++k, s_value += P + 1 ) {
+	    s[e][k] = s_value;
+	}
+    }
 
     IL = new Probability * [E+1];
-
-    W[0] = 0;
-    s[0] = 0;
     IL[0] = 0;
     for ( e = 1; e <= E; ++e ) {
-	v[e] = new double * [K+1];
-	W[e] = new double * [K+1];
-	s[e] = new double * [K+1];
 	IL[e] = new Probability[K+1];
 	for ( k = 0; k <= K; ++k ) {
-	    v[e][k] = new double [MAX_PHASES+1];
-	    s[e][k] = new double [P+1];
-	    W[e][k] = new double [MAX_PHASES+1];
 	    IL[e][k] = 0;
-
-	    unsigned p;
-	    for ( p = 0; p <= P; ++p ) {
-		s[e][k][p] = 0.0;
-	    }
-	    for ( p = 0; p <= MAX_PHASES; ++p ) {
-		v[e][k][p] = 0.0;
-		W[e][k][p] = 0.0;
-	    }
-	}
-    }
-
-    /* v[0] is used to cache totals */
-
-    v[0] = new double * [K+1];
-    for ( k = 0; k <= K; ++k ) {
-	v[0][k] = new double [MAX_PHASES+1];
-	for ( unsigned p = 0; p <= MAX_PHASES; ++p ) {
-	    v[0][k][p] = 0.0;
 	}
     }
 }
@@ -130,23 +199,8 @@ Server::initialize()
 Server::~Server()
 {
     for ( unsigned e = 1; e <= E; ++e ) {
-	for ( unsigned k = 0; k <= K; ++k ) {
-	    delete [] W[e][k];
-	    delete [] v[e][k];
-	    delete [] s[e][k];
-	}
-	delete [] W[e];
-	delete [] v[e];
-	delete [] s[e];
 	delete [] IL[e];
     }
-    for ( unsigned k = 0; k <= K; ++k ) {
-	delete [] v[0][k];
-    }
-    delete [] v[0];
-    delete [] W;
-    delete [] v;
-    delete [] s;
     delete [] IL;
 }
 
@@ -879,8 +933,19 @@ PS_Server::wait( const MVA& solver, const unsigned k, const Population& N ) cons
 {
     assert( 0 < k && k <= K );
 	
-    const Positive sum = 1.0 + solver.sumOf_L_m( *this, N, k );
+    setWait( k, 1.0 + solver.sumOf_L_m( *this, N, k ) );
+}
+
+
+/*
+ * Set the waiting time for class k given the number of customers
+ * seen on arrival plus one.  MVA::step() calls this directly for
+ * batches of PS_Servers.
+ */
 
+void
+PS_Server::setWait( const unsigned k, const Positive sum ) const
+{
     for ( unsigned e = 1; e <= E; ++e ) {
 	if ( !V(e,k) ) continue;
 
@@ -996,8 +1061,18 @@ FCFS_Server::wait( const MVA& solver, const unsigned k, const Population& N ) co
 {
     assert( 0 < k && k <= K );
 
-    const Positive sum = solver.sumOf_SL_m( *this, N, k );
+    setWait( k, solver.sumOf_SL_m( *this, N, k ) );
+}
 
+
+/*
+ * Set the waiting time for class k given the work found on arrival.
+ * MVA::step() calls this directly for batches of FCFS_Servers.
+ */
+
+void
+FCFS_Server::setWait( const unsigned k, const Positive sum ) const
+{
     for ( unsigned e = 1; e <= E; ++e ) {
 	if ( !V(e,k) ) continue;
 
@@ -50,10 +50,10 @@ namespace LQIO {
     lqio_params_stats io_vars(VERSION,nullptr);
 
     namespace DOM {
-	Document* __document = nullptr;
+	thread_local Document* __document = nullptr;
 	bool Document::__debugXML = false;
 	bool Document::__debugJSON = false;
-	std::filesystem::path Document::__input_file_name = "";
+	thread_local std::filesystem::path Document::__input_file_name = "";
 	const char * Document::XConvergence = "conv_val";			/* Matches schema. 	*/
 	const char * Document::XIterationLimit = "it_limit";			/* Matched schema.	*/
 	const char * Document::XPrintInterval = "print_int";			/* Matches schema.	*/
@@ -29,7 +29,7 @@ namespace LQIO {
 	      _resultVarianceServiceTime(0.0), _resultVarianceServiceTimeVariance(0.0),
 	      _resultUtilization(0.0), _resultUtilizationVariance(0.0),
 	      _resultProcessorWaiting(0.0), _resultProcessorWaitingVariance(0.0),
-	      _hasResultServiceTimeVariance(false)
+	      _hasResultServiceTimeVariance(false), _resultServiceTimePercentiles()
 	{
 	}
 
@@ -42,7 +42,7 @@ namespace LQIO {
 	      _resultVarianceServiceTime(0.0), _resultVarianceServiceTimeVariance(0.0),
 	      _resultUtilization(0.0), _resultUtilizationVariance(0.0),
 	      _resultProcessorWaiting(0.0), _resultProcessorWaitingVariance(0.0),
-	      _hasResultServiceTimeVariance(false)
+	      _hasResultServiceTimeVariance(false), _resultServiceTimePercentiles()
 	{
 	}
 
@@ -58,7 +58,7 @@ namespace LQIO {
 	      _resultVarianceServiceTime(src._resultVarianceServiceTime), _resultVarianceServiceTimeVariance(0.0),
 	      _resultUtilization(src._resultUtilization), _resultUtilizationVariance(src._resultUtilizationVariance),
 	      _resultProcessorWaiting(src._resultProcessorWaiting), _resultProcessorWaitingVariance(src._resultProcessorWaitingVariance),
-	      _hasResultServiceTimeVariance(false)
+	      _hasResultServiceTimeVariance(false), _resultServiceTimePercentiles(src._resultServiceTimePercentiles)
 	{
 	}
 
@@ -355,6 +355,13 @@ namespace LQIO {
 	    return *this;
 	}
 
+	Phase& Phase::setResultServiceTimePercentile(const double percentile, const double value)
+	{
+	    /* Stores the service time at the given percentile (0-100) of the Phase */
+	    _resultServiceTimePercentiles[percentile] = value;
+	    return *this;
+	}
+
 	double Phase::getResultVarianceServiceTimeVariance() const
 	{
 	    /* Returns the given ResultVarianceServiceTime of the Phase */
@@ -179,14 +179,20 @@ namespace LQIO {
 	const char * Pragma::_abort_all_ =			"abort-all";		// Quorum
 	const char * Pragma::_abort_local_ =			"abort-local";		// Quorum
 	const char * Pragma::_abort_remote_ =			"abort-remote";		// Quorum
+	const char * Pragma::_acceleration_ =			"acceleration";
 	const char * Pragma::_advisory_ =			"advisory";
 	const char * Pragma::_all_ =				"all";
+	const char * Pragma::_anderson_ =			"anderson";
+	const char * Pragma::_antithetic_ =			"antithetic";		// lqsim
 	const char * Pragma::_batched_ =			"batched";
 	const char * Pragma::_batched_back_ =			"batched-back";
+	const char * Pragma::_batched_parallel_ =		"batched-parallel";
 	const char * Pragma::_bcmp_ =				"bcmp";			// BUG 270
 	const char * Pragma::_block_period_ =			"block-period";
 	const char * Pragma::_bounds_ =				"bounds";
 	const char * Pragma::_bruell_ =				"bruell";		// multiserver
+	const char * Pragma::_calendar_ =			"calendar";		// lqsim
+	const char * Pragma::_common_random_numbers_ =		"common-random-numbers";	// lqsim
 	const char * Pragma::_convergence_value_ =		"convergence-value";
 	const char * Pragma::_conway_ =				"conway";		// multiserver
 	const char * Pragma::_custom_ =				"custom";		// multiserver
@@ -211,6 +217,7 @@ namespace LQIO {
 	const char * Pragma::_force_random_queueing_ =		"force-random-queueing";
 	const char * Pragma::_gamma_ =				"gamma";		// Quorum
 	const char * Pragma::_geometric_ =			"geometric";		// Quorum
+	const char * Pragma::_heap_ =				"heap";
 	const char * Pragma::_hvfcfs_ = 			"hvfcfs";		// hvfcfs BUG_471
 	const char * Pragma::_hwsw_ =				"hwsw";
 	const char * Pragma::_hyper_ =				"hyper";
@@ -223,6 +230,7 @@ namespace LQIO {
 	const char * Pragma::_keep_all_ =			"keep-all";		// Quorum
 	const char * Pragma::_layering_ =			"layering";
 	const char * Pragma::_linearizer_ =			"linearizer";
+	const char * Pragma::_list_ =				"list";
 	const char * Pragma::_lqn_ =				"lqn";			// BUG 270
 	const char * Pragma::_mak_ =				"mak";
 	const char * Pragma::_markov_ =				"markov";
@@ -253,8 +261,10 @@ namespace LQIO {
 	const char * Pragma::_quorum_reply_ =			"quorum-reply";		// Quorum
 	const char * Pragma::_reiser_ =				"reiser";		// multiserver, hvfcfs BUG_471
 	const char * Pragma::_reiser_ps_ =			"reiser-ps";		// multiserver
+	const char * Pragma::_replicas_ =			"replicas";		// lqsim
 	const char * Pragma::_replication_ =			"replication";
 	const char * Pragma::_reschedule_on_async_send_ =	"reschedule-on-async-send";
+	const char * Pragma::_reuse_tolerance_ =		"reuse-tolerance";
 	const char * Pragma::_rolia_ =				"rolia";		// multiserver
 	const char * Pragma::_rolia_ps_ =			"rolia-ps";		// multiserver
 	const char * Pragma::_run_time_ =			"run-time";
@@ -263,9 +273,11 @@ namespace LQIO {
 	const char * Pragma::_schmidt_ =			"schmidt";		// multiserver
 	const char * Pragma::_schweitzer_ =			"schweitzer";
 	const char * Pragma::_seed_value_ =			"seed-value";
+	const char * Pragma::_sequential_ =			"sequential";		// lqsim
 	const char * Pragma::_severity_level_ =			"severity-level";
 	const char * Pragma::_share_ =				"share";
 	const char * Pragma::_srvn_ =				"srvn";
+	const char * Pragma::_srvn_parallel_ =			"srvn-parallel";
         const char * Pragma::_simple_ =                         "simple";
         const char * Pragma::_special_ =                        "special";
         const char * Pragma::_spex_comment_ =                   "spex-comment";
@@ -273,6 +285,7 @@ namespace LQIO {
         const char * Pragma::_spex_header_ =                    "spex-header";
         const char * Pragma::_spex_iteration_limit_ =           "spex-iteration-limit";
         const char * Pragma::_spex_underrelaxation_ =           "spex-underrelaxation";
+        const char * Pragma::_spex_workers_ =                   "spex-workers";
         const char * Pragma::_squashed_ =                       "squashed";
 	const char * Pragma::_stochastic_ =			"stochastic";
 	const char * Pragma::_stop_on_bogus_utilization_ =	"stop-on-bogus-utilization";
@@ -286,6 +299,7 @@ namespace LQIO {
 	const char * Pragma::_true_ =				"true";
 	const char * Pragma::_underrelaxation_ =		"underrelaxation";
 	const char * Pragma::_variance_ =			"variance";
+	const char * Pragma::_warm_start_ =			"warm-start";
 	const char * Pragma::_warning_ =			"warning";
 	const char * Pragma::_yes_ =				"yes";
 	const char * Pragma::_zhou_ =				"zhou";			// multiserver 
@@ -293,9 +307,11 @@ namespace LQIO {
 	/* Args */
 	
 	const std::set<std::string> Pragma::__bcmp_args = { _lqn_, _extended_, _true_, _yes_, _false_, _no_, "t", "y", "f", "n", "" };
+	const std::set<std::string> Pragma::__acceleration_args = { _none_, _anderson_ };
+	const std::set<std::string> Pragma::__calendar_args = { _heap_, _list_ };
 	const std::set<std::string> Pragma::__force_infinite_args = { _none_, _fixed_rate_, _multiservers_, _all_, "" };
 	const std::set<std::string> Pragma::__force_multiserver_args = { _none_, _processors_, _tasks_, _all_, "" };
-	const std::set<std::string> Pragma::__layering_args = { _batched_, _batched_back_, _mol_, _mol_back_, _processor_, _share_, _squashed_, _srvn_, _hwsw_ };
+	const std::set<std::string> Pragma::__layering_args = { _batched_, _batched_back_, _batched_parallel_, _mol_, _mol_back_, _processor_, _share_, _squashed_, _srvn_, _srvn_parallel_, _hwsw_ };
 	const std::set<std::string> Pragma::__hvfcfs_args = { _eager_, _reiser_ };	/* BUG_471 */
 	const std::set<std::string> Pragma::__multiserver_args = { _bruell_, _conway_, _default_, _experimental_, _reiser_, _reiser_ps_, _rolia_, _rolia_ps_, _schmidt_, _suri_, _zhou_ };
 	const std::set<std::string> Pragma::__mva_args = { _bounds_, _exact_, _linearizer_, _schweitzer_, _fast_, _one_step_, _one_step_linearizer_ };
@@ -315,8 +331,12 @@ namespace LQIO {
 	/* Pragmas */
 	
 	const std::map<const std::string,const std::set<std::string>*> Pragma::__pragmas = {
+	    { _acceleration_,		    &__acceleration_args },	    /* lqns */
+	    { _antithetic_,		    &__true_false_arg },	    /* lqsim */
 	    { _bcmp_,			    &__true_false_arg },	    /* lqns */
 	    { _block_period_,      	    nullptr },			    /* lqsim */
+	    { _calendar_,		    &__calendar_args },		    /* lqsim */
+	    { _common_random_numbers_,	    &__true_false_arg },	    /* lqsim */
 	    { _convergence_value_,	    nullptr },			    /* lqns */
 	    { _cycles_,  	    	    &__true_false_arg },	    /* lqns */
 	    { _default_output_,		    &__true_false_arg },	    /* all */
@@ -345,24 +365,29 @@ namespace LQIO {
 	    { _quorum_idle_time_,  	    &__quorum_idle_time_args },     /* lqns */
 	    { _quorum_reply_, 		    &__true_false_arg },	    /* lqsim */
 	    { _reschedule_on_async_send_,   &__true_false_arg },
+	    { _replicas_,		    nullptr },			    /* lqsim */
 	    { _replication_,		    &__replication_args },	    /* lqns */
+	    { _reuse_tolerance_,	    nullptr },			    /* lqns */
 	    { _run_time_,  	    	    nullptr },			    /* lqsim */
 	    { _save_marginal_probabilities_,&__true_false_arg },
 	    { _scheduling_model_,  	    &__scheduling_model_args },
 	    { _seed_value_,  	    	    nullptr },			    /* lqsim */
+	    { _sequential_,		    &__true_false_arg },	    /* lqsim */
 	    { _severity_level_,  	    &__warning_args },
 	    { _spex_comment_,		    &__true_false_arg },
 	    { _spex_convergence_,	    nullptr },			    /* BUG 422 */
 	    { _spex_header_,  		    &__true_false_arg },
 	    { _spex_iteration_limit_,	    nullptr },			    /* BUG 422 */
 	    { _spex_underrelaxation_,	    nullptr },			    /* BUG 422 */
+	    { _spex_workers_,		    nullptr },
 	    { _stop_on_bogus_utilization_,  nullptr },			    /* lqns */
 	    { _stop_on_message_loss_,  	    &__true_false_arg },
 	    { _task_scheduling_,  	    &__task_args },
 	    { _tau_,               	    nullptr },			    /* lqns */
 	    { _threads_,  		    &__threads_args },		    /* lqns */
 	    { _underrelaxation_,	    nullptr },			    /* lqns */
-	    { _variance_,  		    &__variance_args }		    /* lqns */
+	    { _variance_,  		    &__variance_args },		    /* lqns */
+	    { _warm_start_,  		    &__true_false_arg }		    /* lqns */
 	};
 	
     }
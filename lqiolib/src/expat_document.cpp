@@ -2022,6 +2022,12 @@ namespace LQIO {
 		    if ( func && _loadResults && value > 0. ) {
                         (object->*func)( value );
                     }
+		} else if ( strncmp( *attributes, Xservice_time_p, strlen( Xservice_time_p ) ) == 0 && dynamic_cast<Phase *>(object) != nullptr ) {
+		    const double percentile = XML::get_double( *attributes, *attributes + strlen( Xservice_time_p ) );
+		    const double value = XML::get_double( *attributes, *(attributes+1) );
+		    if ( _loadResults ) {
+			dynamic_cast<Phase *>(object)->setResultServiceTimePercentile( percentile, value );
+		    }
                 } else {
 		    throw XML::unexpected_attribute( *attributes );
                 }
@@ -3008,6 +3014,11 @@ namespace LQIO {
 		    if ( has_variance ) {
 			output << XML::attribute( Xservice_time_variance, phase.getResultVarianceServiceTime() );	// optional attribute.
 		    }
+		    for ( std::map<double,double>::const_iterator percentile = phase.getResultServiceTimePercentiles().begin(); percentile != phase.getResultServiceTimePercentiles().end(); ++percentile ) {
+			std::ostringstream name;
+			name << Xservice_time_p << percentile->first;
+			output << XML::attribute( name.str(), percentile->second );	// optional attribute (lqsim).
+		    }
 		    if ( dynamic_cast<const Activity *>(&phase) ) {
 			output << XML::attribute( Xthroughput, phase.getResultThroughput() )
 			       << XML::attribute( Xproc_utilization, phase.getResultProcessorUtilization() );
@@ -3532,6 +3543,7 @@ namespace LQIO {
         const XML_Char * Expat_Document::Xservice =                             "service";
         const XML_Char * Expat_Document::Xservice_time =                        "service-time";
         const XML_Char * Expat_Document::Xservice_time_distribution =           "service-time-distribution";
+        const XML_Char * Expat_Document::Xservice_time_p =                      "service-time-p";
         const XML_Char * Expat_Document::Xservice_time_variance =               "service-time-variance";
         const XML_Char * Expat_Document::Xshare =                               "share";
         const XML_Char * Expat_Document::Xsignal =                              "signal";
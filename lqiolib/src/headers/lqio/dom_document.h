@@ -233,7 +233,7 @@ namespace LQIO {
 	    static void db_check_set_entry(DOM::Entry* entry, DOM::Entry::Type requisiteType = DOM::Entry::Type::NOT_DEFINED );
 	    ExternalVariable* db_build_parameter_variable(const std::string& input, bool* isSymbol);
 	    static void lqx_parser_trace( FILE * );
-	    static std::filesystem::path __input_file_name;
+	    static thread_local std::filesystem::path __input_file_name;	/* Per thread, as is __document. */
 
 	    static bool __debugXML;
 	    static bool __debugJSON;
@@ -314,7 +314,7 @@ namespace LQIO {
 	    static const std::map<const LQIO::DOM::Document::InputFormat,const LQIO::DOM::Document::OutputFormat> __input_to_output_format;
 	};
 
-	extern Document* __document;
+	extern thread_local Document* __document;	/* Document loaded or solved by this thread. */
     }
 }
 #endif /* __LQIO_DOM_DOCUMENT__ */
@@ -12,6 +12,7 @@
 #include "input.h"
 #include "dom_object.h"
 
+#include <map>
 #include <vector>
 #include <string>
 
@@ -103,6 +104,9 @@ namespace LQIO {
 	    Phase& setResultVarianceServiceTime(const double resultVarianceServiceTime);
 	    bool hasResultServiceTimeVariance() const { return _hasResultServiceTimeVariance; }
 	    double getResultVarianceServiceTimeVariance() const;
+	    const std::map<double,double>& getResultServiceTimePercentiles() const { return _resultServiceTimePercentiles; }
+	    Phase& setResultServiceTimePercentile(const double percentile, const double value);
+	    bool hasResultServiceTimePercentiles() const { return !_resultServiceTimePercentiles.empty(); }
 	    Phase& setResultVarianceServiceTimeVariance(const double resultVarianceServiceTimeVariance);
 	    double getResultUtilization() const;
 	    Phase& setResultUtilization(const double resultUtilization);
@@ -137,6 +141,7 @@ namespace LQIO {
 	    double _resultProcessorWaiting;
 	    double _resultProcessorWaitingVariance;
 	    bool _hasResultServiceTimeVariance;
+	    std::map<double,double> _resultServiceTimePercentiles;	/* percentile -> service time (lqsim) */
       
 	public:
 	    static const char * __typeName;
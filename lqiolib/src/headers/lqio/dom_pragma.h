@@ -53,7 +53,9 @@ namespace LQIO {
 	    std::map<std::string,std::string> _loadedPragmas;
 
 	    const static std::map<const std::string,const std::set<std::string>*> __pragmas;
+	    const static std::set<std::string> __acceleration_args;
 	    const static std::set<std::string> __bcmp_args;
+	    const static std::set<std::string> __calendar_args;
 	    const static std::set<std::string> __force_infinite_args;
 	    const static std::set<std::string> __force_multiserver_args;
 	    const static std::set<std::string> __layering_args;
@@ -77,14 +79,20 @@ namespace LQIO {
 	    static const char * _abort_all_;		// Quorum
 	    static const char * _abort_local_;		// Quorum
 	    static const char * _abort_remote_;		// Quorum
+	    static const char * _acceleration_;
 	    static const char * _advisory_;
 	    static const char * _all_;
+	    static const char * _anderson_;
+	    static const char * _antithetic_;		// lqsim
 	    static const char * _batched_;
 	    static const char * _batched_back_;
+	    static const char * _batched_parallel_;
 	    static const char * _bcmp_;			// BUG 270
 	    static const char * _block_period_;
 	    static const char * _bounds_;
 	    static const char * _bruell_;		// multiserver
+	    static const char * _calendar_;		// lqsim
+	    static const char * _common_random_numbers_;	// lqsim
 	    static const char * _convergence_value_;
 	    static const char * _conway_;		// multiserver
 	    static const char * _custom_;
@@ -109,6 +117,7 @@ namespace LQIO {
 	    static const char * _force_random_queueing_;// Petrisrvn
 	    static const char * _gamma_;		// Quorum
 	    static const char * _geometric_;		// Quorum
+	    static const char * _heap_;
 	    static const char * _hvfcfs_;		// hvfcfs BUG_471
 	    static const char * _hwsw_;
 	    static const char * _hyper_;
@@ -121,6 +130,7 @@ namespace LQIO {
 	    static const char * _keep_all_;		// Quorum
 	    static const char * _layering_;
 	    static const char * _linearizer_;
+	    static const char * _list_;
 	    static const char * _lqn_;			// BUG 270
 	    static const char * _mak_;
 	    static const char * _markov_;
@@ -151,8 +161,10 @@ namespace LQIO {
 	    static const char * _quorum_reply_;		// Quroum
 	    static const char * _reiser_;		// multiserver
 	    static const char * _reiser_ps_;		// multiserver
+	    static const char * _replicas_;		// lqsim
 	    static const char * _replication_;
 	    static const char * _reschedule_on_async_send_;
+	    static const char * _reuse_tolerance_;
 	    static const char * _rolia_;		// multiserver
 	    static const char * _rolia_ps_;		// multiserver
 	    static const char * _run_time_;
@@ -161,6 +173,7 @@ namespace LQIO {
 	    static const char * _schmidt_;		// multiserver
 	    static const char * _schweitzer_;
 	    static const char * _seed_value_;
+	    static const char * _sequential_;		// lqsim
 	    static const char * _severity_level_;
 	    static const char * _share_;
 	    static const char * _simple_;
@@ -170,8 +183,10 @@ namespace LQIO {
 	    static const char * _spex_header_;
 	    static const char * _spex_iteration_limit_;
 	    static const char * _spex_underrelaxation_;
+	    static const char * _spex_workers_;
 	    static const char * _squashed_;
 	    static const char * _srvn_;
+	    static const char * _srvn_parallel_;
 	    static const char * _stochastic_;
 	    static const char * _stop_on_bogus_utilization_;
 	    static const char * _stop_on_message_loss_;
@@ -184,6 +199,7 @@ namespace LQIO {
 	    static const char * _true_;
 	    static const char * _underrelaxation_;
 	    static const char * _variance_;
+	    static const char * _warm_start_;
 	    static const char * _warning_;
 	    static const char * _yes_;
 	    static const char * _zhou_;			// Multiserver
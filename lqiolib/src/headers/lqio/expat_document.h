@@ -477,6 +477,7 @@ namespace LQIO {
 	    static const XML_Char *Xsemaphore_waiting_variance;
 	    static const XML_Char *Xservice;
 	    static const XML_Char *Xservice_time;
+	    static const XML_Char *Xservice_time_p;
 	    static const XML_Char *Xservice_time_distribution;
 	    static const XML_Char *Xservice_time_variance;
 	    static const XML_Char *Xshare;
@@ -746,7 +746,7 @@ namespace LQIO {
 
 	    private:
 		mutable unsigned int _count;
-		static int __indent;
+		static thread_local int __indent;
 	    };
 
 	    class Model : public Export {
@@ -1073,6 +1073,7 @@ namespace LQIO {
 	    static const char * Xsemaphore_waiting;
 	    static const char * Xsemaphore_waiting_variance;
 	    static const char * Xservice_time;
+	    static const char * Xservice_time_p;
 	    static const char * Xservice_time_variance;
 	    static const char * Xservice_type;
 	    static const char * Xshare;
@@ -476,12 +476,13 @@ namespace LQIO {
 	protected:
 	    std::ostream& _output;
 
-	    static unsigned int __maxPhase;
-	    static ConfidenceIntervals * __conf95;
-	    static ConfidenceIntervals * __conf99;
-	    static bool __parseable;
-	    static bool __rtf;
-	    static bool __coloured;
+	    /* Set by Output for the document that this thread is printing */
+	    static thread_local unsigned int __maxPhase;
+	    static thread_local ConfidenceIntervals * __conf95;
+	    static thread_local ConfidenceIntervals * __conf99;
+	    static thread_local bool __parseable;
+	    static thread_local bool __rtf;
+	    static thread_local bool __coloured;
 	};
 
 
@@ -507,8 +508,8 @@ namespace LQIO {
 	protected:
 	    std::ostream& _output;
 
-	    static unsigned int __maxInpLen;			/* for lqn2lqn formatting */
-	    static unsigned int __maxEntLen;			/* Entry name */
+	    static thread_local unsigned int __maxInpLen;	/* for lqn2lqn formatting */
+	    static thread_local unsigned int __maxEntLen;	/* Entry name */
 	};
 
 	/* ------------------------------------------------------------------------ */
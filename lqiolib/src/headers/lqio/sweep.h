@@ -0,0 +1,66 @@
+/* -*- c++ -*- */
+/************************************************************************/
+/* Copyright the Real-Time and Distributed Systems Group,		*/
+/* Department of Systems and Computer Engineering,			*/
+/* Carleton University, Ottawa, Ontario, Canada. K1S 5B6		*/
+/* 									*/
+/* October 2026.							*/
+/************************************************************************/
+
+/*
+ * Run the points of a parameter sweep on several worker processes.
+ *
+ * Every worker is a copy of the solver (forked after the model and
+ * the LQX program are loaded) which runs the whole program, but only
+ * solves every n'th call to solve().  The output that the program
+ * prints after each call to solve() is kept by the worker which
+ * solved the point, so the output of the workers is merged in the
+ * same order as a serial run.  This only works if the program's
+ * control flow does not depend on the results, which is the case for
+ * the loops generated by SPEX and JMVA what-if, but not for SPEX
+ * convergence or for LQX in general.
+ */
+
+#ifndef __LQIO_SWEEP_H__
+#define __LQIO_SWEEP_H__
+
+#include <cstdio>
+#include <vector>
+
+namespace LQX {
+    class Program;
+}
+
+namespace LQIO {
+    class Sweep {
+    public:
+	Sweep( LQX::Program * program, unsigned int workers ) : _program(program), _workers(workers) {}
+
+	unsigned int workers() const { return _workers; }
+	bool operator()( FILE * output ) const;
+
+	static bool independent();		/* SPEX points can be solved in any order */
+	static bool solving();			/* Called by solve(); false if another worker has the point */
+	static void failed() { __failed = true; }
+	static bool worker() { return __workers > 0; }	/* True in a worker; it solves every n'th point */
+
+    private:
+	Sweep( const Sweep& ) = delete;
+	Sweep& operator=( const Sweep& ) = delete;
+
+	[[noreturn]] void work( unsigned int worker, FILE * result, FILE * index, unsigned int errors ) const;
+	bool merge( FILE * output, const std::vector<FILE *>& results, const std::vector<FILE *>& indices ) const;
+	static bool copy( FILE * output, FILE * input, long begin, long end );
+
+    private:
+	LQX::Program * _program;
+	const unsigned int _workers;
+
+	static unsigned int __worker;		/* This worker.				*/
+	static unsigned int __workers;		/* Zero if not running a sweep.		*/
+	static FILE * __result;			/* Output of the program.		*/
+	static std::vector<long> __offsets;	/* Output offset at each solve().	*/
+	static bool __failed;			/* A point solved here failed.		*/
+    };
+}
+#endif /* __LQIO_SWEEP_H__ */
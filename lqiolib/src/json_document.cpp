@@ -23,6 +23,7 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cstdarg>
+#include <cstring>
 #include <vector>
 #include <cassert>
 #include <cmath>
@@ -68,7 +69,7 @@ extern "C" {
 namespace LQIO {
     namespace DOM {
 	int JSON_Document::Import::__indent = 0;
-	int JSON_Document::Export::__indent = -1;		/* suppress initial newline */
+	thread_local int JSON_Document::Export::__indent = -1;		/* suppress initial newline */
 
 	/* ---------------------------------------------------------------- */
 	/* Function objects for for_each.				    */
@@ -1492,6 +1493,9 @@ namespace LQIO {
 		    const std::map<const char *,const ImportResult>::const_iterator j = result_table.find(attr.c_str());
 		    if ( j != result_table.end() ) {
 			j->second(attr,*this,*parent,i->second);		/* Handle attribute */
+		    } else if ( attr.compare( 0, strlen( Xservice_time_p ), Xservice_time_p ) == 0 && dynamic_cast<Phase *>(parent) != nullptr && i->second.is<double>() ) {
+			const double percentile = XML::get_double( attr.c_str(), attr.c_str() + strlen( Xservice_time_p ) );
+			dynamic_cast<Phase *>(parent)->setResultServiceTimePercentile( percentile, i->second.get<double>() );
 		    } else {
 			LQIO::runtime_error( LQIO::ERR_UNEXPECTED_ATTRIBUTE, Xresults, attr.c_str() );
 		    }
@@ -3586,6 +3590,11 @@ namespace LQIO {
 		if ( phase.getResultVarianceServiceTime() ) {
 		    _output << next_attribute( Xservice_time_variance, phase.getResultVarianceServiceTime(), _conf_95, phase.getResultVarianceServiceTimeVariance() );	// optional attribute.
 		}
+		for ( std::map<double,double>::const_iterator percentile = phase.getResultServiceTimePercentiles().begin(); percentile != phase.getResultServiceTimePercentiles().end(); ++percentile ) {
+		    std::ostringstream name;
+		    name << Xservice_time_p << percentile->first;
+		    _output << next_attribute( name.str(), percentile->second );	// optional attribute (lqsim).
+		}
 		if ( phase.hasMaxServiceTimeExceeded() ) {
 		    _output << next_attribute( Xprob_exceed_max, phase.getResultMaxServiceTimeExceeded(), _conf_95, phase.getResultMaxServiceTimeExceededVariance() );
 		}
@@ -4140,6 +4149,7 @@ namespace LQIO {
 	const char * JSON_Document::Xsemaphore_waiting			= "semaphore-waiting-variance";
 	const char * JSON_Document::Xsemaphore_waiting_variance		= "semaphore-utilization";
 	const char * JSON_Document::Xservice_time			= "service-time";
+	const char * JSON_Document::Xservice_time_p			= "service-time-p";
 	const char * JSON_Document::Xservice_time_variance		= "service-time-variance";
 	const char * JSON_Document::Xservice_type			= "service-time";
 	const char * JSON_Document::Xshare				= "share";
@@ -36,14 +36,14 @@
 #include "srvn_spex.h"
 
 namespace LQIO {
-    unsigned int SRVN::ObjectOutput::__maxPhase = 0;
-    ConfidenceIntervals * SRVN::ObjectOutput::__conf95 = 0;
-    ConfidenceIntervals * SRVN::ObjectOutput::__conf99 = 0;
-    bool SRVN::ObjectOutput::__parseable = false;
-    bool SRVN::ObjectOutput::__rtf = false;
-    bool SRVN::ObjectOutput::__coloured = false;
-    unsigned int SRVN::ObjectInput::__maxEntLen = 1;
-    unsigned int SRVN::ObjectInput::__maxInpLen = 1;
+    thread_local unsigned int SRVN::ObjectOutput::__maxPhase = 0;
+    thread_local ConfidenceIntervals * SRVN::ObjectOutput::__conf95 = 0;
+    thread_local ConfidenceIntervals * SRVN::ObjectOutput::__conf99 = 0;
+    thread_local bool SRVN::ObjectOutput::__parseable = false;
+    thread_local bool SRVN::ObjectOutput::__rtf = false;
+    thread_local bool SRVN::ObjectOutput::__coloured = false;
+    thread_local unsigned int SRVN::ObjectInput::__maxEntLen = 1;
+    thread_local unsigned int SRVN::ObjectInput::__maxInpLen = 1;
 
     static inline void throw_bad_parameter() { throw std::domain_error( "invalid parameter" ); }
 
@@ -0,0 +1,212 @@
+/*  -*- c++ -*-
+ * Run the points of a parameter sweep on several worker processes.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <algorithm>
+#include <cstdio>
+#if HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <lqx/Environment.h>
+#include <lqx/Program.h>
+#include "dom_document.h"
+#include "srvn_spex.h"
+#include "sweep.h"
+
+namespace LQIO {
+
+    unsigned int Sweep::__worker = 0;
+    unsigned int Sweep::__workers = 0;
+    FILE * Sweep::__result = nullptr;
+    std::vector<long> Sweep::__offsets;
+    bool Sweep::__failed = false;
+
+    /*
+     * True if the program was generated by SPEX and loops over array
+     * variables.  Convergence loops feed the results back into the
+     * next point, so they have to run serially.
+     */
+
+    bool
+    Sweep::independent()
+    {
+	return Spex::has_vars() && !Spex::array_variables().empty() && Spex::convergence_variables().empty();
+    }
+
+
+    /*
+     * Run the program on the workers and copy the merged output to
+     * output.  Return false if nothing was written, in which case the
+     * caller runs the program itself.  That happens if there are not
+     * enough workers, if processes can't be created, or if any point
+     * fails (the serial program stops the loop at a failure, which
+     * the workers can't reproduce).
+     */
+
+    bool
+    Sweep::operator()( FILE * output ) const
+    {
+#if HAVE_SYS_WAIT_H && HAVE_UNISTD_H
+	if ( _workers < 2 || __workers > 0 ) return false;
+
+	const unsigned int errors = io_vars.error_count;
+	std::vector<FILE *> results;
+	std::vector<FILE *> indices;
+	std::vector<pid_t> pids;
+	bool ok = true;
+
+	fflush( nullptr );		/* Otherwise the workers write out anything buffered. */
+	for ( unsigned int worker = 0; worker < _workers; ++worker ) {
+	    FILE * result = tmpfile();
+	    FILE * index = tmpfile();
+	    if ( result != nullptr ) results.push_back( result );
+	    if ( index != nullptr ) indices.push_back( index );
+	    if ( result == nullptr || index == nullptr ) {
+		ok = false;
+		break;
+	    }
+	    const pid_t pid = fork();
+	    if ( pid == 0 ) {
+		work( worker, result, index, errors );
+	    } else if ( pid < 0 ) {
+		ok = false;
+		break;
+	    }
+	    pids.push_back( pid );
+	}
+
+	for ( std::vector<pid_t>::const_iterator pid = pids.begin(); pid != pids.end(); ++pid ) {
+	    int status = 0;
+	    if ( waitpid( *pid, &status, 0 ) != *pid || !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) {
+		ok = false;
+	    }
+	}
+
+	if ( ok ) {
+	    ok = merge( output, results, indices );
+	}
+
+	std::for_each( results.begin(), results.end(), &fclose );
+	std::for_each( indices.begin(), indices.end(), &fclose );
+	return ok;
+#else
+	return false;
+#endif
+    }
+
+
+    /*
+     * Called by solve() for every point.  Record where the output of
+     * the previous point ends and return true if this worker solves
+     * the point.  Outside of a sweep, every point is solved.
+     */
+
+    bool
+    Sweep::solving()
+    {
+	if ( __workers == 0 ) return true;
+
+	fflush( __result );
+	__offsets.push_back( ftell( __result ) );
+	return (__offsets.size() - 1) % __workers == __worker;
+    }
+
+
+    /*
+     * The worker process.  Run the program with its output going to
+     * result, then save the offsets of each point in index.  The exit
+     * status tells the parent whether the points solved here worked.
+     */
+
+    void
+    Sweep::work( unsigned int worker, FILE * result, FILE * index, unsigned int errors ) const
+    {
+	__worker = worker;
+	__workers = _workers;
+	__result = result;
+
+	_program->getEnvironment()->setDefaultOutput( result );
+	bool ok = false;
+	try {
+	    ok = _program->invoke();
+	}
+	catch ( ... ) {
+	}
+
+	fflush( result );
+	fprintf( index, "%lu\n", static_cast<unsigned long>(__offsets.size()) );
+	for ( std::vector<long>::const_iterator offset = __offsets.begin(); offset != __offsets.end(); ++offset ) {
+	    fprintf( index, "%ld\n", *offset );
+	}
+	fflush( nullptr );
+	_exit( ok && !__failed && io_vars.error_count == errors ? 0 : 1 );
+    }
+
+
+    /*
+     * Output before the first point comes from the first worker.  The
+     * output for point i (from its call to solve() to the next) comes
+     * from the worker that solved it.  Every worker must have seen
+     * the same points.
+     */
+
+    bool
+    Sweep::merge( FILE * output, const std::vector<FILE *>& results, const std::vector<FILE *>& indices ) const
+    {
+	std::vector<std::vector<long>> offsets( _workers );
+	unsigned long points = 0;
+	for ( unsigned int worker = 0; worker < _workers; ++worker ) {
+	    FILE * index = indices.at(worker);
+	    unsigned long n = 0;
+	    rewind( index );
+	    if ( fscanf( index, "%lu", &n ) != 1 || n == 0 ) return false;
+	    if ( worker == 0 ) {
+		points = n;
+	    } else if ( n != points ) {
+		return false;
+	    }
+	    offsets[worker].resize( n );
+	    for ( unsigned long i = 0; i < n; ++i ) {
+		if ( fscanf( index, "%ld", &offsets[worker][i] ) != 1 ) return false;
+	    }
+	    fseek( results.at(worker), 0, SEEK_END );
+	    offsets[worker].push_back( ftell( results.at(worker) ) );	/* End of the last point */
+	}
+
+	if ( !copy( output, results[0], 0, offsets[0][0] ) ) return false;
+	for ( unsigned long i = 0; i < points; ++i ) {
+	    const unsigned int worker = i % _workers;
+	    if ( !copy( output, results[worker], offsets[worker][i], offsets[worker][i+1] ) ) return false;
+	}
+	fflush( output );
+	return true;
+    }
+
+
+    bool
+    Sweep::copy( FILE * output, FILE * input, long begin, long end )
+    {
+	char buffer[BUFSIZ];
+	if ( fseek( input, begin, SEEK_SET ) != 0 ) return false;
+	while ( begin < end ) {
+	    const size_t n = fread( buffer, 1, std::min( static_cast<long>(sizeof( buffer )), end - begin ), input );
+	    if ( n == 0 || fwrite( buffer, 1, n, output ) != n ) return false;
+	    begin += n;
+	}
+	return true;
+    }
+}
@@ -23,7 +23,7 @@
 #include "common_io.h"
 
 namespace XML {
-    static int current_indent = 0;
+    static thread_local int current_indent = 0;	/* Per thread, as the document is. */
 
     int set_indent( int indent )
     {
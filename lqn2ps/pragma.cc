@@ -155,12 +155,14 @@ void Pragma::setLayering(const std::string& value)
     static const std::map<const std::string,const Layering> __layering_pragma = {
 	{ LQIO::DOM::Pragma::_batched_,		Layering::BATCH },
 	{ LQIO::DOM::Pragma::_batched_back_,	Layering::BATCH },
+	{ LQIO::DOM::Pragma::_batched_parallel_,Layering::BATCH },
 	{ LQIO::DOM::Pragma::_hwsw_,		Layering::HWSW },
 	{ LQIO::DOM::Pragma::_mol_,		Layering::MOL },
 	{ LQIO::DOM::Pragma::_mol_back_,	Layering::MOL },
 	{ LQIO::DOM::Pragma::_processor_,	Layering::PROCESSOR },
 	{ LQIO::DOM::Pragma::_squashed_,	Layering::SQUASHED },
-	{ LQIO::DOM::Pragma::_srvn_,		Layering::SRVN }
+	{ LQIO::DOM::Pragma::_srvn_,		Layering::SRVN },
+	{ LQIO::DOM::Pragma::_srvn_parallel_,	Layering::SRVN }
     };
 
     const std::map<const std::string,const Layering>::const_iterator pragma = __layering_pragma.find( value );
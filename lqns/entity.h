@@ -108,6 +108,7 @@ public:
     unsigned submodel() const { return _submodel; }
     virtual void setSubmodel( const unsigned submodel ) { _submodel = submodel; }
     virtual double thinkTime( const unsigned = 0, const unsigned = 0 ) const { return _thinkTime; }
+    Entity& setThinkTime( double thinkTime ) { _thinkTime = thinkTime; return *this; }
     virtual Entity& setOverlapFactor( const double ) { return *this; }
     unsigned getReplicaNumber() const { return _replica_number; }
     
@@ -41,8 +41,6 @@
 #include "submodel.h"
 #include "task.h"
 #include "variance.h"
-
-unsigned Entry::max_phases	    = 0;
 
 /* ------------------------ Constructors etc. ------------------------- */
 
@@ -53,7 +51,7 @@ Entry::Entry( LQIO::DOM::Entry* dom, unsigned int index, bool global )
       _total( "total" ),
       _nextOpenWait(0.0),		/* copy for delta computation	*/
       _startActivity(nullptr),
-      _entryId(global ? Model::__entry.size()+1 : 0),
+      _entryId(global ? Model::__context->entries.size()+1 : 0),
       _index(index+1),
       _entryType(LQIO::DOM::Entry::Type::NOT_DEFINED),
       _semaphoreType(dom ? dom->getSemaphoreFlag() : LQIO::DOM::Entry::Semaphore::NONE),
@@ -82,7 +80,7 @@ Entry::Entry( const Entry& src, unsigned int replica )
       _total(src._total.name()),
       _nextOpenWait(0.0),
       _startActivity(nullptr),
-      _entryId(src._entryId != 0 ? Model::__entry.size()+1 : 0),
+      _entryId(src._entryId != 0 ? Model::__context->entries.size()+1 : 0),
       _index(src._index),
       _entryType(src._entryType),
       _semaphoreType(src._semaphoreType),
@@ -120,7 +118,7 @@ Entry::~Entry()
 void
 Entry::reset()
 {
-    max_phases		    = 0;
+    Model::__context->max_phases = 0;
 }
 
 
@@ -245,7 +243,7 @@ Entry::configure( const unsigned nSubmodels )
     for ( auto& phase : _phase ) phase.configure( nSubmodels );
     _total.configure( nSubmodels );
 
-    const unsigned n_e = Model::__entry.size() + 1;
+    const unsigned n_e = Model::__context->entries.size() + 1;
     if ( n_e != _interlock.size() ) {
 	_interlock.resize( n_e );
     }
@@ -265,7 +263,7 @@ Entry::expand()
 {
     const unsigned replicas = owner()->replicas();
     for ( unsigned int replica = 2; replica <= replicas; ++replica ) {
-	Model::__entry.insert( clone( replica ) );
+	Model::__context->entries.insert( clone( replica ) );
     }
     return *this;
 }
@@ -513,7 +511,7 @@ Entry::setMaxPhase( const unsigned ph )
 #endif
 	}
     }
-    max_phases = std::max( max_phase, max_phases );		/* Set global value.	*/
+    Model::__context->max_phases = std::max( max_phase, Model::__context->max_phases );	/* Set global value.	*/
 
     return *this;
 }
@@ -1777,7 +1775,7 @@ Entry::create(LQIO::DOM::Entry* dom, unsigned int index )
 	return nullptr;
     } else {
 	Entry * entry = new TaskEntry( dom, index );
-	Model::__entry.insert( entry );
+	Model::__context->entries.insert( entry );
 
 	/* Make sure that the entry type is set properly for all entries */
 	if ( entry->entryTypeOk( dom->getEntryType() ) == false ) {
@@ -1854,8 +1852,8 @@ set_start_activity (Task* task, LQIO::DOM::Entry* entry_DOM)
 /* static */ Entry *
 Entry::find( const std::string& name, unsigned int replica )
 {
-    std::set<Entry *>::const_iterator entry = std::find_if( Model::__entry.begin(), Model::__entry.end(), EqualsReplica<Entry>( name, replica ) );
-    return ( entry != Model::__entry.end() ) ? *entry : nullptr;
+    std::set<Entry *>::const_iterator entry = std::find_if( Model::__context->entries.begin(), Model::__context->entries.end(), EqualsReplica<Entry>( name, replica ) );
+    return ( entry != Model::__context->entries.end() ) ? *entry : nullptr;
 }
 
 
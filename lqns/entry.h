@@ -163,7 +163,6 @@ private:
 public:
     static bool joinsPresent;
     static bool deterministicPhases;
-    static unsigned max_phases;		/* maximum phase encountered.	*/
 	
     int operator==( const Entry& anEntry ) const;
     static void reset();
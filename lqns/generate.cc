@@ -678,7 +678,7 @@ Generate::LibMVA::printServerStation( std::ostream& output, const Entity& server
 	    output << "    prOt = " << station_name << "->getPrOt(" << e << ");" << std::endl;
 			
 	    for( unsigned int k = 1; k <= K; ++k ) {
-		for ( unsigned p = 0; p <= Entry::max_phases; ++p ) {	// Total probability!
+		for ( unsigned p = 0; p <= Model::__context->max_phases; ++p ) {	// Total probability!
 		    for ( unsigned q = 1; q <= P; ++q ) {
 			if ( prOt[k][p][q] == 0.0 ) continue;
 			output << "    prOt" << overtaking_args( k, p, q ) << " = " << prOt[k][p][q] << ";" << std::endl;
@@ -81,8 +81,8 @@ Group::insertDOMResults() const
 Group *
 Group::find( const std::string& group_name, unsigned int replica )
 {
-    const std::set<Group *>::const_iterator group = find_if( Model::__group.begin(), Model::__group.end(), EqualsReplica<Group>( group_name, replica ) );
-    return group != Model::__group.end() ? *group : nullptr;
+    const std::set<Group *>::const_iterator group = find_if( Model::__context->groups.begin(), Model::__context->groups.end(), EqualsReplica<Group>( group_name, replica ) );
+    return group != Model::__context->groups.end() ? *group : nullptr;
 }
 
 
@@ -110,8 +110,8 @@ Group::create( const std::pair<std::string,LQIO::DOM::Group*>& p )
     Group * group = new Group( dom, processor );
 
     processor->addGroup( group );
-    Model::__group.insert( group );
+    Model::__context->groups.insert( group );
 
     /* Generate a new group with the parameters and add it to the list */
-    Model::__group.insert( new Group( dom, processor ) );
+    Model::__context->groups.insert( new Group( dom, processor ) );
 }
@@ -77,6 +77,9 @@ static const std::map<const std::string,const std::string> opt_help = {
     { "print-interval",				"Output the intermediate solution of the model after <n> iterations." },
     { "reset-mva",				"Reset the MVA calculation prior to solving a submodel." },
     { "trace-mva",				"Trace the operation of the MVA solver. <n> is a 64 bit number where the bit position is the submodel to trace." },
+    { "mva-threads",				"Use <n> threads for the Exact MVA solver.  Zero uses all available cores." },
+    { "mva-rolling-storage",			"Only store the results for two population levels in the Exact MVA solver." },
+    { "model-threads",				"Solve up to <n> input files at the same time.  Zero uses all available cores.  Models with LQX or SPEX are solved one at a time." },
     { "debug-submodels",			"Print out submodels. <n> is a 64 bit number where the bit position is the submodel output." },
     { "debug-json",				"Output debugging information while parsing JSON input." },
     { "debug-lqx",				"Output debugging information while parsing LQX input." },
@@ -134,6 +137,8 @@ const std::map<const int,const Help::help_fptr> Help::__option_table =
     { 512+'r',	&Help::flagReloadLQX },
     { 256+'S',  &Help::flagDebugSubmodels },
     { 256+'t',	&Help::flagTraceMVA },
+    { 256+'T',	&Help::flagMVAThreads },
+    { 256+'R',	&Help::flagMVARollingStorage },
     { 512+'j',	&Help::flagDebugJSON },
     { 512+'l',	&Help::flagDebugLQX },
     { 512+'s',	&Help::flagPrintSPEX },
@@ -144,6 +149,7 @@ const std::map<const int,const Help::help_fptr> Help::__option_table =
 
 const Help::pragma_map_t Help::__pragmas =
 {
+    { LQIO::DOM::Pragma::_acceleration_,	    pragma_info( &Help::pragmaAcceleration, &__acceleration_args ) },
     { LQIO::DOM::Pragma::_convergence_value_,       pragma_info( &Help::pragmaConvergenceValue ) },
     { LQIO::DOM::Pragma::_cycles_,		    pragma_info( &Help::pragmaCycles, &__cycles_args ) },
     { LQIO::DOM::Pragma::_force_infinite_,	    pragma_info( &Help::pragmaForceInfinite, &__force_infinite_args ) },
@@ -165,21 +171,30 @@ const Help::pragma_map_t Help::__pragmas =
 #if RESCHEDULE
     { LQIO::DOM::Pragma::_reschedule_on_async_send_,pragma_info( &Help::pragmaReschedule, &__reschedule_args ) },
 #endif
+    { LQIO::DOM::Pragma::_reuse_tolerance_,	    pragma_info( &Help::pragmaReuseTolerance ) },
     { LQIO::DOM::Pragma::_save_marginal_probabilities_,pragma_info( &Help::pragmaSaveMarginalProbabilities ) },
     { LQIO::DOM::Pragma::_severity_level_,	    pragma_info( &Help::pragmaSeverityLevel, &__warning_args ) },
     { LQIO::DOM::Pragma::_spex_comment_,	    pragma_info( &Help::pragmaSpexComment, &__spex_comment_args ) },
     { LQIO::DOM::Pragma::_spex_convergence_,	    pragma_info( &Help::pragmaSpexConvergence ) },
     { LQIO::DOM::Pragma::_spex_iteration_limit_,    pragma_info( &Help::pragmaSpexIterationLimit ) },
     { LQIO::DOM::Pragma::_spex_underrelaxation_,    pragma_info( &Help::pragmaSpexUnderrelaxation ) },
+    { LQIO::DOM::Pragma::_spex_workers_,	    pragma_info( &Help::pragmaSpexWorkers ) },
     { LQIO::DOM::Pragma::_spex_header_,		    pragma_info( &Help::pragmaSpexHeader, &__spex_header_args ) },
     { LQIO::DOM::Pragma::_stop_on_message_loss_,    pragma_info( &Help::pragmaStopOnMessageLoss, &__stop_on_message_loss_args ) },
     { LQIO::DOM::Pragma::_tau_,			    pragma_info( &Help::pragmaTau ) },
     { LQIO::DOM::Pragma::_threads_,		    pragma_info( &Help::pragmaThreads, &__threads_args ) },
     { LQIO::DOM::Pragma::_underrelaxation_,         pragma_info( &Help::pragmaUnderrelaxation ) },
     { LQIO::DOM::Pragma::_variance_,		    pragma_info( &Help::pragmaVariance, &__variance_args ) },
+    { LQIO::DOM::Pragma::_warm_start_,		    pragma_info( &Help::pragmaWarmStart, &__warm_start_args ) },
 };
 
 
+const Help::parameter_map_t Help::__acceleration_args =
+{
+    { LQIO::DOM::Pragma::_anderson_,	parameter_info(&Help::pragmaAccelerationAnderson) },
+    { LQIO::DOM::Pragma::_none_,	parameter_info(&Help::pragmaAccelerationNone,true) }
+};
+
 const Help::parameter_map_t Help::__cycles_args =
 {
     { LQIO::DOM::Pragma::_no_,		parameter_info(&Help::pragmaCyclesDisallow,true) },
@@ -212,11 +227,13 @@ const Help::parameter_map_t Help::__layering_args =
 {
     { LQIO::DOM::Pragma::_batched_,	parameter_info(&Help::pragmaLayeringBatched,true) },
     { LQIO::DOM::Pragma::_batched_back_,parameter_info(&Help::pragmaLayeringBatchedBack) },
+    { LQIO::DOM::Pragma::_batched_parallel_,parameter_info(&Help::pragmaLayeringBatchedParallel) },
     { LQIO::DOM::Pragma::_hwsw_,	parameter_info(&Help::pragmaLayeringHwSw) },
     { LQIO::DOM::Pragma::_mol_,		parameter_info(&Help::pragmaLayeringMOL) },
     { LQIO::DOM::Pragma::_mol_back_,	parameter_info(&Help::pragmaLayeringMOLBack) },
     { LQIO::DOM::Pragma::_squashed_,	parameter_info(&Help::pragmaLayeringSquashed) },
-    { LQIO::DOM::Pragma::_srvn_,	parameter_info(&Help::pragmaLayeringSRVN) }
+    { LQIO::DOM::Pragma::_srvn_,	parameter_info(&Help::pragmaLayeringSRVN) },
+    { LQIO::DOM::Pragma::_srvn_parallel_,parameter_info(&Help::pragmaLayeringSRVNParallel) }
 };
 
 const Help::parameter_map_t Help::__multiserver_args =
@@ -298,6 +315,11 @@ const Help::parameter_map_t Help::__threads_args = {
     { LQIO::DOM::Pragma::_none_,	parameter_info(&Help::pragmaThreadsNone) }
 };
 
+const Help::parameter_map_t Help::__warm_start_args = {
+    { LQIO::DOM::Pragma::_false_,	parameter_info(&Help::pragmaWarmStartFalse,true) },
+    { LQIO::DOM::Pragma::_true_,	parameter_info(&Help::pragmaWarmStartTrue) }
+};
+
 const Help::parameter_map_t Help::__variance_args = {
     { LQIO::DOM::Pragma::_default_,	parameter_info(&Help::pragmaVarianceDefault) },
     { LQIO::DOM::Pragma::_init_only_,	parameter_info(&Help::pragmaVarianceInitOnly) },
@@ -358,6 +380,7 @@ usage ( const char * optarg )
 		case (256+'i'):
 		case (256+'k'):
 		case (256+'u'):
+		case (256+'T'):
 		    s += "=<n>";
 		    break;
 
@@ -794,6 +817,25 @@ Help::flagMOLUnderrelaxation( std::ostream& output, bool verbose ) const
     return pragmaMOLUnderrelaxation( output, verbose );
 }
 
+std::ostream&
+Help::flagMVAThreads( std::ostream& output, bool verbose ) const
+{
+    output << "Solve the populations of a submodel which have the same number of customers in parallel" << std::endl
+	   << "using " << emph( *this, "n" ) << " threads when using Exact MVA.  The results are identical to the serial solution." << std::endl
+	   << "Submodels with Rolia multiservers or phased servers are always solved serially." << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::flagMVARollingStorage( std::ostream& output, bool verbose ) const
+{
+    output << "Only keep the results for the current and previous number of customers when using Exact MVA." << std::endl
+	   << "Memory grows with the largest level of the population lattice rather than the whole lattice." << std::endl
+	   << "Submodels with stations that need results for other populations, such as priority servers," << std::endl
+	   << "use the full lattice." << std::endl;
+    return output;
+}
+
 std::ostream&
 Help::flagNoExecute( std::ostream& output, bool verbose ) const
 {
@@ -1373,6 +1415,31 @@ Help::specialFullReinitialize( std::ostream & output, bool verbose ) const
 
 /* ------------------------------------------------------------------------ */
 
+std::ostream&
+Help::pragmaAcceleration( std::ostream& output, bool verbose ) const
+{
+    output << "This pragma is used to choose how the waiting times found by one iteration of the layers are used by the next." << ix( *this, "acceleration" ) << std::endl
+	   << emph( *this, "Arg" ) << " must be one of: " << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaAccelerationAnderson( std::ostream& output, bool verbose ) const
+{
+    output << "Use Anderson mixing" << ix( *this, "Anderson mixing" ) << " over the last few iterations to extrapolate the waiting times of the next." << std::endl
+	   << "If the change between iterations grows, the history is discarded and plain under-relaxation is used." << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaAccelerationNone( std::ostream& output, bool verbose ) const
+{
+    output << "Use the waiting times from the last iteration with under-relaxation." << std::endl;
+    return output;
+}
+
+/* -- */
+
 std::ostream&
 Help::pragmaConvergenceValue( std::ostream & output, bool verbose ) const
 {
@@ -1555,6 +1622,13 @@ Help::pragmaLayeringBatchedBack( std::ostream& output, bool verbose ) const
     return output;
 }
 
+std::ostream&
+Help::pragmaLayeringBatchedParallel( std::ostream& output, bool verbose ) const
+{
+    output << "Batched layering with concurrent submodels -- as " << emph( *this, LQIO::DOM::Pragma::_batched_ ) << ", but submodels which share no tasks or processors are solved at the same time on separate threads.  Results are the same as " << emph( *this, LQIO::DOM::Pragma::_batched_ ) << "." << std::endl;
+    return output;
+}
+
 std::ostream&
 Help::pragmaLayeringHwSw( std::ostream& output, bool verbose ) const
 {
@@ -1585,6 +1659,13 @@ Help::pragmaLayeringSRVN( std::ostream& output, bool verbose ) const
     return output;
 }
 
+std::ostream&
+Help::pragmaLayeringSRVNParallel( std::ostream& output, bool verbose ) const
+{
+    output << "SRVN layers with concurrent submodels -- as " << emph( *this, LQIO::DOM::Pragma::_srvn_ ) << ", but submodels which share no tasks or processors are solved at the same time on separate threads.  Results are the same as " << emph( *this, LQIO::DOM::Pragma::_srvn_ ) << "." << std::endl;
+    return output;
+}
+
 std::ostream&
 Help::pragmaLayeringSquashed( std::ostream& output, bool verbose ) const
 {
@@ -1877,6 +1958,19 @@ Help::pragmaRescheduleFalse( std::ostream& output, bool verbose ) const
 
 /* -- */
 
+std::ostream&
+Help::pragmaReuseTolerance( std::ostream& output, bool verbose ) const
+{
+    output << "Solve a submodel again only if one of its inputs has changed by more than " << emph( *this, "arg" ) << " relative to the last time it was solved.  " << std::endl;
+    if ( verbose ) {
+	output << emph( *this, "Arg" ) << " must be a number greater than or equal to 0.0." << std::endl;
+    }
+    output << "The default is 0.0, which only uses the last solution of a submodel again if its inputs are the same and solving it again would not change it." << std::endl;
+    return output;
+}
+
+/* -- */
+
 std::ostream&
 Help::pragmaSaveMarginalProbabilities( std::ostream& output, bool verbose ) const
 {
@@ -1966,6 +2060,18 @@ Help::pragmaSpexUnderrelaxation( std::ostream& output, bool verbose ) const
     return output;
 }
 
+std::ostream&
+Help::pragmaSpexWorkers( std::ostream& output, bool verbose ) const
+{
+    output << "Solve the points of a SPEX sweep using " << emph( *this, "arg" ) << " worker processes.  " << std::endl;
+    if ( verbose ) {
+	output << emph( *this, "Arg" ) << " must be a number greater than or equal to 0.  Zero uses one worker per core." << std::endl;
+    }
+    output << "The results are output in the same order as a serial run.  "
+	   << "Sweeps with a SPEX convergence section, and LQX programs, are always run serially." << std::endl;
+    return output;
+}
+
 /* -- */
 
 std::ostream&
@@ -2137,6 +2243,33 @@ Help::pragmaVarianceInitOnly( std::ostream& output, bool verbose ) const
 
 /* -- */
 
+std::ostream&
+Help::pragmaWarmStart( std::ostream& output, bool verbose ) const
+{
+    output << "This pragma is used to choose the starting point when a model is solved more than once by SPEX or LQX." << ix( *this, "warm start" ) << std::endl
+	   << emph( *this, "Arg" ) << " must be one of: " << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaWarmStartFalse( std::ostream& output, bool verbose ) const
+{
+    output << "Reset all waiting times to their initial values before each solution." << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaWarmStartTrue( std::ostream& output, bool verbose ) const
+{
+    output << "Start from the waiting times and throughputs of the previous solution if it converged.  If a solution started" << std::endl
+	   << "this way takes more iterations than the last cold start, or its convergence value grows for five iterations" << std::endl
+	   << "in a row, it is solved again starting from the initial values.  The workers of a sweep (spex-workers)" << std::endl
+	   << "always start from the initial values, as they do not solve consecutive points." << std::endl;
+    return output;
+}
+
+/* -- */
+
 #if HAVE_LIBGSL && HAVE_LIBGSLCBLAS
 std::ostream&
 Help::pragmaQuorumDelayedCalls( std::ostream& output, bool verbose ) const
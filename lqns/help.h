@@ -151,6 +151,8 @@ private:
     std::ostream& flagIterationLimit( std::ostream& output, bool verbose ) const;
     std::ostream& flagJSON( std::ostream& output, bool verbose ) const;
     std::ostream& flagMOLUnderrelaxation( std::ostream& output, bool verbose ) const;
+    std::ostream& flagMVARollingStorage( std::ostream& output, bool verbose ) const;
+    std::ostream& flagMVAThreads( std::ostream& output, bool verbose ) const;
     std::ostream& flagMethoOfLayers( std::ostream& output, bool verbose ) const;
     std::ostream& flagNoExecute( std::ostream& output, bool verbose ) const;
     std::ostream& flagNoHeader( std::ostream& output, bool verbose ) const;
@@ -226,6 +228,7 @@ public:
     std::ostream& specialSingleStep( std::ostream & output, bool verbose ) const;
     std::ostream& speicalSkipLayer( std::ostream & output, bool verbose ) const;
 
+    std::ostream& pragmaAcceleration( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaConvergenceValue( std::ostream & output, bool verbose ) const;
     std::ostream& pragmaCycles( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaForceInfinite( std::ostream& output, bool verbose ) const;
@@ -250,6 +253,7 @@ public:
     std::ostream& pragmaRescheduleTrue( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaRescheduleFalse( std::ostream& output, bool verbose ) const;
 #endif
+    std::ostream& pragmaReuseTolerance( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSaveMarginalProbabilities( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSeverityLevel( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexComment( std::ostream& output, bool verbose ) const;
@@ -257,11 +261,15 @@ public:
     std::ostream& pragmaSpexHeader( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexIterationLimit( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexUnderrelaxation( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaSpexWorkers( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaTau( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaThreads( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaUnderrelaxation( std::ostream & output, bool verbose ) const;
     std::ostream& pragmaVariance( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaWarmStart( std::ostream& output, bool verbose ) const;
 
+    std::ostream& pragmaAccelerationAnderson( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaAccelerationNone( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaCyclesAllow( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaCyclesDisallow( std::ostream& output, bool verbose ) const;
 
@@ -283,11 +291,13 @@ public:
 
     std::ostream& pragmaLayeringBatched( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringBatchedBack( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaLayeringBatchedParallel( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringHwSw( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringMOL( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringMOLBack( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringSquashed( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringSRVN( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaLayeringSRVNParallel( std::ostream& output, bool verbose ) const;
 
     std::ostream& pragmaMultiServerDefault( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaMultiServerConway( std::ostream& output, bool verbose ) const;
@@ -330,6 +340,8 @@ public:
     std::ostream& pragmaVarianceMol( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaVarianceNoEntry( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaVarianceInitOnly( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaWarmStartFalse( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaWarmStartTrue( std::ostream& output, bool verbose ) const;
 
     std::ostream& pragmaSeverityLevelWarnings( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSeverityLevelRunTime( std::ostream& output, bool verbose ) const;
@@ -365,6 +377,7 @@ protected:
     static const pragma_map_t __pragmas;
     
 private:
+    static const parameter_map_t  __acceleration_args;
     static const parameter_map_t  __cycles_args;
     static const parameter_map_t  __force_infinite_args;
     static const parameter_map_t  __force_multiserver_args;
@@ -383,6 +396,7 @@ private:
     static const parameter_map_t  __stop_on_message_loss_args;
     static const parameter_map_t  __threads_args;
     static const parameter_map_t  __variance_args;
+    static const parameter_map_t  __warm_start_args;
     static const parameter_map_t  __warning_args;
 #if HAVE_LIBGSL && HAVE_LIBGSLCBLAS
     static const parameter_map_t  __quorum_distribution_args;
@@ -239,7 +239,7 @@ Interlock::findParentEntries( const Entry& srcA, const Entry& srcC )
 
     /* Figure 6 in interlock paper. */
 
-    for ( std::set<Task *>::const_iterator aTask = Model::__task.begin(); aTask != Model::__task.end(); ++aTask ) {
+    for ( std::set<Task *>::const_iterator aTask = Model::__context->tasks.begin(); aTask != Model::__context->tasks.end(); ++aTask ) {
 
 	/* x calls a, a calls b; y calls c, c calls d */
 
@@ -571,7 +571,7 @@ Interlock::printPathTable( std::ostream& output )
     output << "src\\dst   ";
     unsigned i;
     unsigned j;
-    for ( i = 1, srcEntry = Model::__entry.begin(); srcEntry != Model::__entry.end(); ++srcEntry, ++i ) {
+    for ( i = 1, srcEntry = Model::__context->entries.begin(); srcEntry != Model::__context->entries.end(); ++srcEntry, ++i ) {
 	const Entry * anEntry = *srcEntry;
 	output << trunc( anEntry->name(), 10 );
 	if ( i % columns == 0 ) {
@@ -580,12 +580,12 @@ Interlock::printPathTable( std::ostream& output )
     }
     output << std::endl;
 
-    for ( i = 0, srcEntry = Model::__entry.begin(); srcEntry != Model::__entry.end(); ++srcEntry, ++i ) {
+    for ( i = 0, srcEntry = Model::__context->entries.begin(); srcEntry != Model::__context->entries.end(); ++srcEntry, ++i ) {
 	const Entry * src = *srcEntry;
 
 	if ( i % columns == 0 ) {
 	    output << "----------";
-	    for ( j = 1; j <= Model::__entry.size(); ++j ) {
+	    for ( j = 1; j <= Model::__context->entries.size(); ++j ) {
 		output << "----------";
 		if ( j % columns == 0 ) {
 		    output << '+';
@@ -595,7 +595,7 @@ Interlock::printPathTable( std::ostream& output )
 	}
 
 	output << trunc( src->name(), 10 );
-	for ( j = 1, dstEntry = Model::__entry.begin(); dstEntry != Model::__entry.end(); ++dstEntry, ++j ) {
+	for ( j = 1, dstEntry = Model::__context->entries.begin(); dstEntry != Model::__context->entries.end(); ++dstEntry, ++j ) {
 	    output.setf( std::ios::right, std::ios::adjustfield );
 	    output << std::setw(4) << src->_interlock[(*dstEntry)->entryId()].all << ",";
 	    output.setf( std::ios::left, std::ios::adjustfield );
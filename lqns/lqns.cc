@@ -13,6 +13,8 @@
  */
 
 #include "lqns.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <cstdio>
@@ -20,6 +22,8 @@
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <thread>
+#include <vector>
 #include <errno.h>
 #include <fcntl.h>           /* Definition of AT_* constants */
 #if HAVE_GETOPT_H
@@ -39,6 +43,7 @@
 #include <lqio/getsbopt.h>
 #endif
 #include <mva/fpgoop.h>
+#include <mva/mva.h>
 #include "errmsg.h"
 #include "generate.h"
 #include "help.h"
@@ -103,6 +108,9 @@ const struct option longopts[] =
     { "print-interval",				optional_argument, nullptr, 512+'p' },
     { "reset-mva",				no_argument,	   nullptr, 256+'r' },
     { "trace-mva",				optional_argument, nullptr, 256+'t' },
+    { "mva-threads",				required_argument, nullptr, 256+'T' },
+    { "mva-rolling-storage",			no_argument,	   nullptr, 256+'R' },
+    { "model-threads",				required_argument, nullptr, 512+'T' },
     { "debug-submodels",			no_argument,	   nullptr, 256+'S' },
     { "debug-json",				no_argument,	   nullptr, 512+'j' },
     { "debug-lqx",				no_argument,	   nullptr, 512+'l' },
@@ -135,6 +143,7 @@ int main (int argc, char *argv[])
     Options::Trace::initialize();
     Options::Special::initialize();
     Model::solve_using solve_function = &Model::compute;
+    unsigned model_threads = 1;		/* Input files solved at once.	*/
 
     unsigned global_error_flag = 0;     /* Error detected anywhere??    */
 
@@ -357,6 +366,26 @@ int main (int argc, char *argv[])
 		Options::Trace::mva( optarg != nullptr ? optarg : std::string("") );
 		break;
 
+	    case 256+'R':
+		MVA::__rolling = true;
+		break;
+
+	    case 256+'T': {
+		char * endptr = nullptr;
+		const unsigned long n = strtoul( optarg, &endptr, 10 );
+		if ( *endptr != '\0' ) throw std::invalid_argument( std::string("--mva-threads=") + optarg );
+		MVA::__threads = n > 0 ? n : std::max( std::thread::hardware_concurrency(), 1U );
+		break;
+	    }
+
+	    case 512+'T': {
+		char * endptr = nullptr;
+		const unsigned long n = strtoul( optarg, &endptr, 10 );
+		if ( *endptr != '\0' ) throw std::invalid_argument( std::string("--model-threads=") + optarg );
+		model_threads = n > 0 ? n : std::max( std::thread::hardware_concurrency(), 1U );
+		break;
+	    }
+
 	    case 'u':
 		pragmas.insert( LQIO::DOM::Pragma::_underrelaxation_, optarg != nullptr ? optarg : std::string("") );
 		break;
@@ -454,11 +483,30 @@ int main (int argc, char *argv[])
             }
         }
 
-        for ( ; optind < argc; ++optind ) {
-            if ( file_count > 1 ) {
-                std::cout << argv[optind] << ':' << std::endl;
+        if ( model_threads > 1 && file_count > 1 ) {
+
+            /* Each thread takes the next input file until none are left. */
+
+            std::atomic<int> next_file( optind );
+            std::atomic<unsigned> error_flag( 0 );
+            std::vector<std::thread> workers;
+            for ( unsigned i = 0; i < std::min( model_threads, static_cast<unsigned>(file_count) ); ++i ) {
+                workers.emplace_back( [&]() {
+                    for ( int j = next_file++; j < argc; j = next_file++ ) {
+                        error_flag |= Model::solve( solve_function, argv[j], outputFileName, output_format );
+                    }
+                } );
+            }
+            std::for_each( workers.begin(), workers.end(), []( std::thread& worker ){ worker.join(); } );
+            global_error_flag |= error_flag;
+
+        } else {
+            for ( ; optind < argc; ++optind ) {
+                if ( file_count > 1 ) {
+                    std::cout << argv[optind] << ':' << std::endl;
+                }
+                global_error_flag |= Model::solve( solve_function, argv[optind], outputFileName, output_format );
             }
-            global_error_flag |= Model::solve( solve_function, argv[optind], outputFileName, output_format );
         }
     }
 
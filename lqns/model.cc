@@ -33,13 +33,21 @@
  */
 
 #include "lqns.h"
+#include <cfenv>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <errno.h>
+#include <exception>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
 #if HAVE_UNISTD_H
 #include <unistd.h>
 #endif
@@ -50,6 +58,7 @@
 #include <lqio/input.h>
 #include <lqio/srvn_output.h>
 #include <lqio/srvn_spex.h>
+#include <lqio/sweep.h>
 #include <mva/fpgoop.h>
 #include <mva/mva.h>
 #include <mva/open.h>
@@ -76,15 +85,57 @@
 #include "variance.h"
 
 unsigned int Model::__print_interval = 0;
-Processor * Model::__think_server = nullptr;
-unsigned Model::__sync_submodel = 0;
 
 LQIO::DOM::Document::InputFormat Model::__input_format = LQIO::DOM::Document::InputFormat::AUTOMATIC;
 
-std::set<Processor *,Model::lt_replica<Processor>> Model::__processor;
-std::set<Group *,Model::lt_replica<Group>> Model::__group;
-std::set<Task *,Model::lt_replica<Task>> Model::__task;
-std::set<Entry *,Model::lt_replica<Entry>> Model::__entry;
+thread_local Model::Context * Model::__context = nullptr;
+std::mutex Model::__load_mutex;
+
+/*----------------------------------------------------------------------*/
+/*                               Context                                */
+/*----------------------------------------------------------------------*/
+
+/*
+ * Everything that used to be global to a model.  One is created for
+ * each call to Model::solve() so that separate models without LQX or
+ * SPEX can be solved on separate threads (--model-threads).
+ */
+
+Model::Context::Context()
+    : processors(), groups(), tasks(), entries(), think_server(nullptr), sync_submodel(0), max_phases(0), pragma(nullptr), document(nullptr), input_file_name()
+{
+}
+
+
+Model::Context::~Context()
+{
+    delete pragma;
+}
+
+
+/*
+ * Install the context (and the pragmas, document and file name that go
+ * with it) on the current thread.  The previous context is restored on exit.
+ */
+
+Model::Context::Use::Use( Context& context )
+    : _context(Model::__context), _pragma(Pragma::__cache), _document(LQIO::DOM::__document), _input_file_name(LQIO::DOM::Document::__input_file_name)
+{
+    Model::__context = &context;
+    Pragma::__cache = context.pragma;
+    LQIO::DOM::__document = context.document;
+    LQIO::DOM::Document::__input_file_name = context.input_file_name;
+}
+
+
+Model::Context::Use::~Use()
+{
+    Model::__context = _context;
+    Pragma::__cache = _pragma;
+    LQIO::DOM::__document = _document;
+    LQIO::DOM::Document::__input_file_name = _input_file_name;
+}
+
 
 /*----------------------------------------------------------------------*/
 /*                           Factory Methods                            */
@@ -97,8 +148,17 @@ std::set<Entry *,Model::lt_replica<Entry>> Model::__entry;
 int
 Model::solve( solve_using solve_function, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat )
 {
+    Context context;
+    Context::Use use( context );
+
+    /* The parsers and the conversion from the DOM are not re-entrant.	*/
+    /* Models with LQX or SPEX keep the lock until they are done.	*/
+    std::unique_lock<std::mutex> lock( __load_mutex );
+
     /* Loading the model */
     LQIO::DOM::Document* document = Model::load(inputFileName,outputFileName);
+    context.document = document;
+    context.input_file_name = LQIO::DOM::Document::__input_file_name;
 
     /* Make sure we got a document */
 
@@ -131,6 +191,7 @@ Model::solve( solve_using solve_function, const std::filesystem::path& inputFile
     /* We can simply run if there's no control program */
     LQX::Program * program = document->getLQXProgram();
     if ( program == nullptr ) {
+	lock.unlock();			/* SPEX and LQX share state, so only plain models run concurrently */
 
 	/* There is no control flow program, check for $-variables */
 	if (document->getSymbolExternalVariableCount() != 0) {
@@ -202,8 +263,11 @@ Model::solve( solve_using solve_function, const std::filesystem::path& inputFile
 	    /* Don't create directories etc if there are no loops (i.e., parameters only) */
 	    SolverInterface::Solve::implicitSolve = LQIO::Spex::has_vars() && !LQIO::Spex::has_loops();
 
-	    /* Invoke the LQX program itself */
-	    if ( !program->invoke() ) {
+	    /* Invoke the LQX program itself, on the workers if the points of a sweep are independent */
+	    const LQIO::Sweep sweep( program, LQIO::Sweep::independent() ? Pragma::spexWorkers() : 1 );
+	    if ( sweep( output != nullptr ? output : stdout ) ) {
+		/* Done. */
+	    } else if ( !program->invoke() ) {
 		LQIO::runtime_error( LQIO::ERR_LQX_EXECUTION, inputFileName.c_str() );
 		status = INVALID_INPUT;
 	    } else if ( !SolverInterface::Solve::solveCallViaLQX ) {
@@ -269,6 +333,7 @@ Model::prepare(const LQIO::DOM::Document* document)
 
     /* Update the pragma list from the document (merge), then set globals here as this has to be done prior to runlqx() */
     Pragma::set( document->getPragmaList() );
+    __context->pragma = Pragma::__cache;
     LQIO::io_vars.severity_level = Pragma::severityLevel();
     LQIO::Spex::__no_header = !Pragma::spexHeader();
     LQIO::Spex::__print_comment = Pragma::spexComment();
@@ -363,7 +428,7 @@ Model::prepare(const LQIO::DOM::Document* document)
 
     /* Use the generated connections list to finish up */
     Activity::completeConnections();
-    std::for_each( __task.begin(), __task.end(), std::mem_fn( &Task::linkForkToJoin ) );	/* Link forks to joins		*/
+    std::for_each( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::linkForkToJoin ) );	/* Link forks to joins		*/
 
     /* Tell the user that we have finished */
     return true;
@@ -382,9 +447,9 @@ void
 Model::recalculateDynamicValues()
 {
     setModelParameters();
-    std::for_each( __processor.begin(), __processor.end(), std::mem_fn( &Processor::recalculateDynamicValues ) );
-    std::for_each( __group.begin(), __group.end(), std::mem_fn( &Group::recalculateDynamicValues ) );
-    std::for_each( __task.begin(), __task.end(), std::mem_fn( &Task::recalculateDynamicValues ) );
+    std::for_each( __context->processors.begin(), __context->processors.end(), std::mem_fn( &Processor::recalculateDynamicValues ) );
+    std::for_each( __context->groups.begin(), __context->groups.end(), std::mem_fn( &Group::recalculateDynamicValues ) );
+    std::for_each( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::recalculateDynamicValues ) );
 }
 
 
@@ -398,10 +463,12 @@ Model::create( const LQIO::DOM::Document * document, const std::filesystem::path
 {
     static const std::map<const Pragma::Layering, create_func> create_funcs = {
 	{ Pragma::Layering::BATCHED,  			    &Batch_Model::create },
+	{ Pragma::Layering::BATCHED_PARALLEL,		    &Batch_Model::createParallel },
 	{ Pragma::Layering::BACKPROPOGATE_BATCHED,  	    &BackPropogate_Batch_Model::create },
 	{ Pragma::Layering::METHOD_OF_LAYERS,  		    &MOL_Model::create },
 	{ Pragma::Layering::BACKPROPOGATE_METHOD_OF_LAYERS, &BackPropogate_MOL_Model::create },
 	{ Pragma::Layering::SRVN,  			    &SRVN_Model::create },
+	{ Pragma::Layering::SRVN_PARALLEL,		    &SRVN_Model::createParallel },
 	{ Pragma::Layering::SQUASHED,  			    &Squashed_Model::create },
 	{ Pragma::Layering::HWSW,  			    &HwSw_Model::create }
     };
@@ -434,11 +501,12 @@ void
 Model::setModelParameters()
 {
     /* The print interval can be set by option.cc */
-    if ( __print_interval == 0 ) {
-	__print_interval = getDOM()->getModelPrintIntervalValue();
+    _print_interval = __print_interval != 0 ? __print_interval : getDOM()->getModelPrintIntervalValue();
+    if ( _print_interval != getDOM()->getModelPrintIntervalValue() ) {
+	const_cast<LQIO::DOM::Document *>(getDOM())->setModelPrintInterval( new LQIO::DOM::ConstantExternalVariable( _print_interval ) );
     }
-    if ( __print_interval != getDOM()->getModelPrintIntervalValue() ) {
-	const_cast<LQIO::DOM::Document *>(getDOM())->setModelPrintInterval( new LQIO::DOM::ConstantExternalVariable( __print_interval ) );
+    if ( _print_interval == 0 ) {
+	_print_interval = 1;			/* Every iteration.		*/
     }
 
     if ( _iteration_limit == 0 ) {
@@ -493,11 +561,11 @@ Model::setModelParameters()
 
 Model::Model( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat )
     : _submodels(), _converged(false), _iterations(0), _MVAStats(),
-      _convergence_value(0), _iteration_limit(0), _underrelaxation(0),
-      _step_count(0), _model_initialized(false), _document(document),
+      _convergence_value(0), _iteration_limit(0), _underrelaxation(0), _print_interval(1),
+      _step_count(0), _model_initialized(false), _warm_start(false), _cold_iterations(0), _last_delta(0.), _growth(0), _document(document),
       _input_file_name(inputFileName), _output_file_name(outputFileName), _output_format(outputFormat)
 {
-    __sync_submodel = 0;
+    __context->sync_submodel = 0;
 }
 
 /*
@@ -508,22 +576,22 @@ Model::~Model()
 {
     std::for_each( _submodels.begin(), _submodels.end(), []( Submodel * submodel ){ delete submodel; } );
 
-    std::for_each( __processor.begin(), __processor.end(), []( Processor * processor ){ delete processor; } );
-    __processor.clear();		/* Global, so get rid of them */
+    std::for_each( __context->processors.begin(), __context->processors.end(), []( Processor * processor ){ delete processor; } );
+    __context->processors.clear();		/* Shared, so get rid of them */
 
-    std::for_each( __group.begin(), __group.end(), []( Group * group ){ delete group; } );
-    __group.clear();
+    std::for_each( __context->groups.begin(), __context->groups.end(), []( Group * group ){ delete group; } );
+    __context->groups.clear();
 
-    if ( __think_server ) {
-	delete __think_server;
-	__think_server = nullptr;
+    if ( __context->think_server ) {
+	delete __context->think_server;
+	__context->think_server = nullptr;
     }
 
-    std::for_each( __task.begin(), __task.end(), []( Task * task ){ delete task; } );
-    __task.clear();
+    std::for_each( __context->tasks.begin(), __context->tasks.end(), []( Task * task ){ delete task; } );
+    __context->tasks.clear();
 
-    std::for_each( __entry.begin(), __entry.end(), []( Entry * entry ){ delete entry; } );
-    __entry.clear();
+    std::for_each( __context->entries.begin(), __context->entries.end(), []( Entry * entry ){ delete entry; } );
+    __context->entries.clear();
 }
 
 
@@ -544,7 +612,7 @@ Model::initialize()
 	/* Expand replicas and add think server. */
 	extend();			/* Do this before Task::initializeProcessor() */
 
-	std::for_each( __task.begin(), __task.end(), std::mem_fn( &Task::initializeProcessor ) );	/* Set Processor Service times.	*/
+	std::for_each( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::initializeProcessor ) );	/* Set Processor Service times.	*/
 
 	if ( Options::Trace::verbose() ) std::cerr << "Generate... " << std::endl;
 	if ( generate( assignSubmodel() ) ) {
@@ -560,6 +628,8 @@ Model::initialize()
 	}
 
     } else {
+	/* Start from the last solution if it converged.  A worker of a sweep did not solve the last point. */
+	_warm_start = Pragma::warmStart() && _converged && !LQIO::Sweep::worker();
 	reinitializeSubmodels();
     }
 
@@ -578,10 +648,10 @@ Model::extend()
 
     if ( Pragma::replication() == Pragma::Replication::EXPAND || Pragma::replication() == Pragma::Replication::PRUNE ) {
 	/* Copy over original sets because we are going to insert the new objects directly */
-	const std::set<Processor *,lt_replica<Processor>> processors(Model::__processor);
-//	const std::set<Group *,lt_replica<Group>> Model::__group;
-	const std::set<Task *,lt_replica<Task>> tasks(Model::__task);
-	const std::set<Entry *,lt_replica<Entry>> entries(Model::__entry);
+	const std::set<Processor *,lt_replica<Processor>> processors(__context->processors);
+//	const std::set<Group *,lt_replica<Group>> groups(__context->groups);
+	const std::set<Task *,lt_replica<Task>> tasks(__context->tasks);
+	const std::set<Entry *,lt_replica<Entry>> entries(__context->entries);
 
 	/* Create processors and entries first as tasks need them.  */
 	std::for_each( processors.begin(), processors.end(), std::mem_fn( &Processor::expand ) );
@@ -595,16 +665,16 @@ Model::extend()
 
     /* Think times. */
 
-    for ( std::set<Task *>::const_iterator task = __task.begin(); task != __task.end(); ++task ) {
+    for ( std::set<Task *>::const_iterator task = __context->tasks.begin(); task != __context->tasks.end(); ++task ) {
 
 	/* Add a delay server for think times. */
 
 	if ( (*task)->hasThinkTime() ) {
-	    if ( !__think_server ) {
-		__think_server = new DelayServer();
-		__think_server->setClosedModelServer( true );
+	    if ( !__context->think_server ) {
+		__context->think_server = new DelayServer();
+		__context->think_server->setClosedModelServer( true );
 	    }
-	    __think_server->addTask( *task );	/* link the task in */
+	    __context->think_server->addTask( *task );	/* link the task in */
 	}
 
 #if HAVE_LIBGSL && HAVE_LIBGSLCBLAS
@@ -630,11 +700,11 @@ Model::check()
 
     if ( LQIO::io_vars.anError() ) return false;	/* Don't bother */
 
-    bool rc = std::all_of( __processor.begin(), __processor.end(), std::mem_fn( &Processor::check ) )
-	&& std::all_of( __task.begin(), __task.end(), std::mem_fn( &Task::check ) );
+    bool rc = std::all_of( __context->processors.begin(), __context->processors.end(), std::mem_fn( &Processor::check ) )
+	&& std::all_of( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::check ) );
 
-    if ( std::none_of( __task.begin(), __task.end(), std::mem_fn( &Task::isReferenceTask ) )
-	 && std::none_of( __task.begin(), __task.end(), std::mem_fn( &Task::hasOpenArrivals ) ) ) {
+    if ( std::none_of( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::isReferenceTask ) )
+	 && std::none_of( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::hasOpenArrivals ) ) ) {
 	rc = false;
 	LQIO::runtime_error( LQIO::ERR_NO_REFERENCE_TASKS );
     }
@@ -668,9 +738,9 @@ Model::generate( unsigned max_depth )
 
     /* Add submodel for join delay calculation */
 
-    if ( std::any_of( __task.begin(), __task.end(), std::mem_fn( &Task::hasForks ) ) ) {
-	__sync_submodel = nSubmodels() + 1;	/* Set global here, used in addToSubmodel */
-	_submodels.push_back(new SynchSubmodel(__sync_submodel));
+    if ( std::any_of( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::hasForks ) ) ) {
+	__context->sync_submodel = nSubmodels() + 1;	/* Set global here, used in addToSubmodel */
+	_submodels.push_back(new SynchSubmodel(__context->sync_submodel));
     }
 
     /* Build model. */
@@ -696,10 +766,10 @@ void
 Model::configure()
 {
     _MVAStats.resize( nSubmodels() );	/* MVA statistics by level.	*/
-    for ( auto task : __task ) task->configure( nSubmodels() );
-    for ( auto processor : __processor ) processor->configure( nSubmodels() );
-    if ( __think_server ) {
-	__think_server->configure( nSubmodels() );
+    for ( auto task : __context->tasks ) task->configure( nSubmodels() );
+    for ( auto processor : __context->processors ) processor->configure( nSubmodels() );
+    if ( __context->think_server ) {
+	__context->think_server->configure( nSubmodels() );
     }
 }
 
@@ -714,7 +784,7 @@ void
 Model::initializeSubmodels()
 {
     if ( Pragma::interlock() ) {
-	std::for_each( __task.begin(), __task.end(), std::mem_fn( &Task::createInterlock ) );
+	std::for_each( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::createInterlock ) );
 	if ( Options::Debug::interlock() ) {
 	    Interlock::printPathTable( std::cout );
 	}
@@ -740,6 +810,64 @@ Model::initializeSubmodels()
 
 
 
+/*
+ * The waiting times and throughputs of the clients, saved at the end of
+ * one solution to be the starting point of the next (warm-start).
+ */
+
+class Model::Solution
+{
+public:
+    Solution() {}
+    explicit Solution( const std::set<Task *,lt_replica<Task>>& tasks )
+	{
+	    for ( const auto task : tasks ) {
+		for ( const auto entry : task->entries() ) {
+		    _throughput.emplace( entry, entry->throughput() );
+		    for ( unsigned p = 1; p <= entry->maxPhase(); ++p ) {
+			save( const_cast<Phase&>(entry->getPhase( p )) );
+		    }
+		}
+		for ( const auto activity : task->activities() ) {
+		    save( *activity );
+		}
+	    }
+	}
+
+    void restore() const
+	{
+	    for ( const auto& phase : _phase_wait ) {
+		for ( unsigned n = 1; n <= phase.second.size(); ++n ) {
+		    phase.first->setWaitTime( n, phase.second[n-1] );
+		}
+	    }
+	    for ( const auto& call : _call_wait ) call.first->setWait( call.second );
+	    for ( const auto& entry : _throughput ) entry.first->saveThroughput( entry.second );
+	}
+
+private:
+    void save( Phase& phase )
+	{
+	    std::vector<double>& wait = _phase_wait[&phase];
+	    for ( unsigned n = 1; n <= phase.getWaitSize(); ++n ) {
+		wait.push_back( phase.getWaitTime( n ) );
+	    }
+	    for ( const auto call : phase.callList() ) {
+		_call_wait.emplace( call, call->wait() );
+	    }
+	    for ( const auto device : phase.devices() ) {
+		_call_wait.emplace( device->call(), device->call()->wait() );
+	    }
+	}
+
+private:
+    std::map<Phase *,std::vector<double>> _phase_wait;
+    std::map<Call *,double> _call_wait;
+    std::map<Entry *,double> _throughput;
+};
+
+
+
 /*
  * Re-initialize waiting times, interlocking etc.  Servers are done by
  * subclasses because of the structure of the model.  Clients are done here.
@@ -758,21 +886,25 @@ Model::reinitializeSubmodels()
 
     std::for_each( _MVAStats.begin(), _MVAStats.end(), std::mem_fn( &MVACount::initialize ) );
     if ( Pragma::interlock() ) {
-	std::for_each( __entry.begin(), __entry.end(), std::mem_fn( &Entry::resetInterlock ) );
+	std::for_each( __context->entries.begin(), __context->entries.end(), std::mem_fn( &Entry::resetInterlock ) );
     }
 
     /*
      * Reinitialize the MVA stuff
      */
 
-    std::for_each( __task.begin(), __task.end(), std::mem_fn( &Task::createInterlock ) );
+    std::for_each( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::createInterlock ) );
 
     /*
      * Initialize waiting times and populations at servers Done in reverse
-     * order (bottom up) because waits propogate upwards.
+     * order (bottom up) because waits propogate upwards.  For a warm
+     * start, the throughput bounds are found from the initial waits, then
+     * the waits and throughputs of the last solution are put back.
      */
 
+    const Solution last = _warm_start ? Solution( __context->tasks ) : Solution();
     std::for_each( _submodels.rbegin(), _submodels.rend(), std::mem_fn( &Submodel::reinitializeSubmodel ) );
+    last.restore();
 
     /* Reinitialize Interlocking */
 
@@ -787,6 +919,25 @@ Model::reinitializeSubmodels()
 
 
 
+/*
+ * A warm start has failed if the delta has grown for five iterations
+ * in a row (it often grows for a few as the solution moves), or if it
+ * has taken more iterations than the last cold start did.  The solvers
+ * then stop, and compute() starts over from the initial waits rather
+ * than running to the iteration limit.
+ */
+
+bool
+Model::warmStartFailed( double delta )
+{
+    if ( !_warm_start ) return false;
+    _growth = (_iterations > 1 && delta > _last_delta) ? _growth + 1 : 0;
+    _last_delta = delta;
+    return _growth >= 5 || _iterations > _cold_iterations;
+}
+
+
+
 /*
  * Reorder the entities (for output) in the DOM to level (ref task = 0), then name.
  */
@@ -806,8 +957,8 @@ Model::reorderOutput() const
     /* go through all the tasks and processors and save based on their depth. Processor and tasks names can collide. */
 
     std::multiset<Entity *,compare> mapped;
-    std::copy_if( __task.begin(), __task.end(), std::inserter( mapped, mapped.end() ), predicate );
-    std::copy_if( __processor.begin(), __processor.end(), std::inserter( mapped, mapped.end() ), predicate );
+    std::copy_if( __context->tasks.begin(), __context->tasks.end(), std::inserter( mapped, mapped.end() ), predicate );
+    std::copy_if( __context->processors.begin(), __context->processors.end(), std::inserter( mapped, mapped.end() ), predicate );
 	       
     /* Change the order in the DOM.  DO NOT clear entities because the vector has to be the right size */
     std::vector<LQIO::DOM::Entity *>& entities = const_cast<std::vector<LQIO::DOM::Entity *>&>(getDOM()->getEntities());
@@ -835,7 +986,21 @@ Model::compute()
 
     report.start();
     _converged = false;
-    const double delta = run();
+    _growth = 0;
+    double delta = run();
+    if ( _warm_start && !_converged ) {
+	/* The last solution was a poor starting point, so start over as for a cold solve. */
+	const unsigned long iterations = _iterations;
+	if ( Options::Trace::verbose() ) std::cerr << "Warm start failed after " << iterations << " iterations, restarting..." << std::endl;
+	_warm_start = false;
+	reinitializeSubmodels();
+	_growth = 0;
+	delta = run();
+	_cold_iterations = _iterations;
+	_iterations += iterations;
+    } else if ( !_warm_start ) {
+	_cold_iterations = _iterations;
+    }
     report.finish( _converged, delta, _iterations );
     sanityCheck();
     if ( !_converged ) {
@@ -916,8 +1081,8 @@ Model::restart()
 void
 Model::sanityCheck()
 {
-    std::for_each( __task.begin(), __task.end(), std::mem_fn( &Entity::sanityCheck ) );
-    std::for_each( __processor.begin(), __processor.end(), std::mem_fn( &Entity::sanityCheck ) );
+    std::for_each( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Entity::sanityCheck ) );
+    std::for_each( __context->processors.begin(), __context->processors.end(), std::mem_fn( &Entity::sanityCheck ) );
 }
 
 
@@ -937,12 +1102,272 @@ Model::underrelaxation() const
 }
 
 
+
+/*
+ * Anderson mixing of the results of the iterations of the layers.
+ * An iteration maps x, the phase waits, entry throughputs and task
+ * think times at its start, to g(x).  Rather than starting the next
+ * iteration from g(x), start it from the combination of the last few
+ * g's whose residuals (g(x) - x) cancel in the least squares sense.
+ * Tasks with activities are left alone as mixing their waits makes
+ * convergence worse.  Mixing starts once the residual has fallen for
+ * __settle iterations.  If a mixed step makes the residual grow, the
+ * history is discarded; after __restart_limit such restarts, the
+ * iteration reverts to plain under-relaxation.
+ */
+
+class Model::Accelerator
+{
+public:
+    explicit Accelerator( const std::set<Task *,lt_replica<Task>>& );
+
+    void operator()();
+    void reset();
+
+private:
+    std::vector<double> get( std::vector<bool>& ) const;
+    void set( const std::vector<double>&, const std::vector<bool>& ) const;
+    bool mix( const std::vector<double>& g, const std::vector<double>& f, std::vector<double>& x );
+    void clear() { _dg.clear(); _df.clear(); _g.clear(); _f.clear(); }
+
+    static double norm( const std::vector<double>& x ) { return sqrt( std::inner_product( x.begin(), x.end(), x.begin(), 0.0 ) ); }
+
+private:
+    static const unsigned __depth = 5;		/* Iterates to mix.		*/
+    static const unsigned __settle = 2;		/* Plain steps before mixing.	*/
+    static const unsigned __restart_limit = 5;	/* before giving up.		*/
+    static constexpr double __growth = 2.0;	/* Allowed residual growth.	*/
+
+    std::vector<Task *> _tasks;
+    std::vector<Entry *> _entries;
+    std::vector<Phase *> _phases;
+    bool _enabled;
+    bool _mixed;				/* Last step was mixed.		*/
+    unsigned _settled;				/* Steps with falling residual.	*/
+    unsigned _restarts;
+    double _residual;				/* Norm of last residual.	*/
+    std::vector<bool> _skip;			/* Non-finite in _x.		*/
+    std::vector<double> _x;			/* Start of this iteration.	*/
+    std::vector<double> _g;			/* g(x) of last iteration.	*/
+    std::vector<double> _f;			/* g(x) - x of last iteration.	*/
+    std::deque<std::vector<double>> _dg;	/* Differences of g.		*/
+    std::deque<std::vector<double>> _df;	/* Differences of f.		*/
+};
+
+
+Model::Accelerator::Accelerator( const std::set<Task *,lt_replica<Task>>& tasks )
+    : _tasks(), _entries(), _phases(), _enabled(Pragma::acceleration() == Pragma::Acceleration::ANDERSON), _mixed(false), _settled(0), _restarts(0), _residual(std::numeric_limits<double>::infinity()), _skip()
+{
+    if ( !_enabled ) return;
+    for ( const auto task : tasks ) {
+	if ( !task->activities().empty() ) continue;
+	if ( !task->isReferenceTask() ) _tasks.push_back( task );
+	for ( const auto entry : task->entries() ) {
+	    _entries.push_back( entry );
+	    for ( unsigned p = 1; p <= entry->maxPhase(); ++p ) {
+		_phases.push_back( &const_cast<Phase&>(entry->getPhase( p )) );
+	    }
+	}
+    }
+    _x = get( _skip );
+}
+
+
+/*
+ * Called at the end of an iteration.  Replace g(x) with the mixed
+ * values.  Components that are not finite (a think time is infinite
+ * while a task has no throughput) are left out of the residual and
+ * are not mixed.  If that set changes, the history no longer
+ * applies, so start over.
+ */
+
+void
+Model::Accelerator::operator()()
+{
+    if ( !_enabled ) return;
+
+    std::vector<bool> skip;
+    const std::vector<double> g = get( skip );
+    std::vector<double> f( g.size() );
+    for ( size_t j = 0; j < g.size(); ++j ) {
+	f[j] = skip[j] || _skip[j] ? 0.0 : g[j] - _x[j];
+    }
+    const double residual = norm( f );
+
+    if ( skip != _skip ) {
+	_settled = 0;
+	_residual = std::numeric_limits<double>::infinity();
+	_skip = skip;
+    } else if ( _mixed && !(residual <= __growth * _residual) ) {
+	_restarts += 1;				/* Diverging: take g(x) as is.	*/
+	_enabled = _restarts < __restart_limit;
+	_settled = 0;
+    } else if ( !_mixed && !(residual < _residual) ) {
+	_settled = 0;				/* Still settling down.		*/
+    } else {
+	_settled += 1;
+    }
+    if ( _settled == 0 ) {
+	clear();
+    } else if ( !_g.empty() ) {
+	_dg.push_back( std::vector<double>( g.size() ) );
+	_df.push_back( std::vector<double>( g.size() ) );
+	std::transform( g.begin(), g.end(), _g.begin(), _dg.back().begin(), std::minus<double>() );
+	std::transform( f.begin(), f.end(), _f.begin(), _df.back().begin(), std::minus<double>() );
+	if ( _dg.size() > __depth ) {
+	    _dg.pop_front();
+	    _df.pop_front();
+	}
+    }
+    _g = g;
+    _f = f;
+    _residual = residual;
+
+    std::vector<double> x;
+    _mixed = _enabled && _settled >= __settle && mix( g, f, x );
+    if ( _mixed ) {
+	set( x, skip );
+	_x = x;
+    } else {
+	_x = g;
+    }
+}
+
+
+/*
+ * The iteration has changed (MOL solved the hardware submodel), so
+ * start over from the current values.
+ */
+
+void
+Model::Accelerator::reset()
+{
+    if ( !_enabled ) return;
+    clear();
+    _mixed = false;
+    _settled = 0;
+    _residual = std::numeric_limits<double>::infinity();
+    _x = get( _skip );
+}
+
+
+/*
+ * Find gamma minimizing |f - dF gamma| from the normal equations,
+ * then x = g - dG gamma.  Drop the oldest differences if the
+ * equations are singular.  Fail if the result has a negative or
+ * non-finite value.
+ */
+
+bool
+Model::Accelerator::mix( const std::vector<double>& g, const std::vector<double>& f, std::vector<double>& x )
+{
+    while ( !_df.empty() ) {
+	const size_t m = _df.size();
+	std::vector<std::vector<double>> a( m, std::vector<double>( m + 1 ) );	/* [A|b] */
+	for ( size_t i = 0; i < m; ++i ) {
+	    for ( size_t j = 0; j <= i; ++j ) {
+		a[i][j] = a[j][i] = std::inner_product( _df[i].begin(), _df[i].end(), _df[j].begin(), 0.0 );
+	    }
+	    a[i][m] = std::inner_product( _df[i].begin(), _df[i].end(), f.begin(), 0.0 );
+	}
+
+	/* Gaussian elimination with partial pivoting */
+
+	double scale = 0.0;
+	for ( size_t i = 0; i < m; ++i ) scale = std::max( scale, a[i][i] );
+	bool singular = !(scale > 0.0);
+	for ( size_t k = 0; k < m && !singular; ++k ) {
+	    size_t pivot = k;
+	    for ( size_t i = k + 1; i < m; ++i ) {
+		if ( std::fabs( a[i][k] ) > std::fabs( a[pivot][k] ) ) pivot = i;
+	    }
+	    if ( std::fabs( a[pivot][k] ) <= 1.0e-12 * scale ) {
+		singular = true;
+		break;
+	    }
+	    std::swap( a[k], a[pivot] );
+	    for ( size_t i = k + 1; i < m; ++i ) {
+		const double r = a[i][k] / a[k][k];
+		for ( size_t j = k; j <= m; ++j ) a[i][j] -= r * a[k][j];
+	    }
+	}
+	if ( singular ) {
+	    _dg.pop_front();
+	    _df.pop_front();
+	    continue;
+	}
+	std::vector<double> gamma( m );
+	for ( size_t i = m; i-- > 0; ) {
+	    double sum = a[i][m];
+	    for ( size_t j = i + 1; j < m; ++j ) sum -= a[i][j] * gamma[j];
+	    gamma[i] = sum / a[i][i];
+	}
+
+	x = g;
+	for ( size_t i = 0; i < m; ++i ) {
+	    for ( size_t j = 0; j < x.size(); ++j ) x[j] -= gamma[i] * _dg[i][j];
+	}
+	return std::all_of( x.begin(), x.end(), []( double w ){ return std::isfinite( w ) && w >= 0.0; } );
+    }
+    return false;
+}
+
+
+/*
+ * Collect the values to mix.  Non-finite values are returned as zero
+ * and flagged in skip.
+ */
+
+std::vector<double>
+Model::Accelerator::get( std::vector<bool>& skip ) const
+{
+    std::vector<double> x;
+    for ( const auto task : _tasks ) {
+	x.push_back( task->thinkTime() );
+    }
+    for ( const auto entry : _entries ) {
+	x.push_back( entry->throughput() );
+    }
+    for ( const auto phase : _phases ) {
+	for ( unsigned n = 1; n <= phase->getWaitSize(); ++n ) {
+	    x.push_back( phase->getWaitTime( n ) );
+	}
+    }
+    skip.resize( x.size() );
+    for ( size_t j = 0; j < x.size(); ++j ) {
+	skip[j] = !std::isfinite( x[j] );
+	if ( skip[j] ) x[j] = 0.0;
+    }
+    return x;
+}
+
+
+void
+Model::Accelerator::set( const std::vector<double>& x, const std::vector<bool>& skip ) const
+{
+    size_t j = 0;
+    for ( const auto task : _tasks ) {
+	if ( !skip[j] ) task->setThinkTime( x[j] );
+	j += 1;
+    }
+    for ( const auto entry : _entries ) {
+	if ( !skip[j] ) entry->saveThroughput( x[j] );
+	j += 1;
+    }
+    for ( const auto phase : _phases ) {
+	for ( unsigned n = 1; n <= phase->getWaitSize(); ++n, ++j ) {
+	    if ( !skip[j] ) phase->setWaitTime( n, x[j] );
+	}
+    }
+}
+
+
 void
 Model::insertDOMResults() const
 {
-    std::for_each( __task.begin(), __task.end(), std::mem_fn( &Task::insertDOMResults ) );
-    std::for_each( __processor.begin(), __processor.end(), std::mem_fn( &Processor::insertDOMResults ) );
-    std::for_each( __group.begin(), __group.end(), std::mem_fn( &Group::insertDOMResults ) );
+    std::for_each( __context->tasks.begin(), __context->tasks.end(), std::mem_fn( &Task::insertDOMResults ) );
+    std::for_each( __context->processors.begin(), __context->processors.end(), std::mem_fn( &Processor::insertDOMResults ) );
+    std::for_each( __context->groups.begin(), __context->groups.end(), std::mem_fn( &Group::insertDOMResults ) );
 }
 
 
@@ -974,7 +1399,7 @@ Model::printSubmodelWait( std::ostream& output ) const
     output << std::setw(8) <<  "Submodel    ";
     for ( unsigned i = 1; i <= nSubmodels(); ++i ) output << std::setw(8) << i;
     output << std::endl;
-    for ( const auto task : __task ) task->printSubmodelWait( output );
+    for ( const auto task : __context->tasks ) task->printSubmodelWait( output );
 
     output.setf( flags );
     output.precision( precision );
@@ -998,10 +1423,10 @@ Model::printOvertaking( std::ostream& output ) const
     }
     output << std::endl;
 
-    for ( std::set<Task *>::const_iterator nextServer = __task.begin(); nextServer != __task.end(); ++nextServer ) {
+    for ( std::set<Task *>::const_iterator nextServer = __context->tasks.begin(); nextServer != __context->tasks.end(); ++nextServer ) {
 	const Task * aServer = *nextServer;
 	if ( aServer->markovOvertaking() ) {
-	    for ( std::set<Task *>::const_iterator nextClient = __task.begin(); nextClient != __task.end(); ++nextClient ) {
+	    for ( std::set<Task *>::const_iterator nextClient = __context->tasks.begin(); nextClient != __context->tasks.end(); ++nextClient ) {
 		const Task * aClient = *nextClient;
 		Overtaking overtaking( aClient, aServer );
 		output << overtaking;
@@ -1028,7 +1453,7 @@ Model::topologicalSort()
 
     /* Only do reference tasks or those with open arrivals */
 
-    for ( std::set<Task *>::const_iterator task = __task.begin(); task != __task.end(); ++task ) {
+    for ( std::set<Task *>::const_iterator task = __context->tasks.begin(); task != __context->tasks.end(); ++task ) {
 	Call::stack callStack;
 	switch ( (*task)->rootLevel() ) {
 	case Task::root_level_t::IS_REFERENCE: (*task)->setSubmodel( 1 ); break;
@@ -1083,31 +1508,31 @@ MOL_Model::addToSubmodel()
 {
     /* Tasks go in submodels 1 - (_max_depth-1). */
 
-    for ( std::set<Task *>::const_iterator task = __task.begin(); task != __task.end(); ++task ) {
+    for ( std::set<Task *>::const_iterator task = __context->tasks.begin(); task != __context->tasks.end(); ++task ) {
 	if ( !(*task)->isReferenceTask() ) {
 	    const unsigned int i = (*task)->submodel();
 	    if ( i == 0 ) continue;
 	    _submodels[i]->addServer( *task );
 	}
 	if ( (*task)->hasForks() ) {
-	    _submodels[__sync_submodel]->addClient( *task );
+	    _submodels[__context->sync_submodel]->addClient( *task );
 	}
 	if ( (*task)->hasSyncs() ) {
-	    _submodels[__sync_submodel]->addServer( *task );
+	    _submodels[__context->sync_submodel]->addServer( *task );
 	}
     }
 
     /* Processors and other devices go in submodel n */
 
-    for ( std::set<Processor *>::const_iterator processor = __processor.begin(); processor != __processor.end(); ++processor ) {
+    for ( std::set<Processor *>::const_iterator processor = __context->processors.begin(); processor != __context->processors.end(); ++processor ) {
 	if ( (*processor)->submodel() == 0 ) continue;
 	(*processor)->setSubmodel( _HWSubmodel );		// Force all devices to this level
 	_submodels[_HWSubmodel]->addServer( *processor );
     }
 
-    if ( __think_server ) {
-	__think_server->setSubmodel( _HWSubmodel );		// Force all devices to this level
-	_submodels[_HWSubmodel]->addServer(__think_server);
+    if ( __context->think_server ) {
+	__context->think_server->setSubmodel( _HWSubmodel );		// Force all devices to this level
+	_submodels[_HWSubmodel]->addServer(__context->think_server);
     }
 }
 
@@ -1123,6 +1548,7 @@ MOL_Model::run()
 {
     const bool verbose = flags.trace_convergence || Options::Trace::verbose();
     SolveSubmodel solveSubmodel( *this, verbose );		/* Helper class for iterator */
+    Accelerator accelerate( __context->tasks );
 
     double delta = 0.0;
     do {
@@ -1132,10 +1558,11 @@ MOL_Model::run()
 
 	    std::for_each( _submodels.begin(), &_submodels[_HWSubmodel], solveSubmodel );
 
-	    delta = sqrt( std::accumulate( __task.begin(), __task.end(), 0.0, []( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ) / __task.size() );		/* RMS */
+	    delta = sqrt( std::accumulate( __context->tasks.begin(), __context->tasks.end(), 0.0, []( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ) / __context->tasks.size() );		/* RMS */
 
 	    if ( delta > convergenceValue() ) {
 		backPropogate();
+		accelerate();
 	    }
 	} while ( delta > convergenceValue() &&  _iterations < iterationLimit() );		/* -- Step 4 -- */
 
@@ -1152,15 +1579,16 @@ MOL_Model::run()
 	/* Solve hardware model. */
 
 	solveSubmodel( _submodels[_HWSubmodel] );		/* -- Step 6 -- */
+	accelerate.reset();
 
 	if ( flags.trace_wait ) {
 	    printSubmodelWait();
 	}
 
-	delta = sqrt( std::accumulate( __processor.begin(), __processor.end(), 0.0, []( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ) / __processor.size() );		/* RMS */
+	delta = sqrt( std::accumulate( __context->processors.begin(), __context->processors.end(), 0.0, []( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ) / __context->processors.size() );		/* RMS */
 	if ( verbose ) std::cerr << " [" << delta << "]" << std::endl;
 
-    } while ( ( _iterations < flags.min_steps || delta > convergenceValue() ) && _iterations < iterationLimit() );
+    } while ( ( _iterations < flags.min_steps || delta > convergenceValue() ) && _iterations < iterationLimit() && !warmStartFailed( delta ) );
 
     _converged = (delta <= convergenceValue() || _iterations == 1);	/* The model will never be converged with one step, so ignore */
     return delta;
@@ -1209,30 +1637,30 @@ Batch_Model::assignSubmodel()
 void
 Batch_Model::addToSubmodel()
 {
-    for ( std::set<Task *>::const_iterator task = __task.begin(); task != __task.end(); ++task ) {
+    for ( std::set<Task *>::const_iterator task = __context->tasks.begin(); task != __context->tasks.end(); ++task ) {
 	if ( !(*task)->isReferenceTask() ) {
 	    const unsigned int i = (*task)->submodel();
 	    if ( i == 0 ) continue;
 	    _submodels[i]->addServer( *task );
 	}
 	if ( (*task)->hasForks() ) {
-	    _submodels[__sync_submodel]->addClient( *task );
+	    _submodels[__context->sync_submodel]->addClient( *task );
 	}
 	if ( (*task)->hasSyncs() ) { // Answer is always NO for now.
-	    _submodels[__sync_submodel]->addServer( *task );
+	    _submodels[__context->sync_submodel]->addServer( *task );
 	}
     }
 
-    for ( std::set<Processor *>::const_iterator processor = __processor.begin(); processor != __processor.end(); ++processor ) {
+    for ( std::set<Processor *>::const_iterator processor = __context->processors.begin(); processor != __context->processors.end(); ++processor ) {
 	const unsigned int i = (*processor)->submodel();
 	if ( i == 0 ) continue;		// Device not used.
 	_submodels[i]->addServer( *processor );
     }
 
-    if ( __think_server ) {
-	const unsigned int i = __think_server->submodel();
+    if ( __context->think_server ) {
+	const unsigned int i = __context->think_server->submodel();
 	if ( i > 0 ) {
-	    _submodels[i]->addServer( __think_server );
+	    _submodels[i]->addServer( __context->think_server );
 	}
     }
 }
@@ -1263,23 +1691,36 @@ Batch_Model::run()
 {
     double delta = 0.0;
     const bool verbose = (flags.trace_convergence || Options::Trace::verbose()) && !(Options::Trace::mva() || flags.trace_wait);
-    const double count = __task.size() + __processor.size();
+    const double count = __context->tasks.size() + __context->processors.size();
+
+    if ( parallel() ) {
+	findDependencies();
+    }
+    Accelerator accelerate( __context->tasks );
+    double elapsed = 0.0;			/* Seconds solving submodels.	*/
 
     do {
 	_iterations += 1;
 	if ( verbose ) std::cerr << "Iteration: " << _iterations << " ";
 
-	std::for_each( _submodels.begin(), _submodels.end(), SolveSubmodel( *this, verbose ) );
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if ( parallel() ) {
+	    solveSubmodels( verbose );
+	} else {
+	    std::for_each( _submodels.begin(), _submodels.end(), SolveSubmodel( *this, verbose ) );
+	}
+	elapsed += std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
 
 	/* compute convergence for next pass. */
 
-	delta = sqrt( std::accumulate( __processor.begin(), __processor.end(),
-				       std::accumulate( __task.begin(), __task.end(), 0.0,
+	delta = sqrt( std::accumulate( __context->processors.begin(), __context->processors.end(),
+				       std::accumulate( __context->tasks.begin(), __context->tasks.end(), 0.0,
 							[]( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ),
 				       []( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ) / count );		/* RMS */
 
 	if ( delta > convergenceValue() ) {
 	    backPropogate();
+	    accelerate();
 	}
 
 	if ( flags.trace_intermediate && _iterations % printInterval() == 0 ) {
@@ -1295,11 +1736,260 @@ Batch_Model::run()
 	} else if ( Options::Trace::verbose() || flags.trace_convergence ) {
 	    std::cerr << " [" << delta << "]" << std::endl;
 	}
-    } while ( ( _iterations < flags.min_steps || delta > convergenceValue() ) && _iterations < iterationLimit() );
+    } while ( ( _iterations < flags.min_steps || delta > convergenceValue() ) && _iterations < iterationLimit() && !warmStartFailed( delta ) );
     _converged = (delta <= convergenceValue() || _iterations == 1);	/* The model will never be converged with one step, so ignore */
+
+    if ( parallel() && Options::Trace::verbose() ) {
+	printCriticalPath( std::cerr, elapsed );
+    }
     return delta;
 }
 
+/*
+ * Solve the submodels of an iteration with a pool of threads.  A
+ * submodel is started once every earlier submodel that it depends on
+ * (see findDependencies()) has been solved.  Independent submodels
+ * neither read nor write each other's results, so the solution is the
+ * same as solving the submodels in order.  Errors and floating point
+ * exceptions raised by the workers are passed back to the caller.
+ * The workers share the caller's Model::Context.
+ */
+
+class Batch_Model::Scheduler
+{
+public:
+    Scheduler( Batch_Model& model, bool verbose )
+	: _model(model), _solve(model,verbose), _context(*Model::__context), _mutex(), _ready_cv(), _pending(model._predecessors),
+	  _ready(), _remaining(model.nSubmodels()), _error(), _env(), _raised(0)
+	{
+	    for ( unsigned i = 1; i <= model.nSubmodels(); ++i ) {
+		if ( _pending[i] == 0 ) _ready.insert( i );
+	    }
+	}
+
+    void operator()( unsigned n )
+	{
+	    std::vector<std::thread> threads;
+	    std::fegetenv( &_env );
+	    for ( unsigned i = 1; i < n; ++i ) {
+		threads.push_back( std::thread( &Scheduler::worker, this ) );
+	    }
+	    run();
+	    for ( std::vector<std::thread>::iterator thread = threads.begin(); thread != threads.end(); ++thread ) {
+		thread->join();
+	    }
+	    std::feraiseexcept( _raised );
+	    if ( _error ) {
+		std::rethrow_exception( _error );
+	    }
+	}
+
+private:
+    void worker()
+	{
+	    Context::Use use( _context );
+	    std::fesetenv( &_env );
+	    run();
+	    const int raised = std::fetestexcept( FE_ALL_EXCEPT );
+	    std::lock_guard<std::mutex> lock( _mutex );
+	    _raised |= raised;
+	}
+
+    void run()
+	{
+	    std::unique_lock<std::mutex> lock( _mutex );
+	    for ( ;; ) {
+		_ready_cv.wait( lock, [this]{ return !_ready.empty() || _remaining == 0 || _error; } );
+		if ( _remaining == 0 || _error ) return;
+		const unsigned i = *_ready.begin();		/* Lowest first, as in order. */
+		_ready.erase( _ready.begin() );
+		lock.unlock();
+		try {
+		    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		    _solve( _model._submodels[i] );
+		    _model._solve_time[i] += std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+		}
+		catch ( ... ) {
+		    lock.lock();
+		    if ( !_error ) _error = std::current_exception();
+		    _ready_cv.notify_all();
+		    return;
+		}
+		lock.lock();
+		_remaining -= 1;
+		for ( std::vector<unsigned>::const_iterator j = _model._successors[i].begin(); j != _model._successors[i].end(); ++j ) {
+		    _pending[*j] -= 1;
+		    if ( _pending[*j] == 0 ) _ready.insert( *j );
+		}
+		_ready_cv.notify_all();
+	    }
+	}
+
+private:
+    Batch_Model& _model;
+    SolveSubmodel _solve;
+    Context& _context;				/* Caller's model state.	*/
+    std::mutex _mutex;
+    std::condition_variable _ready_cv;		/* Submodel ready or all done.	*/
+    std::vector<unsigned> _pending;		/* Predecessors not yet solved.	*/
+    std::set<unsigned> _ready;			/* Submodels that can be solved.*/
+    unsigned _remaining;			/* Submodels not yet solved.	*/
+    std::exception_ptr _error;
+    std::fenv_t _env;				/* Caller's FP environment.	*/
+    int _raised;				/* FP exceptions from workers.	*/
+};
+
+
+
+/*
+ * Solve submodels concurrently unless tracing (which prints from
+ * within the submodels) is on.
+ */
+
+bool
+Batch_Model::parallel() const
+{
+    return _parallel
+	&& !(Options::Trace::mva() || Options::Trace::delta_wait() || flags.trace_wait || flags.trace_throughput || flags.trace_think_time || flags.single_step);
+}
+
+
+
+/*
+ * Submodel i must be solved after submodel j < i if one of them
+ * changes an entity that the other uses.  A submodel changes its
+ * clients and servers.  It also uses the tasks which call its
+ * servers (interlocking) and the tasks and processors that its
+ * servers call (variance).  Replicas are matched by name.
+ */
+
+void
+Batch_Model::findDependencies()
+{
+    const unsigned n = nSubmodels();
+    std::vector<std::set<std::string>> changes( n + 1 );
+    std::vector<std::set<std::string>> uses( n + 1 );
+    std::vector<unsigned> step( n + 1, 0 );		/* Longest chain to submodel.	*/
+    unsigned steps = 0;
+
+    _predecessors.assign( n + 1, 0 );
+    _successors.assign( n + 1, std::vector<unsigned>() );
+    _solve_time.assign( n + 1, 0.0 );
+    for ( unsigned i = 1; i <= n; ++i ) {
+	for ( const auto client : _submodels[i]->getClients() ) changes[i].insert( client->name() );
+	for ( const auto server : _submodels[i]->getServers() ) {
+	    changes[i].insert( server->name() );
+	    addCallers( uses[i], server );
+	    addCallees( uses[i], server );
+	}
+	uses[i].insert( changes[i].begin(), changes[i].end() );
+
+	for ( unsigned j = 1; j < i; ++j ) {
+	    if ( !intersects( changes[j], uses[i] ) && !intersects( uses[j], changes[i] ) ) continue;
+	    _predecessors[i] += 1;
+	    _successors[j].push_back( i );
+	    step[i] = std::max( step[i], step[j] );
+	}
+	step[i] += 1;
+	steps = std::max( steps, step[i] );
+    }
+
+    if ( Options::Trace::verbose() ) {
+	std::cerr << "Parallel: " << n << " submodels in " << steps << " steps." << std::endl;
+    }
+}
+
+
+/*
+ * Add the names of all tasks which call entity, directly or
+ * indirectly.  The clients of a processor are its tasks.
+ */
+
+void
+Batch_Model::addCallers( std::set<std::string>& names, const Entity * entity )
+{
+    std::set<Task *> callers;
+    entity->getClients( callers );
+    std::set<const Task *> clients( callers.begin(), callers.end() );
+    clients.insert( entity->tasks().begin(), entity->tasks().end() );
+    for ( const auto client : clients ) {
+	if ( names.insert( client->name() ).second ) addCallers( names, client );
+    }
+}
+
+
+/*
+ * Add the names of all tasks and processors called by entity, directly
+ * or indirectly.
+ */
+
+void
+Batch_Model::addCallees( std::set<std::string>& names, const Entity * entity )
+{
+    const Task * task = dynamic_cast<const Task *>(entity);
+    if ( task == nullptr ) return;
+
+    std::set<Entity *> servers;
+    std::for_each( task->entries().begin(), task->entries().end(), Entry::get_servers( servers ) );
+    std::for_each( task->activities().begin(), task->activities().end(), Phase::get_servers( servers ) );
+    for ( const auto server : servers ) {
+	if ( names.insert( server->name() ).second ) addCallees( names, server );
+    }
+}
+
+
+/*
+ * Print the time spent solving submodels and the longest chain of
+ * dependent submodels weighted by their solution times.  No number of
+ * threads can solve the submodels faster than that chain.
+ */
+
+void
+Batch_Model::printCriticalPath( std::ostream& output, double elapsed ) const
+{
+    const unsigned n = nSubmodels();
+    std::vector<double> finish( n + 1, 0.0 );		/* Earliest finish of submodel.	*/
+    for ( unsigned i = 1; i <= n; ++i ) {
+	finish[i] += _solve_time[i];
+	for ( std::vector<unsigned>::const_iterator j = _successors[i].begin(); j != _successors[i].end(); ++j ) {
+	    finish[*j] = std::max( finish[*j], finish[i] );
+	}
+    }
+    const double total = std::accumulate( _solve_time.begin(), _solve_time.end(), 0.0 );
+    const double critical = *std::max_element( finish.begin(), finish.end() );
+    output << "Parallel: " << elapsed << "s solving, " << total << "s in submodels, critical path " << critical << "s";
+    if ( critical > 0. ) {
+	output << " (at most " << total / critical << " times faster than serial)";
+    }
+    output << ", " << std::min( std::thread::hardware_concurrency(), n ) << " threads." << std::endl;
+}
+
+
+bool
+Batch_Model::intersects( const std::set<std::string>& a, const std::set<std::string>& b )
+{
+    return std::any_of( a.begin(), a.end(), [&]( const std::string& name ){ return b.find( name ) != b.end(); } );
+}
+
+
+
+/*
+ * Solve all submodels using up to one thread per core.  With one core,
+ * solve them in order, unless the submodels are being timed (-v).
+ */
+
+void
+Batch_Model::solveSubmodels( bool verbose )
+{
+    const unsigned n = std::min( std::thread::hardware_concurrency(), nSubmodels() );
+    if ( n < 2 && !Options::Trace::verbose() ) {
+	std::for_each( _submodels.begin(), _submodels.end(), SolveSubmodel( *this, verbose ) );
+    } else {
+	Scheduler scheduler( *this, verbose );
+	scheduler( n );
+    }
+}
+
 /*----------------------------------------------------------------------*/
 /*                      Back Propogate Batch Model                      */
 /*----------------------------------------------------------------------*/
@@ -1336,19 +2026,19 @@ SRVN_Model::assignSubmodel()
     /* Build the list of all servers for this model */
 
     std::set<Entity *> servers;
-    for ( std::set<Task *>::const_iterator task = __task.begin(); task != __task.end(); ++task ) {
+    for ( std::set<Task *>::const_iterator task = __context->tasks.begin(); task != __context->tasks.end(); ++task ) {
 	if ( (*task)->isReferenceTask() || (*task)->submodel() == 0 ) continue;
 	servers.insert( *task );
 	(*task)->setSubmodel( servers.size() );
     }
-    for ( std::set<Processor *>::const_iterator processor = __processor.begin(); processor != __processor.end(); ++processor ) {
+    for ( std::set<Processor *>::const_iterator processor = __context->processors.begin(); processor != __context->processors.end(); ++processor ) {
 	if ( (*processor)->submodel() == 0 ) continue;
 	servers.insert( *processor );
 	(*processor)->setSubmodel( servers.size() );
     }
-    if ( __think_server && __think_server->submodel() != 0 ) {
-        servers.insert( __think_server );
-	__think_server->setSubmodel( servers.size() );
+    if ( __context->think_server && __context->think_server->submodel() != 0 ) {
+        servers.insert( __context->think_server );
+	__context->think_server->setSubmodel( servers.size() );
     }
     return servers.size();
 }
@@ -1370,18 +2060,18 @@ Squashed_Model::assignSubmodel()
 
     /* Build the list of all servers for this model */
 
-    for ( std::set<Task *>::const_iterator task = __task.begin(); task != __task.end(); ++task ) {
+    for ( std::set<Task *>::const_iterator task = __context->tasks.begin(); task != __context->tasks.end(); ++task ) {
 	if ( !(*task)->isReferenceTask() && (*task)->submodel() > 1 ) {
 	    (*task)->setSubmodel( 1 );
 	}
     }
-    for ( std::set<Processor *>::const_iterator processor = __processor.begin(); processor != __processor.end(); ++processor ) {
+    for ( std::set<Processor *>::const_iterator processor = __context->processors.begin(); processor != __context->processors.end(); ++processor ) {
 	if ( (*processor)->submodel() > 1 ) {
 	    (*processor)->setSubmodel( 1 );
 	}
     }
-    if ( __think_server && __think_server->submodel() != 0 ) {
-        __think_server->setSubmodel( 1 );
+    if ( __context->think_server && __context->think_server->submodel() != 0 ) {
+        __context->think_server->setSubmodel( 1 );
     }
 
     return 1;
@@ -1404,18 +2094,18 @@ HwSw_Model::assignSubmodel()
 
     /* Build the list of all servers for this model */
 
-    for ( std::set<Task *>::const_iterator task = __task.begin(); task != __task.end(); ++task ) {
+    for ( std::set<Task *>::const_iterator task = __context->tasks.begin(); task != __context->tasks.end(); ++task ) {
 	if ( !(*task)->isReferenceTask() && (*task)->submodel() > 1 ) {
 	    (*task)->setSubmodel( 1 );
 	}
     }
-    for ( std::set<Processor *>::const_iterator processor = __processor.begin(); processor != __processor.end(); ++processor ) {
+    for ( std::set<Processor *>::const_iterator processor = __context->processors.begin(); processor != __context->processors.end(); ++processor ) {
 	if ( (*processor)->submodel() > 1 ) {
 	    (*processor)->setSubmodel( 2 );
 	}
     }
-    if ( __think_server && __think_server->submodel() != 0 ) {
-        __think_server->setSubmodel( 2 );
+    if ( __context->think_server && __context->think_server->submodel() != 0 ) {
+        __context->think_server->setSubmodel( 2 );
     }
 
     return 2;
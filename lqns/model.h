@@ -17,7 +17,11 @@
 #ifndef LQNS_MODEL_H
 #define	LQNS_MODEL_H
 
+#include <atomic>
+#include <mutex>
 #include <set>
+#include <string>
+#include <vector>
 #include <lqio/dom_document.h>
 #include <mva/vector.h>
 #include "report.h"
@@ -27,6 +31,7 @@ class Entity;
 class Entry;
 class Model;
 class MVA;
+class Pragma;
 class Processor;
 class Server;
 class Submodel;
@@ -45,9 +50,62 @@ private:
 	bool operator()(const Type * a, const Type * b) const { return a->name() < b->name() || a->getReplicaNumber() < b->getReplicaNumber(); }
     };
 
+public:
     typedef Model * (*create_func)( const LQIO::DOM::Document *, const std::filesystem::path&, const std::filesystem::path&, LQIO::DOM::Document::OutputFormat );
+
+    /*
+     * Everything global to the model being solved.  Each thread
+     * solving a model has its own context, so separate models can be
+     * solved at the same time.  Threads which help solve a model use
+     * the context of the thread that started them.  Not covered: the
+     * SPEX/LQX state (see __load_mutex), LQIO::io_vars,
+     * MVA::__bounds_limit, MVA::MOL_multiserver_underrelaxation and
+     * the Options, which stay process-wide.
+     */
+
+    class Context {
+    public:
+	class Use {				/* Install context on this thread. */
+	public:
+	    explicit Use( Context& );
+	    ~Use();
+
+	private:
+	    Use( const Use& ) = delete;
+	    Use& operator=( const Use& ) = delete;
+
+	    Context * const _context;		/* Restored on exit.	*/
+	    Pragma * const _pragma;
+	    LQIO::DOM::Document * const _document;
+	    const std::filesystem::path _input_file_name;
+	};
+
+	Context();
+	~Context();
+
+    private:
+	Context( const Context& ) = delete;
+	Context& operator=( const Context& ) = delete;
+
+    public:
+	std::set<Processor *,lt_replica<Processor>> processors;
+	std::set<Group *,lt_replica<Group>> groups;
+	std::set<Task *,lt_replica<Task>> tasks;
+	std::set<Entry *,lt_replica<Entry>> entries;
+	Processor * think_server;		/* Delay server for think times	*/
+	unsigned sync_submodel;			/* Level of special sync model. */
+	unsigned max_phases;			/* Maximum phase encountered.	*/
+	Pragma * pragma;			/* Owned.			*/
+	LQIO::DOM::Document * document;
+	std::filesystem::path input_file_name;	/* For error messages.	*/
+    };
     
+private:
+    class Solution;
+
 protected:
+    class Accelerator;
+
     class SolveSubmodel {
     public:
 	SolveSubmodel( Model& model, bool verbose ) : _model(model), _verbose(verbose) {}
@@ -82,7 +140,7 @@ public:
     bool initialize();
 
     unsigned nSubmodels() const { return _submodels.size(); }
-    static unsigned syncSubmodel() { return __sync_submodel; }
+    static unsigned syncSubmodel() { return __context->sync_submodel; }
     const Vector<Submodel *>& getSubmodels() const { return _submodels; }
 
     bool compute();
@@ -108,11 +166,12 @@ protected:
     double convergenceValue() const { return _convergence_value; }	/* Cached */
     unsigned iterationLimit() const { return _iteration_limit; }
     double underrelaxation() const;					/* Cached */
-    unsigned printInterval() const { return __print_interval; }
+    unsigned printInterval() const { return _print_interval; }
 
     virtual void backPropogate() {}
 
     virtual double run() = 0;			/* Solve Model.		*/
+    bool warmStartFailed( double );
 
     void printIntermediate( const double ) const;
 	
@@ -128,13 +187,12 @@ private:
 
 public:
     static LQIO::DOM::Document::InputFormat __input_format;
-    static std::set<Processor *,lt_replica<Processor>> __processor;
-    static std::set<Group *,lt_replica<Group>> __group;
-    static std::set<Task *,lt_replica<Task>> __task;
-    static std::set<Entry *,lt_replica<Entry>> __entry;
-    static Processor * __think_server;	/* Delay server for think times	*/
+    static thread_local Context * __context;
     static unsigned __print_interval;	/* for option processing	*/
 
+private:
+    static std::mutex __load_mutex;	/* Parsers and SPEX are not re-entrant.	*/
+
 protected:
     Vector<Submodel *> _submodels;
     bool _converged;			/* True if converged.		*/
@@ -144,13 +202,15 @@ protected:
     double _convergence_value;		/* Cached */
     unsigned _iteration_limit;		/* Cached */
     double _underrelaxation;		/* Cached */
-    
-protected:
-    static unsigned __sync_submodel;	/* Level of special sync model. */
+    unsigned _print_interval;		/* Cached */
     
 private:
-    unsigned long _step_count;		/* Number of solveLayers	*/
+    std::atomic<unsigned long> _step_count;	/* Number of solveLayers	*/
     bool _model_initialized;
+    bool _warm_start;			/* Started from last solution.	*/
+    unsigned long _cold_iterations;	/* Of the last cold start.	*/
+    double _last_delta;			/* Of the previous iteration.	*/
+    unsigned _growth;			/* Iterations delta has grown.	*/
     const LQIO::DOM::Document * _document;
     const std::filesystem::path _input_file_name;
     const std::filesystem::path _output_file_name;
@@ -200,15 +260,33 @@ protected:
 class Batch_Model :  public Model {
     friend class Model;		/* Allows use of constructor within class Model */
 
+    class Scheduler;
+
 protected:
-    Batch_Model( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) : Model( document, inputFileName, outputFileName, outputFormat ) {}
+    Batch_Model( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat, bool parallel=false ) : Model( document, inputFileName, outputFileName, outputFormat ), _parallel(parallel), _predecessors(), _successors(), _solve_time() {}
 
     static Model * create( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) { return new Batch_Model( document, inputFileName, outputFileName, outputFormat ); }
+    static Model * createParallel( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) { return new Batch_Model( document, inputFileName, outputFileName, outputFormat, true ); }
 
     virtual unsigned assignSubmodel();
     virtual void addToSubmodel();
     virtual void partition();
     virtual double run();
+
+private:
+    bool parallel() const;
+    void findDependencies();
+    void solveSubmodels( bool verbose );
+    void printCriticalPath( std::ostream&, double ) const;
+    static void addCallers( std::set<std::string>&, const Entity * );
+    static void addCallees( std::set<std::string>&, const Entity * );
+    static bool intersects( const std::set<std::string>&, const std::set<std::string>& );
+
+private:
+    const bool _parallel;		/* Solve independent submodels concurrently.	*/
+    std::vector<unsigned> _predecessors;		/* Number of submodels to solve first.	*/
+    std::vector<std::vector<unsigned>> _successors;	/* Submodels to solve after.		*/
+    std::vector<double> _solve_time;			/* Seconds spent in each submodel.	*/
 };
 
 
@@ -232,9 +310,10 @@ class SRVN_Model : public Batch_Model {
     friend class Model;		/* Allows use of constructor within class Model */
 
 protected:
-    SRVN_Model( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) : Batch_Model( document, inputFileName, outputFileName, outputFormat ) {}
+    SRVN_Model( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat, bool parallel=false ) : Batch_Model( document, inputFileName, outputFileName, outputFormat, parallel ) {}
 
     static Model * create( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) { return new SRVN_Model( document, inputFileName, outputFileName, outputFormat ); }
+    static Model * createParallel( const LQIO::DOM::Document * document, const std::filesystem::path& inputFileName, const std::filesystem::path& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) { return new SRVN_Model( document, inputFileName, outputFileName, outputFormat, true ); }
 
     virtual unsigned assignSubmodel();
 };
@@ -441,7 +441,7 @@ void
 Options::Special::print_interval( const std::string& arg )
 {
     char * endptr = nullptr;
-    if ( !arg.empty() && (Model::__print_interval = (unsigned)strtol( arg.c_str(), &endptr, 10 )) == 0 || *endptr != '\0' ) {
+    if ( !arg.empty() && ((Model::__print_interval = (unsigned)strtol( arg.c_str(), &endptr, 10 )) == 0 || *endptr != '\0') ) {
 	throw std::invalid_argument( std::string( "print-interval=<n> where n=\"" ) + arg + "\".  Choose an integer greater than 0." );
     }
     flags.trace_intermediate = true;
@@ -23,6 +23,7 @@
 #include <lqio/srvn_output.h>
 #include "entry.h"
 #include "flags.h"
+#include "model.h"
 #include "overtake.h"
 #include "task.h"
 
@@ -277,7 +278,7 @@ Overtaking::PrintHelper::operator()( const Entry& entA, const Entry& entB, const
     }
     _output << " " << j << "  ";
 	
-    for ( i = 1; i <= Entry::max_phases; ++i ) {
+    for ( i = 1; i <= Model::__context->max_phases; ++i ) {
 	_output << std::setw(LQIO::SRVN::ObjectOutput::__maxDblLen-1) << pr[i] << " ";
     }
     _output << "OT" << std::endl;
@@ -327,7 +328,7 @@ Overtaking::printStart( std::ostream& output,
  */
 
 Overtaking::ijInfo::ijInfo() :
-    _rendezvous( Entry::max_phases )
+    _rendezvous( Model::__context->max_phases )
 {
 }
 	
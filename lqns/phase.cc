@@ -1521,7 +1521,7 @@ Phase::initializeProcessor()
      */
 
     if ( hasThinkTime() ) {
-	const std::string entry_name = Model::__think_server->name() + ":" + name();
+	const std::string entry_name = Model::__context->think_server->name() + ":" + name();
 	_devices.push_back( new DeviceInfo( *this, entry_name, DeviceInfo::Type::THINK_TIME ) );
     }
 
@@ -1556,13 +1556,13 @@ Phase::DeviceInfo::DeviceInfo( const Phase& phase, const std::string& name, Type
 	    .setPriority( phase.owner()->priority() );
 	visits = new LQIO::DOM::ConstantExternalVariable( n_processor_calls() );
     } else {
-	_entry = new DeviceEntry( _entry_dom, Model::__think_server );
+	_entry = new DeviceEntry( _entry_dom, Model::__context->think_server );
 	_entry->setServiceTime( think_time() )
 	    .setCV_sqr( 1.0 )
 	    .initVariance();
 	visits = new LQIO::DOM::ConstantExternalVariable( 1.0 );
     }
-    assert( Model::__entry.insert( _entry ).second == true );
+    assert( Model::__context->entries.insert( _entry ).second == true );
 		
     /*
      * We may have to change this at some point.  However, we can't do
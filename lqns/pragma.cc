@@ -12,16 +12,19 @@
  */
 
 #include "lqns.h"
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <iomanip>
+#include <thread>
 #include <lqio/glblerr.h>
 #include "pragma.h"
 
 LQIO::DOM::Pragma pragmas;
-Pragma * Pragma::__cache = nullptr;
+thread_local Pragma * Pragma::__cache = nullptr;
 const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
 {
+    { LQIO::DOM::Pragma::_acceleration_,		&Pragma::setAcceleration },
     { LQIO::DOM::Pragma::_convergence_value_,		&Pragma::setConvergenceValue },
     { LQIO::DOM::Pragma::_cycles_,			&Pragma::setAllowCycles },
     { LQIO::DOM::Pragma::_force_infinite_,		&Pragma::setForceInfinite },
@@ -43,6 +46,7 @@ const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
 #if RESCHEDULE
     { LQIO::DOM::Pragma::_reschedule_on_async_send_,	&Pragma::setRescheduleOnAsyncSend },
 #endif
+    { LQIO::DOM::Pragma::_reuse_tolerance_,		&Pragma::setReuseTolerance },
     { LQIO::DOM::Pragma::_save_marginal_probabilities_, &Pragma::setSaveMarginalProbabilities },
     { LQIO::DOM::Pragma::_severity_level_,		&Pragma::setSeverityLevel },
     { LQIO::DOM::Pragma::_spex_comment_,		&Pragma::setSpexComment },
@@ -50,12 +54,14 @@ const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
     { LQIO::DOM::Pragma::_spex_header_,			&Pragma::setSpexHeader },
     { LQIO::DOM::Pragma::_spex_iteration_limit_,	&Pragma::setSpexIterationLimit },
     { LQIO::DOM::Pragma::_spex_underrelaxation_,	&Pragma::setSpexUnderrelaxation },
+    { LQIO::DOM::Pragma::_spex_workers_,		&Pragma::setSpexWorkers },
     { LQIO::DOM::Pragma::_stop_on_bogus_utilization_,	&Pragma::setStopOnBogusUtilization },
     { LQIO::DOM::Pragma::_stop_on_message_loss_,	&Pragma::setStopOnMessageLoss },
     { LQIO::DOM::Pragma::_task_scheduling_,		&Pragma::setTaskScheduling },
     { LQIO::DOM::Pragma::_tau_,				&Pragma::setTau },
     { LQIO::DOM::Pragma::_threads_,			&Pragma::setThreads },
-    { LQIO::DOM::Pragma::_variance_,			&Pragma::setVariance }
+    { LQIO::DOM::Pragma::_variance_,			&Pragma::setVariance },
+    { LQIO::DOM::Pragma::_warm_start_,			&Pragma::setWarmStart }
 };
 
 /*
@@ -63,6 +69,7 @@ const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
  */
 
 Pragma::Pragma() :
+    _acceleration(Acceleration::NONE),
     _allow_cycles(false),
     _convergence_value(0.0),
     _exponential_paths(false),
@@ -88,6 +95,7 @@ Pragma::Pragma() :
 #if RESCHEDULE
     _reschedule_on_async_send(false),
 #endif
+    _reuse_tolerance(0.),
     _save_marginal_probabilities(false),
     _severity_level(LQIO::error_severity::ALL),
     _spex_comment(false),
@@ -95,6 +103,7 @@ Pragma::Pragma() :
     _spex_header(true),
     _spex_iteration_limit(0),
     _spex_underrelaxation(1.0),
+    _spex_workers(1),
     _stop_on_bogus_utilization(0.),		/* Not a bool.	U > nn */
     _stop_on_message_loss(true),
     _task_scheduling(SCHEDULE_FIFO),
@@ -102,6 +111,7 @@ Pragma::Pragma() :
     _threads(Threads::HYPER),
     _underrelaxation(0.),
     _variance(Variance::DEFAULT),
+    _warm_start(false),
     /* Bonus */
     _default_processor_scheduling(true),
     _default_task_scheduling(true),
@@ -136,6 +146,22 @@ Pragma::set( const std::map<std::string,std::string>& list )
 
 
 
+void Pragma::setAcceleration(const std::string& value )
+{
+    static const std::map<const std::string,const Acceleration> __acceleration_pragma = {
+	{ LQIO::DOM::Pragma::_anderson_,	Acceleration::ANDERSON },
+	{ LQIO::DOM::Pragma::_none_,		Acceleration::NONE }
+    };
+
+    const std::map<const std::string,const Acceleration>::const_iterator pragma = __acceleration_pragma.find( value );
+    if ( pragma != __acceleration_pragma.end() ) {
+	_acceleration = pragma->second;
+    } else {
+	throw std::invalid_argument( value );
+    }
+}
+
+
 void Pragma::setAllowCycles(const std::string& value )
 {
     _allow_cycles = LQIO::DOM::Pragma::isTrue(value );
@@ -203,12 +229,14 @@ void Pragma::setIterationLimit(const std::string& value )
 const std::map<const std::string,const Pragma::Layering> Pragma::__layering_pragma = {
     { LQIO::DOM::Pragma::_batched_,		Pragma::Layering::BATCHED },
     { LQIO::DOM::Pragma::_batched_back_,	Pragma::Layering::BACKPROPOGATE_BATCHED },
+    { LQIO::DOM::Pragma::_batched_parallel_,	Pragma::Layering::BATCHED_PARALLEL },
     { LQIO::DOM::Pragma::_hwsw_,		Pragma::Layering::HWSW },
     { LQIO::DOM::Pragma::_mol_,			Pragma::Layering::METHOD_OF_LAYERS },
     { LQIO::DOM::Pragma::_mol_back_,		Pragma::Layering::BACKPROPOGATE_METHOD_OF_LAYERS },
     { LQIO::DOM::Pragma::_processor_,		Pragma::Layering::BATCHED },	/* For lqn2ps	*/
     { LQIO::DOM::Pragma::_squashed_,		Pragma::Layering::SQUASHED },
-    { LQIO::DOM::Pragma::_srvn_,		Pragma::Layering::SRVN }
+    { LQIO::DOM::Pragma::_srvn_,		Pragma::Layering::SRVN },
+    { LQIO::DOM::Pragma::_srvn_parallel_,	Pragma::Layering::SRVN_PARALLEL }
 };
 
 const std::string& Pragma::getLayeringStr()
@@ -419,6 +447,14 @@ void Pragma::setRescheduleOnAsyncSend(const std::string& value )
 #endif
 
 
+void Pragma::setReuseTolerance(const std::string& value )
+{
+    char * endptr = nullptr;
+    _reuse_tolerance = std::strtod( value.c_str(), &endptr );
+    if ( _reuse_tolerance < 0 || *endptr != '\0' ) throw std::domain_error( value );
+}
+
+
 void Pragma::setSaveMarginalProbabilities(const std::string& value )
 {
     _save_marginal_probabilities = LQIO::DOM::Pragma::isTrue( value );
@@ -461,6 +497,15 @@ void Pragma::setSpexUnderrelaxation(const std::string& value )
 }
 
 
+void Pragma::setSpexWorkers(const std::string& value )
+{
+    char * endptr = nullptr;
+    const long workers = std::strtol( value.c_str(), &endptr, 10 );
+    if ( workers < 0 || *endptr != '\0' ) throw std::domain_error( value );
+    _spex_workers = workers > 0 ? workers : std::max( std::thread::hardware_concurrency(), 1U );
+}
+
+
 void Pragma::setSeverityLevel(const std::string& value )
 {
     _severity_level = LQIO::DOM::Pragma::getSeverityLevel( value );
@@ -515,6 +560,11 @@ void Pragma::setUnderrelaxation(const std::string& value )
     if ( (_underrelaxation <= 0 || 1 < _underrelaxation) || *endptr != '\0' ) throw std::domain_error( value );
 }
 
+void Pragma::setWarmStart(const std::string& value )
+{
+    _warm_start = LQIO::DOM::Pragma::isTrue( value );
+}
+
 void Pragma::setThreads(const std::string& value )
 {
     static const std::map<const std::string,const Pragma::Threads> __threads_pragma = {
@@ -566,9 +616,11 @@ Pragma::usage( std::ostream& output )
 	{ LQIO::DOM::Pragma::_convergence_value_,	    "<n.n>" },
 	{ LQIO::DOM::Pragma::_iteration_limit_,		    "<n>" },
 	{ LQIO::DOM::Pragma::_mol_underrelaxation_,	    "<n.n>" },
+	{ LQIO::DOM::Pragma::_reuse_tolerance_,	    "<n.n>" },
 	{ LQIO::DOM::Pragma::_spex_convergence_,	    "<n.n>" },
 	{ LQIO::DOM::Pragma::_spex_iteration_limit_,	    "<n>" },
 	{ LQIO::DOM::Pragma::_spex_underrelaxation_,	    "<n.n>" },
+	{ LQIO::DOM::Pragma::_spex_workers_,		    "<n>" },
 	{ LQIO::DOM::Pragma::_stop_on_bogus_utilization_,   "<n.n>" },
 	{ LQIO::DOM::Pragma::_tau_,			    "<n>" }
     };
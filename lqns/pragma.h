@@ -30,13 +30,15 @@ extern LQIO::DOM::Pragma pragmas;
 
 class Pragma {
     friend class Generate;
+    friend class Model;			/* Model::Context installs pragmas. */
     
 public:
     typedef void (Pragma::*fptr)(const std::string&);
 
+    enum class Acceleration { NONE, ANDERSON };
     enum class ForceInfinite { NONE, FIXED_RATE, MULTISERVERS, ALL };
     enum class ForceMultiserver { NONE, PROCESSORS, TASKS, ALL };
-    enum class Layering { BACKPROPOGATE_BATCHED, BATCHED, METHOD_OF_LAYERS, BACKPROPOGATE_METHOD_OF_LAYERS, SRVN, SQUASHED, HWSW };
+    enum class Layering { BACKPROPOGATE_BATCHED, BATCHED, BATCHED_PARALLEL, METHOD_OF_LAYERS, BACKPROPOGATE_METHOD_OF_LAYERS, SRVN, SRVN_PARALLEL, SQUASHED, HWSW };
     enum class MVA { LINEARIZER, EXACT, SCHWEITZER, FAST, ONESTEP, ONESTEP_LINEARIZER };
     enum class Multiserver { DEFAULT, CONWAY, EXPERIMENTAL, REISER, REISER_PS, ROLIA, ROLIA_PS, BRUELL, SCHMIDT, SURI, ZHOU };
     enum class Overtaking { MARKOV, ROLIA, SIMPLE, SPECIAL, NONE };
@@ -53,17 +55,23 @@ private:
     Pragma();
     virtual ~Pragma()
 	{
-	    __cache = nullptr;
+	    if ( __cache == this ) __cache = nullptr;
 	}
 
 public:
+    static Acceleration acceleration()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_acceleration;
+	}
+
     static bool allowCycles()
 	{
 	    assert( __cache != nullptr );
 	    return __cache->_allow_cycles;
 	}
 
-    static unsigned int convergenceValue()
+    static double convergenceValue()
 	{
 	    assert( __cache != nullptr );
 	    return __cache->_convergence_value;
@@ -234,12 +242,24 @@ public:
 	    return __cache->_spex_underrelaxation;
 	}
 
+    static unsigned int spexWorkers()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_spex_workers;
+	}
+
     static bool stopOnMessageLoss()
 	{
 	    assert( __cache != nullptr );
 	    return __cache->_stop_on_message_loss;
 	}
 
+    static double reuseTolerance()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_reuse_tolerance;
+	}
+
     static double stopOnBogusUtilization()
 	{
 	    assert( __cache != nullptr );
@@ -293,6 +313,12 @@ public:
 	    return variance() == arg;
 	}
 
+    static bool warmStart()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_warm_start;
+	}
+
     static bool entry_variance()
 	{
 	    assert( __cache != nullptr );
@@ -306,6 +332,7 @@ public:
 	}
 
 private:
+    void setAcceleration(const std::string&);
     void setAllowCycles(const std::string&);
     void setConvergenceValue(const std::string&);
     void setExponential_paths(const std::string&);
@@ -331,6 +358,7 @@ private:
 #if RESCHEDULE
     void setRescheduleOnAsyncSend(const std::string&);
 #endif
+    void setReuseTolerance(const std::string&);
     void setSaveMarginalProbabilities(const std::string&);
     void setSeverityLevel(const std::string&);
     void setSpexComment(const std::string&);
@@ -338,6 +366,7 @@ private:
     void setSpexHeader(const std::string&);
     void setSpexIterationLimit(const std::string&);
     void setSpexUnderrelaxation(const std::string&);
+    void setSpexWorkers(const std::string&);
     void setStopOnBogusUtilization(const std::string&);
     void setStopOnMessageLoss(const std::string&);
     void setTaskScheduling(const std::string&);
@@ -345,6 +374,7 @@ private:
     void setThreads(const std::string&);
     void setUnderrelaxation(const std::string&);
     void setVariance(const std::string&);
+    void setWarmStart(const std::string&);
 
 public:
     static void set( const std::map<std::string,std::string>& );
@@ -352,6 +382,7 @@ public:
     static const std::map<const std::string,const Pragma::fptr>& getPragmas() { return __set_pragma; }
 
 private:
+    Acceleration _acceleration;
     bool _allow_cycles;
     double _convergence_value;
     bool _exponential_paths;
@@ -377,6 +408,7 @@ private:
 #if RESCHEDULE
     bool _reschedule_on_async_send;
 #endif
+    double _reuse_tolerance;
     bool _save_marginal_probabilities;
     LQIO::error_severity _severity_level;
     bool _spex_comment;
@@ -384,6 +416,7 @@ private:
     bool _spex_header;
     unsigned int _spex_iteration_limit;
     double _spex_underrelaxation;
+    unsigned int _spex_workers;
     double _stop_on_bogus_utilization;
     bool _stop_on_message_loss;
     scheduling_type _task_scheduling;
@@ -391,6 +424,7 @@ private:
     Threads _threads;
     double _underrelaxation;
     Variance _variance;
+    bool _warm_start;
     /* bonus */
     bool _default_processor_scheduling;
     bool _default_task_scheduling;
@@ -399,7 +433,7 @@ private:
 
     /* --- */
 
-    static Pragma * __cache;
+    static thread_local Pragma * __cache;	/* Pragmas of the model solved by this thread. */
     static const std::map<const std::string,const Pragma::fptr> __set_pragma;
     static const std::map<const std::string,const Pragma::Layering> __layering_pragma;
     static const std::map<const std::string,const Pragma::Multiserver> __multiserver_pragma;
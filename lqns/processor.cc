@@ -276,7 +276,7 @@ Processor::expand()
 {
     const unsigned int replicas = this->replicas();
     for ( unsigned int replica = 2; replica <= replicas; ++replica ) {
-	Model::__processor.insert( clone( replica ) );
+	Model::__context->processors.insert( clone( replica ) );
     }
     return *this;
 }
@@ -481,7 +481,7 @@ void Processor::create( const std::pair<std::string,LQIO::DOM::Processor*>& p )
     if ( Processor::find( name ) ) {
 	dom->runtime_error( LQIO::ERR_DUPLICATE_SYMBOL );
     } else {
-	Model::__processor.insert( new Processor( dom ) );
+	Model::__context->processors.insert( new Processor( dom ) );
     }
 }
 
@@ -494,8 +494,8 @@ void Processor::create( const std::pair<std::string,LQIO::DOM::Processor*>& p )
 Processor *
 Processor::find( const std::string& name, unsigned int replica )
 {
-    std::set<Processor *>::const_iterator processor = std::find_if( Model::__processor.begin(), Model::__processor.end(), EqualsReplica<Processor>( name, replica ) );
-    return ( processor != Model::__processor.end() ) ? *processor : nullptr;
+    std::set<Processor *>::const_iterator processor = std::find_if( Model::__context->processors.begin(), Model::__context->processors.end(), EqualsReplica<Processor>( name, replica ) );
+    return ( processor != Model::__context->processors.end() ) ? *processor : nullptr;
 }
 
 /*----------------------------------------------------------------------*/
@@ -222,7 +222,10 @@ MVASubmodel::MVASubmodel( const unsigned n )
       _openStation(),
       _closedModel(nullptr),
       _openModel(nullptr),
-      _overlapFactor()
+      _overlapFactor(),
+      _inputs(),
+      _waits(),
+      _fixedPoint(false)
 {
 }
 
@@ -377,6 +380,8 @@ MVASubmodel&
 MVASubmodel::rebuild()
 {
     remakeChains();
+    _inputs.clear();				/* Solve at least once.		*/
+    _fixedPoint = false;
 
     /* ------------------ Recreate servers for model. -----------------	*/
 
@@ -414,7 +419,7 @@ MVASubmodel::rebuild()
  *   1) starting from the first client, form a set of tasks consisting of all the servers and clients to those servers.  
  *   2) Repeat Using the next client not found in this set and form a second set.  Compare the two (or more) sets for
  *      intersection.  Non-intersecting sets which match based on name (but not replica) can be pruned.  Non intersecting
- *      sets that fail pruning can be partitioned into a new submodel.  Don't forget to ++__sync_submodel and renumber
+ *      sets that fail pruning can be partitioned into a new submodel.  Don't forget to ++sync_submodel and renumber
  *      all submodels.
  *   3) For pruned tasks, I believe the easiest thing to do for update is to copy the waiting times across in
  *      delta_wait. Multiplying Call::rendezvousDelay() doesn't seem to work.
@@ -946,48 +951,60 @@ MVASubmodel::solve( long iterations, MVACount& MVAStats, const double relax )
 
 	/* ----------------- Solve the model. ----------------- */
 
-	if ( hasClosedModel() ) {
+	const bool same_inputs = sameInputs();
+	if ( same_inputs && _fixedPoint ) {
 
-	    if ( _openModel ) {
+	    /* Nothing changed since the last solution, so use it again. */
+
+	    restoreWaits();
+
+	} else {
+
+	    if ( hasClosedModel() ) {
 
-		/* If model has any open classes, convert for closed model. */
+		if ( _openModel ) {
+
+		    /* If model has any open classes, convert for closed model. */
+
+		    try {
+			_openModel->convert( _customers );
+		    }
+		    catch ( const std::range_error& error ) {
+			MVAStats.faults += 1;
+			if ( Pragma::stopOnMessageLoss() && std::any_of( _servers.begin(), _servers.end(), std::mem_fn( &Entity::openModelInfinity ) ) ) {
+			    throw;
+			}
+		    }
+		}
 
 		try {
-		    _openModel->convert( _customers );
+		    _closedModel->solve();
 		}
 		catch ( const std::range_error& error ) {
-		    MVAStats.faults += 1;
-		    if ( Pragma::stopOnMessageLoss() && std::any_of( _servers.begin(), _servers.end(), std::mem_fn( &Entity::openModelInfinity ) ) ) {
-			throw;
-		    }
+		    throw;
 		}
-	    }
 
-	    try {
-		_closedModel->solve();
-	    }
-	    catch ( const std::range_error& error ) {
-		throw;
-	    }
-
-	    /* Statistics by level -- we can use this to find performance bottlenecks */
+		/* Statistics by level -- we can use this to find performance bottlenecks */
 
-	    MVAStats.accumulate( _closedModel->iterations(), _closedModel->waits(), _closedModel->faults() );
-	}
+		MVAStats.accumulate( _closedModel->iterations(), _closedModel->waits(), _closedModel->faults() );
+	    }
 
-	if ( _openModel ) {
-	    try {
-		if ( hasClosedModel() ) {
-		    _openModel->solve( *_closedModel, _customers );	/* Calculate L[0] queue lengths. */
-		} else {
-		    _openModel->solve();
-		}
-	    } 
-	    catch ( const std::range_error& error ) {
-		if ( Pragma::stopOnMessageLoss() && std::any_of( _servers.begin(), _servers.end(), std::mem_fn( &Entity::openModelInfinity ) ) ) {
-		    throw;
+	    if ( _openModel ) {
+		try {
+		    if ( hasClosedModel() ) {
+			_openModel->solve( *_closedModel, _customers );	/* Calculate L[0] queue lengths. */
+		    } else {
+			_openModel->solve();
+		    }
+		} 
+		catch ( const std::range_error& error ) {
+		    if ( Pragma::stopOnMessageLoss() && std::any_of( _servers.begin(), _servers.end(), std::mem_fn( &Entity::openModelInfinity ) ) ) {
+			throw;
+		    }
 		}
 	    }
+
+	    _fixedPoint = saveWaits( same_inputs );
 	}
 
 	if ( trace ) {
@@ -1056,6 +1073,131 @@ MVASubmodel::solve( long iterations, MVACount& MVAStats, const double relax )
     return *this;
 }
 
+/*
+ * Return true if the inputs to the stations and chains are within the
+ * reuse-tolerance of the inputs used the last time the submodel was
+ * solved.  Otherwise, save the inputs for the next time.  The inputs
+ * are only saved when they change, so small changes can't add up.
+ */
+
+bool
+MVASubmodel::sameInputs()
+{
+    if ( flags.reset_mva ) return false;
+
+    std::vector<double> inputs;
+    inputs.reserve( _inputs.size() );
+
+    const unsigned int K = nChains();
+    for ( unsigned int k = 1; k <= K; ++k ) {
+	inputs.push_back( _customers[k] );
+	inputs.push_back( _thinkTime[k] );
+	inputs.push_back( _priority[k] );
+	if ( _overlapFactor ) {
+	    for ( unsigned int j = 1; j <= K; ++j ) {
+		inputs.push_back( _overlapFactor[k][j] );
+	    }
+	}
+    }
+
+    for ( const Vector<Server *>* stations : { &_closedStation, &_openStation } ) {
+	for ( unsigned int m = 1; m <= stations->size(); ++m ) {
+	    const Server * station = (*stations)[m];
+	    if ( station == nullptr ) continue;
+	    for ( unsigned int e = 1; e <= station->nEntries(); ++e ) {
+		for ( unsigned int k = 0; k <= station->nClasses(); ++k ) {
+		    inputs.push_back( station->interlock( e, k, 1.0 ) );
+		    for ( unsigned int p = 0; p <= station->nPhases(); ++p ) {
+			inputs.push_back( station->S( e, k, p ) );
+			inputs.push_back( station->V( e, k, p ) );
+			inputs.push_back( station->getVariance( e, k, p ) );
+		    }
+		}
+	    }
+	}
+    }
+
+    /* Overtaking probabilities are found from the clients. */
+
+    for ( const Entity * server : _servers ) {
+	if ( !server->markovOvertaking() || server->serverStation() == nullptr ) continue;
+	const Server * station = server->serverStation();
+	for ( unsigned int e = 1; e <= station->nEntries(); ++e ) {
+	    Probability *** prOt = station->getPrOt( e );
+	    for ( unsigned int k = 1; k <= station->nClasses(); ++k ) {
+		for ( unsigned int i = 0; i <= MAX_PHASES; ++i ) {
+		    for ( unsigned int j = 0; j <= station->nPhases(); ++j ) {
+			inputs.push_back( prOt[k][i][j] );
+		    }
+		}
+	    }
+	}
+    }
+
+    if ( within_tolerance( inputs, _inputs ) ) return true;
+    _inputs.swap( inputs );
+    return false;
+}
+
+
+/*
+ * Save the waiting times at the stations, which are cleared when the
+ * stations are initialized (the rest of the solution is kept by the
+ * MVA solvers).  The approximate solvers start from their last
+ * solution, so solving again with the same inputs can still change
+ * the results.  Return true if the inputs were the same and the waits
+ * didn't change, in which case the solution can be used again.
+ */
+
+bool
+MVASubmodel::saveWaits( bool same_inputs )
+{
+    std::vector<double> waits;
+    waits.reserve( _waits.size() );
+    for ( const Vector<Server *>* stations : { &_closedStation, &_openStation } ) {
+	for ( unsigned int m = 1; m <= stations->size(); ++m ) {
+	    const Server * station = (*stations)[m];
+	    if ( station == nullptr ) continue;
+	    for ( unsigned int e = 1; e <= station->nEntries(); ++e ) {
+		for ( unsigned int k = 0; k <= station->nClasses(); ++k ) {
+		    waits.insert( waits.end(), &station->W[e][k][0], &station->W[e][k][MAX_PHASES+1] );
+		}
+	    }
+	}
+    }
+    const bool fixed_point = same_inputs && within_tolerance( waits, _waits );
+    _waits.swap( waits );
+    return fixed_point;
+}
+
+
+bool
+MVASubmodel::within_tolerance( const std::vector<double>& a, const std::vector<double>& b )
+{
+    const double tolerance = Pragma::reuseTolerance();
+    return a.size() == b.size()
+	&& std::equal( a.begin(), a.end(), b.begin(), [=]( double x, double y ){ return std::fabs( x - y ) <= tolerance * std::max( std::fabs( x ), std::fabs( y ) ); } );
+}
+
+
+void
+MVASubmodel::restoreWaits() const
+{
+    std::vector<double>::const_iterator wait = _waits.begin();
+    for ( const Vector<Server *>* stations : { &_closedStation, &_openStation } ) {
+	for ( unsigned int m = 1; m <= stations->size(); ++m ) {
+	    const Server * station = (*stations)[m];
+	    if ( station == nullptr ) continue;
+	    for ( unsigned int e = 1; e <= station->nEntries(); ++e ) {
+		for ( unsigned int k = 0; k <= station->nClasses(); ++k ) {
+		    std::copy( wait, wait + MAX_PHASES + 1, &station->W[e][k][0] );
+		    wait += MAX_PHASES + 1;
+		}
+	    }
+	}
+    }
+}
+
 /* ----------------------------- Save Results ----------------------------- */
 
 
@@ -1221,8 +1363,8 @@ MVASubmodel::print( std::ostream& output ) const
     }
 
     output << std::endl << "Calls: " << std::endl;
-    for ( const auto entry : Model::__entry ) entry->printCalls( output, number() );
-    for ( const auto processor : Model::__processor ) processor->printTasks( output, number() );
+    for ( const auto entry : Model::__context->entries ) entry->printCalls( output, number() );
+    for ( const auto processor : Model::__context->processors ) processor->printTasks( output, number() );
     output << std::endl;
 
     return output;
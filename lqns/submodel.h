@@ -15,6 +15,7 @@
 
 
 #include <set>
+#include <vector>
 #include <mva/pop.h>
 #include <mva/server.h>
 #include <mva/vector.h>
@@ -93,6 +94,7 @@ public:
     bool hasServer( const Entity * server ) const { return _servers.find(const_cast<Entity *>(server)) != _servers.end(); }
 
     const std::set<Task *>& getClients() const { return _clients; }		/* Table of clients 		*/
+    const std::set<Entity *>& getServers() const { return _servers; }		/* Table of servers 		*/
     virtual const char * const submodelType() const = 0;
     unsigned number() const { return _submodel_number; }
 
@@ -264,6 +266,10 @@ private:
     bool isInOpenModel( const Server& station ) const { return _openModel != nullptr && station.openIndex != 0; }
 
     void initializeChains( Task* client ) const;
+    bool sameInputs();
+    bool saveWaits( bool );
+    void restoreWaits() const;
+    static bool within_tolerance( const std::vector<double>&, const std::vector<double>& );
 
 public:
 #if PAN_REPLICATION
@@ -298,5 +304,11 @@ private:
     /* Fork-Join stuff. */
 	
     Vector<double> * _overlapFactor;
+
+    /* Reuse of the last solution. */
+
+    std::vector<double> _inputs;	/* Inputs at the last solution.	*/
+    std::vector<double> _waits;		/* Waits at the last solution.	*/
+    bool _fixedPoint;			/* Solving again won't change it.	*/
 };
 #endif
@@ -694,7 +694,7 @@ Task::expand()
     const unsigned int replicas = this->replicas();
     for ( unsigned int replica = 2; replica <= replicas; ++replica ) {
 	Task * task = clone( replica );
-	Model::__task.insert( task );
+	Model::__context->tasks.insert( task );
 
 	const_cast<Processor *>(task->getProcessor())->addTask( task );
 	if ( task->getGroup() ) {
@@ -2188,7 +2188,7 @@ Task::create( LQIO::DOM::Task* dom, const std::vector<Entry *>& entries )
 	break;
     }
 
-    Model::__task.insert( task );		/* Insert into map */
+    Model::__context->tasks.insert( task );		/* Insert into map */
     processor->addTask( task );
     if ( group ) {
 	group->addTask( task );
@@ -2201,8 +2201,8 @@ Task::create( LQIO::DOM::Task* dom, const std::vector<Entry *>& entries )
 /* static */ Task *
 Task::find( const std::string& name, unsigned int replica )
 {
-    std::set<Task *>::const_iterator task = std::find_if( Model::__task.begin(), Model::__task.end(), EqualsReplica<Task>( name, replica ) );
-    return ( task != Model::__task.end() ) ? *task : nullptr;
+    std::set<Task *>::const_iterator task = std::find_if( Model::__context->tasks.begin(), Model::__context->tasks.end(), EqualsReplica<Task>( name, replica ) );
+    return ( task != Model::__context->tasks.end() ) ? *task : nullptr;
 }
 
 /*----------------------------------------------------------------------*/
@@ -73,6 +73,7 @@ Activity::Activity( Task * cp, LQIO::DOM::Phase * dom )
       r_proc_delay_sqr("Pr dly Sqr",dom),
       r_cycle("Cycle Time",dom),
       r_cycle_sqr("Cycle Sqred",dom),
+      r_cycle_hist(),
       r_afterQuorumThreadWait("afterQuorumThreadWait Raw Data",dom)
 {
     if ( dom && (dom->hasHistogram() || dom->hasMaxServiceTimeExceeded()) ) {
@@ -102,11 +103,7 @@ Activity::rename( const std::string& s )
 bool
 Activity::has_lost_messages() const
 {
-#if HAVE_PARASOL
     return std::any_of(_calls.begin(),_calls.end(), std::mem_fn( &Call::dropped_messages ) );
-#else
-    return false;
-#endif
 }
 
 double
@@ -144,15 +141,14 @@ Activity::configure()
 
     if ( !is_specified() ) return 0.0;
     
-#if HAVE_PARASOL
+    const std::string key = task()->name() + "/" + name();
+    _calls.name( key + ":calls" );
     const double n_calls = _calls.configure( type() );
-#else
-    const double n_calls = 0.;
-#endif
     
     if ( has_think_time() ) {
 	try { 
 	    _think_time = new Exponential( getDOM()->getThinkTimeValue() );
+	    _think_time->name( key + ":think" );
 	}
 	catch ( const std::domain_error& e ) {
 	    getDOM()->throw_invalid_parameter( "think time", e.what() );
@@ -185,6 +181,9 @@ Activity::configure()
     } else {
 	_slice_time = new HyperExponential( slice_time, cv_sqr() );
     }
+    if ( _slice_time != nullptr ) {
+	_slice_time->name( key + ":service" );
+    }
     if ( debug_flag ) {
 	print_debug_info();
     }
@@ -201,9 +200,7 @@ Activity&
 Activity::initialize()
 {
     if ( getDOM() != nullptr) {
-#if HAVE_PARASOL
 	_calls.initialize();
-#endif
     }
     return *this;
 }
@@ -288,11 +285,7 @@ double Activity::count_replies( ActivityList::Collect& data ) const
 double
 Activity::compute_minimum_service_time( std::deque<Entry *>& stack ) const
 {
-#if HAVE_PARASOL
     return get_service_time() + std::accumulate( _calls.begin(), _calls.end(), 0.0, [=]( double l, const Call& r ){ return l + r.compute_minimum_service_time(const_cast<std::deque<Entry *>&>(stack)); } );
-#else
-    return 0.0;
-#endif
 }
     
 
@@ -326,12 +319,11 @@ Activity::reset_stats()
 
     r_cycle.reset();
     r_cycle_sqr.reset();
+    r_cycle_hist.reset();
     r_service.reset();
     r_afterQuorumThreadWait.reset();	/* tomari quorum */
 
-#if HAVE_PARASOL
     _calls.reset_stats();
-#endif
  
     /* Histogram stuff */
  
@@ -368,9 +360,7 @@ Activity::accumulate_data()
 	r_cpu_util.accumulate();
     }
     r_cycle_sqr.accumulate_variance( r_cycle.accumulate() );	/* Do last! */
-#if HAVE_PARASOL
     _calls.accumulate_data();
-#endif
 
     /* Histogram stuff */
 
@@ -409,9 +399,7 @@ Activity::add_calls()
 	} else if ( domCall->getCallType() == LQIO::DOM::Call::Type::SEND_NO_REPLY && !destEntry->test_and_set_recv( Entry::Type::SEND_NO_REPLY ) ) {
 	    continue;
 	} else if ( !destEntry->task()->is_reference_task()) {
-#if HAVE_PARASOL
 	    _calls.store_target_info( destEntry, domCall );
-#endif
 	}
     }
     return *this;
@@ -564,7 +552,6 @@ Activity::print_debug_info()
 
     if ( _calls.size() > 0 ) {
 	fprintf( stddbg, "\tcalls:  " );
-#if HAVE_PARASOL
 	for ( Targets::const_iterator tp = _calls.begin(); tp != _calls.end(); ++tp ) {
 	    if ( tp != _calls.begin() ) {
 		(void) fprintf( stddbg, ", " );
@@ -572,7 +559,6 @@ Activity::print_debug_info()
 	    tp->print( stddbg );
 	}
 	(void) fprintf( stddbg, ".\n" );
-#endif
     }
 
     if ( is_activity() ) {
@@ -613,13 +599,12 @@ Activity::insertDOMResults()
 	    }
     }
 
+    r_cycle_hist.insertDOMResults( _dom );
     if ( _hist_data ) {
 	_hist_data->insertDOMResults();
     }
 
-#if HAVE_PARASOL
     _calls.insertDOMResults();
-#endif
     return *this;
 }
 
@@ -850,9 +835,7 @@ Activity::print( std::ostream& output ) const
 	       << r_afterQuorumThreadWait;
     }
 
-#if HAVE_PARASOL
     _calls.print( output );
-#endif
     return output;
 }
 
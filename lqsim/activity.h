@@ -21,6 +21,7 @@
 #include <deque>
 #include <lqio/dom_activity.h>
 #include "actlist.h"
+#include "loghistogram.h"
 #include "random.h"
 #include "result.h"
 #include "target.h"
@@ -137,6 +138,7 @@ public:
     SampleResult r_proc_delay_sqr;	/* Delay to getting processor	*/
     SampleResult r_cycle;		/* Entry cycle time.	        */
     SampleResult r_cycle_sqr;  		/* Entry cycle time.	        */
+    LogHistogram r_cycle_hist;		/* Cycle time percentiles.	*/
     SampleResult r_afterQuorumThreadWait;	/* start tomari quorum 		*/
 
     static std::map<LQIO::DOM::ActivityList*, LQIO::DOM::ActivityList*> actConnections;
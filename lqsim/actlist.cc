@@ -31,6 +31,7 @@
 #include "histogram.h"
 #include "instance.h"
 #include "model.h"
+#include "random.h"
 #include "task.h"
 
 static inline int i_max( int a, int b ) { return a > b ? a : b; }
@@ -168,6 +169,10 @@ OrForkActivityList::configure()
     for ( std::vector<Activity *>::const_iterator i = _list.begin(); i != _list.end(); ++i ) {
 	_prob.at(i - _list.begin()) = getDOM()->getParameterValue(dynamic_cast<LQIO::DOM::Activity *>((*i)->getDOM()));
     }
+    if ( !_list.empty() ) {
+	_alias.name( _list.front()->task()->name() + "/" + _list.front()->name() + ":or-fork" );
+    }
+    _alias.configure( _prob );
     return *this;
 }
 
@@ -180,6 +185,9 @@ LoopActivityList::configure()
 	_count.at( i - _list.begin() ) = value;
 	_total += value;
     }
+    if ( !_list.empty() ) {
+	_choice.name( _list.front()->task()->name() + "/" + _list.front()->name() + ":loop" );
+    }
     return *this;
 }
 
@@ -518,7 +526,7 @@ ActivityList::shuffle()
 {
     const size_t n = _list.size();
     for ( size_t i = n; i >= 1; --i ) {
-	size_t k = static_cast<size_t>(drand48() * i);
+	size_t k = static_cast<size_t>(Random::number() * i);
 	if ( i-1 != k ) {
 	    std::swap( _list[k], _list[i-1] );
 	}
@@ -19,6 +19,7 @@
 
 #include <deque>
 #include <set>
+#include "random.h"
 #include "result.h"
 
 class Entry;
@@ -137,10 +138,12 @@ class OrForkActivityList : public ForkActivityList
 public:
     OrForkActivityList( Type type, LQIO::DOM::ActivityList * dom )
 	: ForkActivityList(type,dom),
-	  _prob()
+	  _prob(),
+	  _alias()
 	{}
     
     double get_prob_at( size_t ix ) const { return _prob[ix]; }
+    size_t get_next_branch() const { return _alias(); }
     
     virtual OrForkActivityList& push_back( Activity * activity );
     virtual OrForkActivityList& configure();
@@ -149,6 +152,7 @@ public:
 
 private:
     std::vector<double> _prob;		/* Array of probabilities.	*/
+    Alias _alias;			/* Branch chooser.		*/
 };
 
 class AndForkActivityList : public ForkActivityList
@@ -179,11 +183,13 @@ public:
 	: InputActivityList(type,dom),
 	  _exit(nullptr),
 	  _count(),
-	  _total(0.0)
+	  _total(0.0),
+	  _choice()
 	{}
 
     Activity * get_exit() const { return _exit; }
     double get_total() const { return _total; }
+    double get_exit_value() const { return _choice() * (_total + 1.0); }
     double get_count_at( size_t ix ) const { return _count[ix]; }
     
     virtual LoopActivityList& push_back( Activity * activity );
@@ -196,6 +202,7 @@ private:
     Activity * _exit;			/* For repeat nodes. 		*/
     std::vector<double> _count;		/* array of iterations		*/
     double _total;			/* total iterations.		*/
+    Choice _choice;			/* Loop or exit.		*/
 };
 
 /* ------------------------------------------------------------------------ */
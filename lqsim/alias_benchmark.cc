@@ -0,0 +1,80 @@
+/************************************************************************/
+/* Copyright the Real-Time and Distributed Systems Group,		*/
+/* Department of Systems and Computer Engineering,			*/
+/* Carleton University, Ottawa, Ontario, Canada. K1S 5B6		*/
+/* 									*/
+/* October 2026								*/
+/************************************************************************/
+
+/*
+ * Microbenchmark: choose a call target by scanning the cumulative
+ * probabilities, as Targets::get_next_target() used to, and with an
+ * alias table.  Both use Random::number() so the cost of the generator
+ * is the same.  Also checks that the alias table gives the right
+ * frequencies.
+ *
+ *	make alias_benchmark && ./alias_benchmark [draws]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "random.h"
+
+static size_t scan( const std::vector<double>& cumulative )
+{
+    const double p = Random::number();
+    size_t i;
+    for ( i = 0; i < cumulative.size() && p >= cumulative[i]; i = i + 1 );
+    return i;
+}
+
+int main( int argc, char **argv )
+{
+    const unsigned long draws = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 10000000;
+    bool ok = true;
+
+    Random::seed( 1 );
+    std::cout << std::setw(8) << "targets" << std::setw(12) << "scan ns" << std::setw(12) << "alias ns" << std::setw(12) << "max error" << std::endl;
+    for ( size_t n : { 2, 8, 50, 200 } ) {
+
+	/* Target i is called i+1 times; the last outcome is no call. */
+
+	std::vector<double> weights( n + 1 );
+	std::vector<double> cumulative( n );
+	double sum = 0.0;
+	for ( size_t i = 0; i < n; ++i ) {
+	    weights[i] = static_cast<double>(i + 1);
+	    sum += weights[i];
+	}
+	weights[n] = 1.0;
+	double c = 0.0;
+	for ( size_t i = 0; i < n; ++i ) {
+	    c += weights[i];
+	    cumulative[i] = c / (sum + 1.0);
+	}
+	Alias alias;
+	alias.configure( weights );
+
+	size_t check = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for ( unsigned long k = 0; k < draws; ++k ) check += scan( cumulative );
+	const double t_scan = std::chrono::duration<double,std::nano>( std::chrono::steady_clock::now() - start ).count() / draws;
+
+	std::vector<unsigned long> count( n + 1 );
+	start = std::chrono::steady_clock::now();
+	for ( unsigned long k = 0; k < draws; ++k ) count[alias()] += 1;
+	const double t_alias = std::chrono::duration<double,std::nano>( std::chrono::steady_clock::now() - start ).count() / draws;
+
+	double error = 0.0;
+	for ( size_t i = 0; i <= n; ++i ) {
+	    error = std::max( error, std::fabs( static_cast<double>(count[i]) / draws - weights[i] / (sum + 1.0) ) );
+	}
+	if ( error > 0.01 || check == 0 ) ok = false;
+	std::cout << std::setw(8) << n << std::setw(12) << std::setprecision(3) << t_scan << std::setw(12) << t_alias << std::setw(12) << error << std::endl;
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,113 @@
+/* -*- c++ -*-
+ * Binary event trace (-tbinary=file).
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "bintrace.h"
+
+BinaryTrace * BinaryTrace::__trace = nullptr;
+
+
+BinaryTrace::BinaryTrace( int fd, Header * header, uint64_t capacity )
+    : _fd(fd), _header(header), _ring(reinterpret_cast<Record *>(header + 1)), _mask(capacity - 1), _names(), _n_names(0)
+{
+}
+
+
+BinaryTrace::~BinaryTrace()
+{
+    if ( _header != nullptr ) {
+	close();
+    }
+}
+
+
+/*
+ * Create file_name and map the header and the ring.  The capacity is
+ * rounded up to a power of two so the ring index is a mask.  Returns
+ * nullptr with errno set on failure.
+ */
+
+BinaryTrace *
+BinaryTrace::create( const std::string& file_name, uint64_t capacity )
+{
+    uint64_t n = 1;
+    while ( n < capacity ) n <<= 1;
+    const size_t length = sizeof( Header ) + n * sizeof( Record );
+
+    const int fd = ::open( file_name.c_str(), O_RDWR|O_CREAT|O_TRUNC, 0666 );
+    if ( fd < 0 ) return nullptr;
+    if ( ftruncate( fd, length ) < 0 ) {
+	const int error = errno;
+	::close( fd );
+	errno = error;
+	return nullptr;
+    }
+    void * p = mmap( nullptr, length, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0 );
+    if ( p == MAP_FAILED ) {
+	const int error = errno;
+	::close( fd );
+	errno = error;
+	return nullptr;
+    }
+
+    Header * header = static_cast<Header *>(p);
+    memcpy( header->magic, MAGIC, sizeof( header->magic ) );
+    header->version = FORMAT_VERSION;
+    header->record_size = sizeof( Record );
+    header->capacity = n;
+    header->count = 0;
+    header->names = 0;
+    header->n_names = 0;
+    return new BinaryTrace( fd, header, n );
+}
+
+
+/*
+ * Add a name to the table written by close().
+ */
+
+void
+BinaryTrace::name( Kind kind, uint32_t id, const std::string& s )
+{
+    const Name name = { static_cast<uint32_t>(kind), id, static_cast<uint32_t>(s.size()), 0 };
+    _names.append( reinterpret_cast<const char *>(&name), sizeof( name ) );
+    _names.append( s );
+    _n_names += 1;
+}
+
+
+/*
+ * Append the name table after the ring, then unmap and close the
+ * file.  The header is updated last so a reader never sees a table
+ * that is only partly written.
+ */
+
+bool
+BinaryTrace::close()
+{
+    if ( _header == nullptr ) return false;
+    const size_t length = sizeof( Header ) + _header->capacity * sizeof( Record );
+    bool ok = pwrite( _fd, _names.data(), _names.size(), length ) == static_cast<ssize_t>(_names.size());
+    if ( ok ) {
+	_header->names = length;
+	_header->n_names = _n_names;
+    }
+    ok = msync( _header, length, MS_SYNC ) == 0 && ok;
+    munmap( _header, length );
+    ok = ::close( _fd ) == 0 && ok;
+    _header = nullptr;
+    _ring = nullptr;
+    _fd = -1;
+    return ok;
+}
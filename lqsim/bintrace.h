@@ -0,0 +1,126 @@
+/* -*- c++ -*-
+ * Binary event trace (-tbinary=file).
+ *
+ * Writing a line of text for every event slows a simulation down by
+ * orders of magnitude, so the binary trace stores each event as a
+ * fixed-size Record in a ring buffer held in a memory-mapped file.
+ * Recording an event is a store into the mapping; the kernel writes
+ * the pages out.  Once the ring is full, the oldest events are
+ * overwritten so the file holds the last capacity events.  When the
+ * simulation finishes, the names of the task instances and entries
+ * are appended after the ring.
+ *
+ * The file is laid out as a Header, capacity Records, then the name
+ * table: a Name followed by its characters for each instance and
+ * entry.  All values are in the byte order of the machine running
+ * lqsim.  lqsim-trace(1) converts a trace to CSV or to the Chrome
+ * trace-event format.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026.
+ */
+
+#ifndef LQSIM_BINTRACE_H
+#define LQSIM_BINTRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class BinaryTrace {
+public:
+    static constexpr char MAGIC[8] = { 'L', 'Q', 'S', 'I', 'M', 'T', 'R', '\0' };
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr uint64_t DEFAULT_RECORDS = 1 << 20;	/* 32 MiB	*/
+    static constexpr uint32_t NO_ENTRY = UINT32_MAX;
+
+    enum class Event : uint16_t {
+	SEND,			/* entry sends a request to peer.	*/
+	SEND_ASYNC,		/* ... and does not wait for a reply.	*/
+	RECEIVE,		/* entry accepts a request from peer.	*/
+	REPLY,			/* entry replies to peer.		*/
+	REPLY_RECEIVED,		/* entry gets the reply from peer.	*/
+	FORWARD,		/* entry forwards the request to peer.	*/
+	COMPUTE_START,		/* value is the demand.			*/
+	COMPUTE_END
+    };
+    static constexpr unsigned int N_EVENTS = static_cast<unsigned int>(Event::COMPUTE_END) + 1;
+
+    struct Header {
+	char magic[8];
+	uint32_t version;
+	uint32_t record_size;
+	uint64_t capacity;	/* Records in the ring (a power of two).	*/
+	uint64_t count;		/* Records ever written.			*/
+	uint64_t names;		/* Offset of the name table, 0 if missing.	*/
+	uint64_t n_names;
+	uint64_t reserved[2];
+    };
+
+    struct Record {
+	double time;		/* Simulation time.			*/
+	double value;		/* Demand, or the time the request was sent. */
+	uint32_t instance;	/* Task instance (parasol task id).	*/
+	uint32_t entry;		/* Global entry id, or NO_ENTRY.		*/
+	uint32_t peer;		/* Entry at the other end, or NO_ENTRY.	*/
+	uint16_t event;		/* Event.				*/
+	uint16_t reserved;
+    };
+
+    enum class Kind : uint32_t { INSTANCE, ENTRY };
+
+    struct Name {
+	uint32_t kind;
+	uint32_t id;
+	uint32_t length;	/* Followed by length characters.	*/
+	uint32_t reserved;
+    };
+
+    static_assert( sizeof( Header ) == 64, "BinaryTrace::Header" );
+    static_assert( sizeof( Record ) == 32, "BinaryTrace::Record" );
+    static_assert( sizeof( Name ) == 16, "BinaryTrace::Name" );
+
+private:
+    BinaryTrace( int fd, Header * header, uint64_t capacity );
+    BinaryTrace( const BinaryTrace& ) = delete;
+    BinaryTrace& operator=( const BinaryTrace& ) = delete;
+
+public:
+    ~BinaryTrace();
+    static BinaryTrace * create( const std::string& file_name, uint64_t capacity = DEFAULT_RECORDS );
+
+    void record( Event event, double time, uint32_t instance, uint32_t entry, uint32_t peer, double value = 0. )
+	{
+	    Record& r = _ring[_header->count & _mask];
+	    r.time = time;
+	    r.value = value;
+	    r.instance = instance;
+	    r.entry = entry;
+	    r.peer = peer;
+	    r.event = static_cast<uint16_t>(event);
+	    r.reserved = 0;
+	    _header->count += 1;
+	}
+    void name( Kind, uint32_t id, const std::string& );
+    bool close();
+
+    static const char * event_name( uint16_t event )
+	{
+	    static const char * names[N_EVENTS] = { "send", "send-async", "receive", "reply", "reply-received", "forward", "compute-start", "compute-end" };
+	    return event < N_EVENTS ? names[event] : "unknown";
+	}
+
+    static BinaryTrace * __trace;		/* Non-null while tracing.	*/
+
+private:
+    int _fd;
+    Header * _header;
+    Record * _ring;
+    const uint64_t _mask;
+    std::string _names;
+    uint64_t _n_names;
+};
+#endif
@@ -0,0 +1,133 @@
+/* -*- c++ -*-
+ * Checkpoints of a blocked simulation (--checkpoint, --resume).
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+#include "checkpoint.h"
+
+static const char MAGIC[8] = { 'L', 'Q', 'S', 'I', 'M', 'C', 'K', '\0' };
+static const uint32_t FORMAT_VERSION = 2;
+
+
+Checkpoint::Checkpoint( const std::filesystem::path& file_name, double interval, uint64_t fingerprint, unsigned int processes )
+    : _file_name(file_name),
+      _interval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(interval))),
+      _next(std::chrono::steady_clock::now() + _interval),
+      _header(),
+      _totals(),
+      _loaded(false)
+{
+    memcpy( _header.magic, MAGIC, sizeof( _header.magic ) );
+    _header.version = FORMAT_VERSION;
+    _header.processes = processes;
+    _header.fingerprint = fingerprint;
+}
+
+
+/*
+ * Read the checkpoint.  Returns false, leaving the checkpoint empty,
+ * if there is none or it was written for another model, other options
+ * or another number of processes.
+ */
+
+bool
+Checkpoint::load()
+{
+    std::ifstream input( _file_name, std::ios::binary );
+    Header header;
+    if ( !input.read( reinterpret_cast<char *>(&header), sizeof( header ) )
+	 || memcmp( header.magic, MAGIC, sizeof( header.magic ) ) != 0
+	 || header.version != FORMAT_VERSION
+	 || header.fingerprint != _header.fingerprint
+	 || header.processes != _header.processes ) {
+	return false;
+    }
+
+    std::vector<std::vector<double>> totals( header.processes );
+    for ( std::vector<std::vector<double>>::iterator process = totals.begin(); process != totals.end(); ++process ) {
+	uint64_t values = 0;
+	if ( !input.read( reinterpret_cast<char *>(&values), sizeof( values ) ) ) return false;
+	process->resize( values );
+	if ( !input.read( reinterpret_cast<char *>(process->data()), process->size() * sizeof( double ) ) ) return false;
+    }
+
+    _header = header;
+    _header.resumes += 1;		/* Use new random number streams. */
+    _totals.swap( totals );
+    _loaded = true;
+    return true;
+}
+
+
+/*
+ * Write the number of totals and the totals of each process to a
+ * temporary file, then rename it so that an interrupted save leaves
+ * the previous checkpoint.  The number differs between processes.
+ */
+
+bool
+Checkpoint::save( unsigned long blocks, const Parameters& parameters, const std::vector<const std::vector<double> *>& totals )
+{
+    _next = std::chrono::steady_clock::now() + _interval;
+    _header.blocks = blocks;
+    _header.initial_delay = parameters.initial_delay;
+    _header.block_period = parameters.block_period;
+    _header.max_blocks = parameters.max_blocks;
+
+    std::filesystem::path temporary = _file_name;
+    temporary += ".tmp";
+    {
+	std::ofstream output( temporary, std::ios::binary|std::ios::trunc );
+	output.write( reinterpret_cast<const char *>(&_header), sizeof( _header ) );
+	for ( std::vector<const std::vector<double> *>::const_iterator process = totals.begin(); process != totals.end(); ++process ) {
+	    const uint64_t values = (*process)->size();
+	    output.write( reinterpret_cast<const char *>(&values), sizeof( values ) );
+	    output.write( reinterpret_cast<const char *>((*process)->data()), (*process)->size() * sizeof( double ) );
+	}
+	if ( !output.flush() ) {
+	    unlink( temporary.c_str() );
+	    return false;
+	}
+    }
+    return std::rename( temporary.c_str(), _file_name.c_str() ) == 0;
+}
+
+
+/*
+ * The run is complete, so it cannot be resumed.
+ */
+
+void
+Checkpoint::remove() const
+{
+    unlink( _file_name.c_str() );
+}
+
+
+/*
+ * FNV-1a hash of the input file and of the options that change the
+ * results or how they are split between processes.
+ */
+
+uint64_t
+Checkpoint::fingerprint( const std::filesystem::path& input_file_name, const std::vector<double>& options )
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    const auto add = [&]( const char * p, size_t n ) { for ( ; n > 0; --n, ++p ) { hash = (hash ^ static_cast<unsigned char>(*p)) * 0x100000001b3ULL; } };
+
+    std::ifstream input( input_file_name, std::ios::binary );
+    const std::string contents( (std::istreambuf_iterator<char>( input )), std::istreambuf_iterator<char>() );
+    add( contents.data(), contents.size() );
+    add( reinterpret_cast<const char *>(options.data()), options.size() * sizeof( double ) );
+    return hash;
+}
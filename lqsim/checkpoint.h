@@ -0,0 +1,79 @@
+/* -*- c++ -*-
+ * Checkpoints of a blocked simulation (--checkpoint, --resume).
+ *
+ * The state of the simulation proper -- the parasol calendar and the
+ * stacks of the task instances -- cannot be saved, so a checkpoint
+ * holds what a blocked simulation needs to go on: the totals of every
+ * Result and Histogram over the blocks completed so far in each
+ * process (see Replicas::pack()), the number of blocks, and the
+ * warm-up and block period.
+ * A resumed run warms up again from an empty model, using a different
+ * random number stream than any earlier run, then adds new blocks to
+ * the saved ones.  Since the blocks are treated as independent
+ * batches, the results are statistically the same as those of an
+ * uninterrupted run.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026.
+ */
+
+#ifndef LQSIM_CHECKPOINT_H
+#define LQSIM_CHECKPOINT_H
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+class Checkpoint {
+public:
+    static constexpr double DEFAULT_INTERVAL = 60.;	/* Seconds (wall clock). */
+
+    struct Parameters {
+	double initial_delay;
+	double block_period;
+	unsigned long max_blocks;
+    };
+
+private:
+    struct Header {
+	char magic[8];
+	uint32_t version;
+	uint32_t processes;	/* Parent and workers.			*/
+	uint64_t fingerprint;	/* Of the model and the options.		*/
+	uint64_t resumes;	/* Number of times the run has resumed.	*/
+	uint64_t blocks;	/* Blocks completed by each process.	*/
+	double initial_delay;
+	double block_period;
+	uint64_t max_blocks;
+    };
+
+public:
+    Checkpoint( const std::filesystem::path& file_name, double interval, uint64_t fingerprint, unsigned int processes );
+
+    bool load();
+    bool loaded() const { return _loaded; }
+    bool due() const { return std::chrono::steady_clock::now() >= _next; }
+    bool save( unsigned long blocks, const Parameters&, const std::vector<const std::vector<double> *>& );
+    void remove() const;
+
+    const std::filesystem::path& file_name() const { return _file_name; }
+    unsigned long blocks() const { return _header.blocks; }
+    Parameters parameters() const { return { _header.initial_delay, _header.block_period, _header.max_blocks }; }
+    const std::vector<double>& totals( unsigned int process ) const { return _totals.at( process ); }
+    unsigned int stream( unsigned int process ) const { return process + _header.resumes * _header.processes; }
+
+    static uint64_t fingerprint( const std::filesystem::path& input_file_name, const std::vector<double>& options );
+
+private:
+    const std::filesystem::path _file_name;
+    const std::chrono::steady_clock::duration _interval;
+    std::chrono::steady_clock::time_point _next;
+    Header _header;
+    std::vector<std::vector<double>> _totals;
+    bool _loaded;
+};
+#endif
@@ -166,9 +166,8 @@ Entry::configure()
     /* forwarding component */
 			
     if ( is_rendezvous() ) {
-#if HAVE_PARASOL
+	_fwd.name( task()->name() + "/" + name() + ":forward" );
 	_fwd.configure( LQIO::DOM::Phase::STOCHASTIC, false );		// don't normalize.
-#endif
     }
 
     return total_calls;
@@ -215,9 +214,7 @@ Entry::initialize()
     /* forwarding component */
 			
     if ( is_rendezvous() ) {
-#if HAVE_PARASOL
 	_fwd.initialize();
-#endif
     }
 
     return *this;
@@ -351,9 +348,7 @@ Entry::add_forwarding( Entry* to_entry, LQIO::DOM::Call * call )
     if ( task()->is_reference_task() ) {
 	getDOM()->runtime_error( LQIO::ERR_REFERENCE_TASK_FORWARDING, name().c_str() );
     } else {
-#if HAVE_PARASOL
 	_fwd.store_target_info( to_entry, call );
-#endif
     }
     return *this;
 }
@@ -369,9 +364,7 @@ Entry::accumulate_data()
     /* Forwarding */
 
     if ( is_rendezvous() ) {
-#if HAVE_PARASOL
 	_fwd.accumulate_data();
-#endif
     }
     return *this;
 }
@@ -385,9 +378,7 @@ Entry::reset_stats()
     /* Forwarding */
 	    
     if ( is_rendezvous() ) {
-#if HAVE_PARASOL
 	_fwd.reset_stats();
-#endif
     }
     return *this;
 }
@@ -477,9 +468,7 @@ Entry::insertDOMResults()
 	_dom->setResultSquaredCoeffVariation(sum_cycle_var/square(sum_cycle));
     }
 	      
-#if HAVE_PARASOL
     _fwd.insertDOMResults();
-#endif
 
     /* Open arrivals are done in Task::PseudoTask */
     return *this;
@@ -606,7 +595,6 @@ Pseudo_Entry::configure()
 Entry&
 Pseudo_Entry::insertDOMResults()
 {
-#if HAVE_PARASOL
     for ( Targets::const_iterator tp = _phase[0]._calls.begin(); tp != _phase[0]._calls.end(); ++tp ) {
 	Entry * ep = tp->entry();
 	LQIO::DOM::Entry * dom = ep->getDOM();
@@ -616,7 +604,6 @@ Pseudo_Entry::insertDOMResults()
 	    dom->setResultWaitingTimeVariance( tp->variance_delay() );
 	}
     }
-#endif
     return *this;
 }
 
@@ -673,9 +660,7 @@ Entry::add_open_arrival_task()
 
     /* Set up calls per cycle.  1 call is made per cycle */
 
-#if HAVE_PARASOL
     from_entry->_phase[0]._calls.store_target_info( this, 1.0 );
-#endif
 
     open_arrival_count += 1;
 
@@ -702,9 +687,7 @@ Entry::add_call( const unsigned int p, LQIO::DOM::Call* domCall )
     if ( domCall->getCallType() == LQIO::DOM::Call::Type::RENDEZVOUS && !to_entry->test_and_set_recv( Entry::Type::RENDEZVOUS ) ) return;
     if ( domCall->getCallType() == LQIO::DOM::Call::Type::SEND_NO_REPLY && !to_entry->test_and_set_recv( Entry::Type::SEND_NO_REPLY ) ) return;
 
-#if HAVE_PARASOL
     _phase.at(p-1)._calls.store_target_info( to_entry, domCall );
-#endif
 }
 
 /*
@@ -735,7 +718,6 @@ Entry::print_debug_info()
 
     if ( _fwd.size() > 0 ) {
 	fprintf( stddbg, "\tfwds:  " );
-#if HAVE_PARASOL
 
 	for ( Targets::const_iterator tp = _fwd.begin(); tp != _fwd.end(); ++tp ) {
 	    if ( tp != _fwd.begin() ) {
@@ -744,6 +726,5 @@ Entry::print_debug_info()
 	    tp->print( stddbg );
 	}
 	(void) fprintf( stddbg, ".\n" );
-#endif
     }
 }
@@ -145,11 +145,7 @@ private:
     Activity * _activity;		/* Activity list.		*/
     Type _recv;				/* flag...			*/
     Task * _task;			/* Owner of entry.		*/
-#if HAVE_PARASOL
     Targets _fwd;			/* forward info		        */
-#else
-    std::vector<int> _fwd;		/* New data structure required	*/
-#endif
     ActivityList * _join_list;		/* For joins			*/
 };
 
@@ -31,11 +31,12 @@ std::vector< std::pair<unsigned, LQIO::error_message_type> > local_error_message
     { ERR_DELAY_MULTIPLY_DEFINED,	    { LQIO::error_severity::ERROR, 	"Delay from processor \"%s\" to processor \"%s\" previously specified." } },
     { ERR_INITIALIZATION_FAILED,	    { LQIO::error_severity::ERROR, 	"An error occurred while initializing parasol model.  The simulation was not run." } },
     { ERR_INIT_DELAY,			    { LQIO::error_severity::ERROR, 	"Initial delay of %g is too small, %d client(s) still running." } },
-    { ERR_MSG_POOL_EMPTY,		    { LQIO::error_severity::ERROR,   	"Message pool is empty.  Sending from \"%s\" to \"%s\"." } },
+    { ERR_MSG_POOL_EMPTY,		    { LQIO::error_severity::ERROR,   	"Message queue is full.  Sending from \"%s\" to \"%s\"." } },
     { ERR_NO_QUANTUM_FOR_PS,		    { LQIO::error_severity::ERROR, 	"No quantum greater than zero is specified for PS scheduling discipline at processor \"%s\"."} },
     { ERR_REPLY_NOT_FOUND,		    { LQIO::error_severity::ERROR, 	"Activity \"%s\" requests reply for entry \"%s\" but none pending." } },
     { ERR_SIGNAL_NO_WAIT,		    { LQIO::error_severity::ERROR, 	"Signal to semaphore task %s with no pending wait." } },
     { ADV_PRECISION,			    { LQIO::error_severity::ADVISORY, 	"Specified confidence interval of %4.2f%% not met after run time of %G. Actual value is %4.2f%%." } },
+    { ADV_NO_STEADY_STATE,		    { LQIO::error_severity::ADVISORY, 	"No steady state found after a pilot run of %G. Block period set to %G." } },
     { ADV_DEADLOCK,			    { LQIO::error_severity::ADVISORY, 	"Model is deadlocked." } },
     { WRN_NO_PHASE_FOR_HISTOGRAM,	    { LQIO::error_severity::WARNING,  	"Histogram requested for entry \"%s\", phase %d -- phase is not present." } },
     { WRN_INVALID_PRIORITY,		    { LQIO::error_severity::WARNING,  	"Priority specified (%d) is outside of range (%d,%d). (Value has been adjusted to %d)." } },
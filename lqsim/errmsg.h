@@ -27,6 +27,7 @@ enum {
     ERR_SIGNAL_NO_WAIT,
     ADV_DEADLOCK,
     ADV_PRECISION,
+    ADV_NO_STEADY_STATE,
     WRN_NO_PHASE_FOR_HISTOGRAM,
     WRN_INVALID_PRIORITY
 };
@@ -12,100 +12,133 @@
  * $Id: eventhandler.cc 17611 2025-12-02 19:54:19Z greg $
  */
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
-#include <map>
-#include <mutex>
-#include <condition_variable>
 #include "eventhandler.h"
 
 EventHandler * EventHandler::__event_handler(nullptr);
 
+/*
+ * A process that was co_awaited hands the exception to its caller.
+ * One that was spawned has no caller, so the exception is thrown out
+ * of EventHandler::run().
+ */
+
+void
+Process::promise_type::unhandled_exception()
+{
+    if ( !_continuation ) throw;
+    _exception = std::current_exception();
+}
+
+
+std::coroutine_handle<>
+Process::Final::await_suspend( std::coroutine_handle<promise_type> handle ) noexcept
+{
+    const std::coroutine_handle<> continuation = handle.promise()._continuation;
+    if ( continuation ) return continuation;
+    return std::noop_coroutine();
+}
+
+
+std::coroutine_handle<>
+Process::await_suspend( std::coroutine_handle<> caller )
+{
+    _handle.promise()._continuation = caller;
+    return _handle;
+}
+
+
+void
+Process::await_resume()
+{
+    if ( _handle && _handle.promise()._exception ) {
+	std::rethrow_exception( _handle.promise()._exception );
+    }
+}
+
+
 std::ostream&
 Event::print( std::ostream& output ) const
 {
-    static std::map<Event::Type,const std::string> event_name = {
-	{ Event::Type::START, "Start" },
-	{ Event::Type::STOP, "Stop" }
-    };
-
-    output << get_time() << ": " <<  event_name[get_type()] << std::endl;
+    output << get_time() << ": " << get_sequence() << std::endl;
     return output;
 }
-
-EventHandler::EventHandler() : _event_list(), _current_time(0.0), _mutex(), _update_time(), _in_use(0)
+
+EventHandler::EventHandler() : _event_list(), _processes(), _current_time(0.0), _sequence(0), _events(0)
 {
     assert( __event_handler == nullptr );
     __event_handler = this;
 }
 
+
+/*
+ * Suspended processes are destroyed with their frames.
+ */
+
+EventHandler::~EventHandler()
+{
+    __event_handler = nullptr;
+}
+
+
+/*
+ * Start process at the current time.  The event handler owns it from
+ * now on.
+ */
+
 void
-EventHandler::start_event( std::condition_variable& resume )
+EventHandler::spawn( Process&& process )
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-    _event_list.emplace( _current_time, Event::Type::START, &resume );
-    resume.wait( lock );
+    _processes.push_back( std::move( process ) );
+    schedule( 0.0, _processes.back().handle() );
 }
 
 
 void
-EventHandler::stop_event( double delta )
+EventHandler::schedule( double delta, std::coroutine_handle<> resume )
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-    _event_list.emplace( _current_time + delta, Event::Type::STOP, nullptr );
+    _event_list.emplace( _current_time + delta, _sequence, resume );
+    _sequence += 1;
 }
-
+
+
 /*
- * Barrier synchronization to ensure that all processors have run to
- * completion so that the event list is temporily ordered.
+ * Resume processes in time order until there are no more events or
+ * the next one is after stop_time, then move the clock to stop_time.
+ * Returns true if events remain.
  */
 
-void
-EventHandler::acquire()
+bool
+EventHandler::run( double stop_time )
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-    _in_use += 1;
+    while ( !_event_list.empty() && _event_list.top().get_time() <= stop_time ) {
+	const Event event = _event_list.top();
+	_event_list.pop();
+	_current_time = event.get_time();
+	_events += 1;
+	event.get_resume().resume();
+    }
+    _current_time = std::max( _current_time, stop_time );
+    _processes.remove_if( std::mem_fn( &Process::done ) );
+    return !_event_list.empty();
 }
 
+
 void
-EventHandler::release()
+Signal::notify_one()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    if ( _in_use > 0 ) {
-	_in_use -= 1;
-    }
-    if ( _in_use == 0 ) {
-	_update_time.notify_one();
-    }
+    if ( _waiting.empty() ) return;
+    EventHandler::wake( _waiting.front() );
+    _waiting.pop_front();
 }
-
+
+
 void
-EventHandler::run()
+Signal::notify_all()
 {
-    std::cout << "Event handler running." << std::endl;
-    while ( !_event_list.empty() ) {
-	/* Do all events at current time */
-	std::unique_lock<std::mutex> lock(_mutex);
-	while ( !_event_list.empty() && _event_list.top().get_type() == Event::Type::START ) {
-	    const Event& top = _event_list.top();
-	    top.print( std::cout );
-	    if ( top.get_resume() ) {
-		// if start event, then allow task to run.
-		top.get_resume()->notify_one();
-	    }
-	    _event_list.pop();
-	}
-
-	/* wait for in_use == 0 */
-	_update_time.wait( lock, [this](){ return _in_use == 0; } );
-
-	/* If I have a stop event, update the time.  Pop all duplicate times */
-	if ( !_event_list.empty() && _event_list.top().get_type() == Event::Type::STOP ) {
-	    _current_time = _event_list.top().get_time();
-	    _event_list.pop();
-	    while ( !_event_list.empty() && _event_list.top().get_type() == Event::Type::STOP && _event_list.top().get_time() == _current_time ) {
-		_event_list.pop();
-	    }
-	}
+    while ( !_waiting.empty() ) {
+	notify_one();
     }
 }
@@ -1,6 +1,18 @@
 /* -*- c++ -*-
  * Event handler.  Advances simulation time.
  *
+ * Every simulated process is a stackless coroutine (a Process) and a
+ * single EventHandler drives all of them from a calendar ordered by
+ * virtual time.  A process gives up control with
+ *
+ *	co_await EventHandler::delay( time );	// resume time units later
+ *	co_await signal.wait();			// resume after signal.notify_one()
+ *	co_await process;			// call another coroutine
+ *
+ * so a simulation runs on one thread, as fast as the CPU allows, with
+ * no locks and no thread switches between events.  Processes due at
+ * the same time resume in the order in which they were scheduled.
+ *
  * $Id: eventhandler.h 17611 2025-12-02 19:54:19Z greg $
  */
 
@@ -13,58 +25,161 @@
 /************************************************************************/
 
 #pragma once
+#include <coroutine>
+#include <deque>
+#include <exception>
 #include <functional>
-#include <condition_variable>
-#include <mutex>
+#include <iostream>
+#include <list>
 #include <queue>
+#include <utility>
 #include <vector>
 
-class Event {
+class Process {
+public:
+    class promise_type {
+	friend class Process;
+
+    public:
+	promise_type() : _continuation(), _exception() {}
+
+	Process get_return_object() { return Process( std::coroutine_handle<promise_type>::from_promise( *this ) ); }
+	std::suspend_always initial_suspend() noexcept { return {}; }
+	auto final_suspend() noexcept { return Final(); }
+	void return_void() {}
+	void unhandled_exception();
+
+    private:
+	std::coroutine_handle<> _continuation;	/* Caller of co_await process.	*/
+	std::exception_ptr _exception;
+    };
+
+private:
+    /* Return to the caller, if any, when the process finishes. */
+
+    struct Final {
+	bool await_ready() noexcept { return false; }
+	std::coroutine_handle<> await_suspend( std::coroutine_handle<promise_type> handle ) noexcept;
+	void await_resume() noexcept {}
+    };
+
+    explicit Process( std::coroutine_handle<promise_type> handle ) : _handle(handle) {}
+    Process( const Process& ) = delete;
+    Process& operator=( const Process& ) = delete;
+
 public:
-    enum class Type { START, STOP };
+    Process( Process&& src ) noexcept : _handle(src._handle) { src._handle = nullptr; }
+    ~Process() { if ( _handle ) _handle.destroy(); }
+
+    bool done() const { return !_handle || _handle.done(); }
+    std::coroutine_handle<> handle() const { return _handle; }
+
+    /* co_await process runs it to completion as a subroutine. */
 
-    Event( double time, Type type, std::condition_variable* resume ) : _time(time), _type(type), _resume(resume) {}
+    bool await_ready() const { return done(); }
+    std::coroutine_handle<> await_suspend( std::coroutine_handle<> caller );
+    void await_resume();
+
+private:
+    std::coroutine_handle<promise_type> _handle;
+};
+
+
+class Event {
+public:
+    Event( double time, unsigned long sequence, std::coroutine_handle<> resume ) : _time(time), _sequence(sequence), _resume(resume) {}
 
     double get_time() const { return _time; }
-    Type get_type() const { return _type; }
-    std::condition_variable* get_resume() const { return _resume; }
+    unsigned long get_sequence() const { return _sequence; }
+    std::coroutine_handle<> get_resume() const { return _resume; }
     std::ostream& print( std::ostream& ) const;
-    
+
 private:
     double _time;
-    Type _type;
-    std::condition_variable* _resume;
+    unsigned long _sequence;		/* FIFO for equal times.	*/
+    std::coroutine_handle<> _resume;
 };
 
-inline bool operator>( const Event& e1, const Event& e2 ) { return e1.get_time() > e2.get_time(); }
+inline bool operator>( const Event& e1, const Event& e2 ) { return e1.get_time() > e2.get_time() || (e1.get_time() == e2.get_time() && e1.get_sequence() > e2.get_sequence()); }
 
 
 class EventHandler {
 public:
+    /* co_await EventHandler::delay( time ) */
+
+    class Delay {
+    public:
+	Delay( double time ) : _time(time) {}
+	bool await_ready() const { return false; }
+	void await_suspend( std::coroutine_handle<> handle ) const { __event_handler->schedule( _time, handle ); }
+	void await_resume() const {}
+
+    private:
+	const double _time;
+    };
+
     EventHandler();
+    ~EventHandler();
 
-    void run();
-    void start_event( std::condition_variable& resume );
-    void stop_event( double time );
+    void spawn( Process&& process );
+    bool run( double stop_time );
+    void schedule( double delta, std::coroutine_handle<> resume );
     double get_time() const { return _current_time; }
-    static void processor_acquire() { __event_handler->acquire(); }
-    static void processor_release() { __event_handler->release(); }
+    unsigned long get_events() const { return _events; }
+
+    static double now() { return __event_handler->_current_time; }
+    static Delay delay( double time ) { return Delay( time ); }
+    static void wake( std::coroutine_handle<> resume ) { __event_handler->schedule( 0.0, resume ); }
+    static void start( Process&& process ) { __event_handler->spawn( std::move( process ) ); }
+    static bool advance( double time ) { return __event_handler->run( __event_handler->_current_time + time ); }
 
 private:
-    void notify();
-    void acquire();
-    void release();
+    EventHandler( const EventHandler& ) = delete;
+    EventHandler& operator=( const EventHandler& ) = delete;
 
 private:
     static EventHandler * __event_handler;
 
 private:
     std::priority_queue<Event,std::vector<Event>,std::greater<Event>> _event_list;
+    std::list<Process> _processes;	/* Processes started by spawn.	*/
     double _current_time;
-    std::mutex _mutex;
-    std::condition_variable _update_time;
-    unsigned int _in_use;
+    unsigned long _sequence;
+    unsigned long _events;		/* Number of events processed.	*/
 };
 
-/* while event.list[head] == now and type == start; resume thread; pop head */
-/* while event.list[head].type == stop and time < now; now = time; pop head */
+
+/*
+ * Processes waiting for something to happen.  notify_one() and
+ * notify_all() schedule the waiting processes at the current time, in
+ * the order in which they started to wait.
+ */
+
+class Signal {
+public:
+    class Wait {
+    public:
+	Wait( Signal& signal ) : _signal(signal) {}
+	bool await_ready() const { return false; }
+	void await_suspend( std::coroutine_handle<> handle ) { _signal._waiting.push_back( handle ); }
+	void await_resume() const {}
+
+    private:
+	Signal& _signal;
+    };
+
+    Signal() : _waiting() {}
+
+    Wait wait() { return Wait( *this ); }
+    void notify_one();
+    void notify_all();
+    void clear() { _waiting.clear(); }
+    bool empty() const { return _waiting.empty(); }
+
+private:
+    Signal( const Signal& ) = delete;
+    Signal& operator=( const Signal& ) = delete;
+
+private:
+    std::deque<std::coroutine_handle<>> _waiting;
+};
@@ -12,48 +12,61 @@
  * $Id: eventhandler.cc 17600 2025-11-25 20:26:11Z greg $
  */
 
-#include <chrono>
-#include <iostream>
-#include <thread>
+#include <cstdlib>
 #include <iostream>
+#include <string>
 #include "eventhandler.h"
+#include "rendezvous.h"
+
+/*
+ * Three tasks compute for 2, 3 and 5 time units at a time, so they
+ * run together at 0 and 30.  A client sends to a server through a
+ * rendezvous and gets the reply 1 time unit later.
+ */
 
-class Task {
-public:
-    Task( const std::string& name, EventHandler& scheduler ) : _name(name), _scheduler(scheduler) {}
-    
-    void operator()( double time ) {
-	while ( _scheduler.get_time() < 10 ) {
-	    std::condition_variable resume;
-	    std::cout << _scheduler.get_time() << ": "<< _name << " start." << std::endl;
-	    _scheduler.start_event( resume );
-	    std::cout << _scheduler.get_time() << ": "<< _name << " acquire." << std::endl;
-	    EventHandler::processor_acquire();
-	    std::cout << _scheduler.get_time() << ": "<< _name << " stop." << std::endl;
-	    _scheduler.stop_event( time );
-	    std::cout << _scheduler.get_time() << ": "<< _name << " release." << std::endl;
-	    EventHandler::processor_release();
-	}
+static Process task( const std::string name, double time, unsigned int& count )
+{
+    while ( EventHandler::now() < 30 ) {
+	std::cout << EventHandler::now() << ": " << name << " start." << std::endl;
+	co_await EventHandler::delay( time );
+	count += 1;
     }
+}
 
-private:
-    std::string _name;
-    EventHandler& _scheduler;
-};
+static Process server( Rendezvous::Rendezvous<int,int>& rendezvous )
+{
+    for ( ;; ) {
+	int in = 0;
+	co_await rendezvous.receive( &in );
+	co_await EventHandler::delay( 1.0 );
+	rendezvous.reply( in, in * 2 );
+    }
+}
+
+static Process client( Rendezvous::Rendezvous<int,int>& rendezvous, int& sum )
+{
+    for ( int i = 1; i <= 5; ++i ) {
+	int out = 0;
+	co_await rendezvous.send( i, &out );
+	std::cout << EventHandler::now() << ": client " << i << " -> " << out << std::endl;
+	sum += out;
+    }
+}
 
 int main( int argc, char **argv )
 {
     EventHandler scheduler;
-	
-    Task task_2( "Task 2", scheduler );
-    Task task_3( "Task 3", scheduler );
-    Task task_5( "Task 1", scheduler );
-    std::thread task_2_thread( task_2, 2 );
-    std::thread task_3_thread( task_3, 3 );
-    std::thread task_5_thread( task_5, 5 );
-    std::thread scheduler_thread( &EventHandler::run, &scheduler );
-    scheduler_thread.join();
-    task_2_thread.join();
-    task_3_thread.join();
-    task_5_thread.join();
+    Rendezvous::Rendezvous<int,int> rendezvous;
+    unsigned int count[3] = { 0, 0, 0 };
+    int sum = 0;
+
+    scheduler.spawn( task( "Task 2", 2, count[0] ) );
+    scheduler.spawn( task( "Task 3", 3, count[1] ) );
+    scheduler.spawn( task( "Task 5", 5, count[2] ) );
+    scheduler.spawn( server( rendezvous ) );
+    scheduler.spawn( client( rendezvous, sum ) );
+    scheduler.run( 100.0 );
+
+    std::cout << scheduler.get_events() << " events, time " << scheduler.get_time() << std::endl;
+    return count[0] == 15 && count[1] == 10 && count[2] == 6 && sum == 30 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
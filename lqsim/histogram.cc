@@ -7,6 +7,7 @@
 
 
 #include "lqsim.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <functional>
@@ -15,6 +16,8 @@
 #include "errmsg.h"
 #include "result.h"
 
+std::vector<Histogram *> Histogram::__histograms;
+
 Histogram::Histogram( const LQIO::DOM::Histogram * histogram )
     : _histogram(const_cast<LQIO::DOM::Histogram *>(histogram)),
       _n_bins(histogram->getBins()),
@@ -33,6 +36,16 @@ Histogram::Histogram( const LQIO::DOM::Histogram * histogram )
 	bin->sum_sqr = 0;
 	bin->bin = 0;
     }
+    __histograms.push_back( this );
+}
+
+
+Histogram::~Histogram()
+{
+    std::vector<Histogram *>::iterator histogram = std::find( __histograms.begin(), __histograms.end(), this );
+    if ( histogram != __histograms.end() ) {
+	__histograms.erase( histogram );
+    }
 }
 
 
@@ -47,6 +60,22 @@ Histogram::reset()
 
 
 
+/*
+ * Clear the accumulated blocks.
+ */
+
+void
+Histogram::clear_results()
+{
+    for ( std::vector<hist_bin>::iterator bin = _hist.begin(); bin != _hist.end(); ++bin ) {
+	bin->sum = 0;
+	bin->sum_sqr = 0;
+    }
+    _n = 0;
+}
+
+
+
 void
 Histogram::insert( const double value )
 {
@@ -109,3 +138,30 @@ Histogram::insertDOMResults()
 	_histogram->setBinMeanVariance(i,mean(i),variance(i));
     }
 }
+
+
+/*
+ * Append the accumulated blocks to values so that another process can
+ * add them to its own with unpack().
+ */
+
+void
+Histogram::pack( std::vector<double>& values ) const
+{
+    for ( std::vector<hist_bin>::const_iterator bin = _hist.begin(); bin != _hist.end(); ++bin ) {
+	values.push_back( bin->sum );
+	values.push_back( bin->sum_sqr );
+    }
+    values.push_back( static_cast<double>(_n) );
+}
+
+
+void
+Histogram::unpack( std::vector<double>::const_iterator& value )
+{
+    for ( std::vector<hist_bin>::iterator bin = _hist.begin(); bin != _hist.end(); ++bin ) {
+	bin->sum += *value++;
+	bin->sum_sqr += *value++;
+    }
+    _n += static_cast<unsigned>(*value++);
+}
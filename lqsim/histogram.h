@@ -20,6 +20,7 @@
 #include <config.h>
 #endif
 #include <cstdio>
+#include <vector>
 #include <lqio/input.h>
 #include <lqio/dom_histogram.h>
 
@@ -41,12 +42,20 @@ private:
 
 public:
     Histogram( const LQIO::DOM::Histogram * );
+    ~Histogram();
     void reset();
+    void clear_results();
 
     void accumulate_data();
     void insert(const double value);
 
     void insertDOMResults();
+
+    void pack( std::vector<double>& ) const;	/* For replications	*/
+    void unpack( std::vector<double>::const_iterator& );
+    size_t packed() const { return 2 * _hist.size() + 1; }	/* Values from pack() */
+
+    static std::vector<Histogram *> __histograms;
     
 private:
     unsigned int overflow_bin() const { return _n_bins + 1; }
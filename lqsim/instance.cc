@@ -30,6 +30,7 @@
 #include <lqio/input.h>
 #include <lqio/error.h>
 #include "activity.h"
+#include "bintrace.h"
 #include "entry.h"
 #include "errmsg.h"
 #include "group.h"
@@ -55,15 +56,13 @@ Instance::Instance::Instance( Task * cp, const std::string& task_name, long task
       _hold_start_time(0.0),
       _processor(cp->processor()),
       _entry(),
-#if HAVE_PARASOL
       _task_id(task_id),
+#if HAVE_PARASOL
       _node_id(cp->node_id()),
       _std_port( ps_std_port(task_id) ),
       _reply_port( ps_allocate_port( task_name.c_str(), task_id ) ),	/* reply port id	*/
       _thread_port( ps_allocate_port( cp->name().c_str(), task_id ) ),
       _start_port( cp->has_threads() ? ps_allocate_shared_port( _cp->name().c_str() ) : -1 ),
-#else
-      _thread(nullptr),
 #endif
       active_threads(0),	/* no threads -- initialize */
       idle_threads(0),
@@ -81,13 +80,10 @@ Instance::Instance::Instance( Task * cp, const std::string& task_name, long task
     
 #if HAVE_PARASOL
     object_tab[task_id] = this;
+#endif
     if ( static_cast<unsigned long>(task_id) > total_tasks ) {
 	total_tasks = task_id;
     }
-#else
-    {
-    }
-#endif
 }
 
 Instance::Instance::~Instance() 
@@ -121,7 +117,7 @@ Instance::Instance::start( void * )
  * Code for performing one server cycle.
  */
 
-void
+process_t
 Instance::Instance::client_cycle( Random * distribution )
 {
     double think_time = 0;
@@ -130,14 +126,14 @@ Instance::Instance::client_cycle( Random * distribution )
 #if HAVE_PARASOL
 	ps_my_schedule_time = Processor::now() + think_time;
 #endif
-	processor()->sleep( think_time );
+	CO_AWAIT( processor()->sleep( think_time ) );
     }
 
     /* Force a reschedule IFF we don't sleep */
     if ( _cp->n_entries() == 1 ) {
-	server_cycle( _cp->entries()[0], 0, think_time == 0. );
+	CO_AWAIT( server_cycle( _cp->entries()[0], 0, think_time == 0. ) );
     } else {
-	server_cycle( _cp->entries()[static_cast<size_t>(_cp->n_entries()*Random::number())], 0, think_time == 0. );
+	CO_AWAIT( server_cycle( _cp->entries()[static_cast<size_t>(_cp->n_entries()*Random::number())], 0, think_time == 0. ) );
     }
 }
 
@@ -152,11 +148,11 @@ Instance::Instance::client_cycle( Random * distribution )
  *  message * msg			Info from client.
  */
 
-void
+process_t
 Instance::Instance::server_cycle( Entry * ep, Message * msg, bool reschedule )
 {
 #if !HAVE_PARASOL
-    double start_time = 0.0;
+    double start_time	= Processor::now();
 #else
     double start_time 	= ps_my_schedule_time;
 #endif
@@ -184,7 +180,7 @@ Instance::Instance::server_cycle( Entry * ep, Message * msg, bool reschedule )
 
 	Call * tp = msg->target;
 #if !HAVE_PARASOL
-	delta = 0.0;
+	delta = start_time - msg->time_stamp;
 #else
 	delta = ps_my_schedule_time - msg->time_stamp;
 #endif
@@ -200,7 +196,7 @@ Instance::Instance::server_cycle( Entry * ep, Message * msg, bool reschedule )
 
 	ep->_phase[0].r_util.record_offset( ep->_active[0], start_time ); 
 
-	run_activities(  ep, ep->_activity, reschedule );
+	CO_AWAIT( run_activities(  ep, ep->_activity, reschedule ) );
 
 	/* Flush threads */
 
@@ -215,6 +211,7 @@ Instance::Instance::server_cycle( Entry * ep, Message * msg, bool reschedule )
 	phase->r_util.record( ep->_active[p] );
 	phase->r_cycle.record( delta );
 	phase->r_cycle_sqr.record( square(delta) );
+	phase->r_cycle_hist.insert( delta );
 	if ( phase->_hist_data ) {
 	    phase->_hist_data->insert(delta);
 	}
@@ -238,7 +235,7 @@ Instance::Instance::server_cycle( Entry * ep, Message * msg, bool reschedule )
 	for ( p = 0; p < _cp->max_phases(); ++p ) {
 	    _current_phase = p;
 	    ep->_active[p] += 1;
-	    execute_activity( ep, (Activity *)&ep->_phase[p], reschedule );
+	    CO_AWAIT( execute_activity( ep, (Activity *)&ep->_phase[p], reschedule ) );
 	    ep->_active[p] -= 1;
 	}
 
@@ -255,9 +252,7 @@ Instance::Instance::server_cycle( Entry * ep, Message * msg, bool reschedule )
     Message * end_msg = _entry[ep->index()];
     if ( end_msg ) {
 	if ( end_msg->reply_port == -1 ) {
-#if HAVE_PARASOL
 	    _cp->free_message( end_msg );
-#endif
 	} else if ( ep->_join_list == nullptr && _cp->is_sync_server() ) {
 	    _cp->getDOM()->runtime_error( LQIO::ERR_REPLY_NOT_GENERATED );
 	}
@@ -291,7 +286,7 @@ int
 Instance::Real_Instance::create_task( Task * cp, const std::string& task_name )
 {
 #if !HAVE_PARASOL
-    return 0.0;
+    return total_tasks + 1;
 #else
     if ( cp->group_id() != -1 ) {
 	return ps_create_group( task_name.c_str(), cp->node_id(), ANY_HOST, Instance::start, cp->priority(), cp->group_id() );
@@ -323,7 +318,7 @@ Instance::Virtual_Instance::create_task( Task * cp, const std::string& task_name
      */
 
 #if !HAVE_PARASOL
-    return 0;
+    return total_tasks + 1;
 #else
     const int local_node_id = ps_build_node( task_name.c_str(), 1, 1.0, 0.0, 0, true );
     if ( local_node_id < 0 ) {
@@ -353,7 +348,7 @@ Instance::Open_Arrivals::Open_Arrivals( Task * cp, const std::string& task_name
 
 
 
-void
+process_t
 Instance::Open_Arrivals::run (void)
 {
     timeline_trace( TASK_CREATED );
@@ -361,7 +356,7 @@ Instance::Open_Arrivals::run (void)
     /* ---------------------- Main loop --------------------------- */
 
     for ( ;; ) {				/* Start Client Cycle	*/
-	server_cycle( _cp->entries()[0], 0, false );
+	CO_AWAIT( server_cycle( _cp->entries()[0], 0, false ) );
     }
 }
 
@@ -370,10 +365,11 @@ Instance::Open_Arrivals::run (void)
 /*
  */
 
-void
+process_t
 Instance::Sync_Server::run()
 {
     abort();
+    CO_RETURN;
 
     /* spawn activity for each appropriate thread */
 }
@@ -386,12 +382,13 @@ Instance::Sync_Server::run()
  * component.
  */
 
-Instance::Client::Client( Task * cp, const std::string& task_name  )
+Instance::Client::Client( Task * cp, const std::string& task_name, unsigned int i )
     : Real_Instance( cp, task_name ), _think_time( nullptr )
 {
     client_init_count += 1;		/* For -C auto init. 			*/
     if ( cp->think_time() > 0.0 ) {
 	_think_time = new Exponential( _cp->think_time() );
+	_think_time->name( task_name + "#" + std::to_string( i ) + ":think" );
     }
 }
 
@@ -403,15 +400,22 @@ Instance::Client::~Client()
 
 
 
-void
+process_t
 Instance::Client::run()
 {
     timeline_trace( TASK_CREATED );
 
+    /* Customers that are not thinking in the steady state send at once. */
+
+    const double thinking = dynamic_cast<const Reference_Task *>(_cp)->thinking();
+    if ( _think_time != nullptr && thinking < 1.0 && Random::number() >= thinking ) {
+	CO_AWAIT( client_cycle( nullptr ) );
+    }
+
     /* ---------------------- Main loop --------------------------- */
 
     for ( ;; ) {				/* Start Client Cycle	*/
-	client_cycle( _think_time );
+	CO_AWAIT( client_cycle( _think_time ) );
     }
 }
 
@@ -421,7 +425,7 @@ Instance::Client::run()
  * Server, or non-reference task.  Unique instances only.
  */
 
-void
+process_t
 Instance::Server::run()
 {
     long entry_id;
@@ -433,12 +437,13 @@ Instance::Server::run()
     for ( ;; ) {
 	double start_time = Processor::now();
 
-	Message * msg = wait_for_message( entry_id );
+	Message * msg;
+	CO_AWAIT( wait_for_message( entry_id, msg ) );
 
 	/* If start_time == Processor::now(), then we continued right through */
 	/* the receive, hence we will want to force a reschedule.   */ 
 
-	server_cycle( Entry::entry_table[entry_id], msg, start_time == Processor::now() );
+	CO_AWAIT( server_cycle( Entry::entry_table[entry_id], msg, start_time == Processor::now() ) );
     }
 }
 
@@ -466,7 +471,7 @@ Instance::Multiserver::type_name() const
  * automagically allocated when needed.
  */
 
-void
+process_t
 Instance::Multiserver::run()
 {
     timeline_trace( TASK_CREATED );
@@ -487,7 +492,8 @@ Instance::Multiserver::run()
 
 	/* ---- Wait for request ---- */
 
-	Message * msg = wait_for_message( entry_id );
+	Message * msg;
+	wait_for_message( entry_id, msg );
 	Message * worker_msg;
 
 	/* get worker */
@@ -524,7 +530,7 @@ Instance::Multiserver::run()
  * size pool.
  */
 
-void
+process_t
 Instance::Semaphore::run()
 {
     timeline_trace( TASK_CREATED );
@@ -543,13 +549,11 @@ Instance::Semaphore::run()
 	}
 	ps_resume( task->task_id() );
     }
-#endif
 
 
     /* Now run the main loop. */
 
     for ( ;; ) {
-#if HAVE_PARASOL
 
 	/* Stuff for server (Instance::Worker) */
 
@@ -582,8 +586,10 @@ Instance::Semaphore::run()
 	} else {
 	    ps_send( worker_port, entry_id, (char *)msg, msg->reply_port );
 	}
-#endif
     }
+#else
+    co_return;
+#endif
 }
 
 
@@ -593,7 +599,7 @@ Instance::Semaphore::run()
  * waiting is an error.
  */
 
-void
+process_t
 Instance::Signal::run()
 {
 #if HAVE_PARASOL
@@ -632,6 +638,8 @@ Instance::Signal::run()
 
 	ps_send( worker_port, entry_id, (char *)msg, msg->reply_port );
     }
+#else
+    co_return;
 #endif
 }
 
@@ -642,7 +650,7 @@ Instance::Signal::run()
  * a multi-server.  They are dispatched from Instance::Queue tasks.
  */
 
-void
+process_t
 Instance::Worker::run()
 {
 #if HAVE_PARASOL
@@ -674,6 +682,8 @@ Instance::Worker::run()
 
 	timeline_trace( WORKER_IDLE );
     }
+#else
+    co_return;
 #endif
 }
 
@@ -685,7 +695,7 @@ Instance::Worker::run()
  * tasks.
  */
 
-void
+process_t
 Instance::Token::run()
 {
 #if HAVE_PARASOL
@@ -778,6 +788,8 @@ Instance::Token::run()
 
 	timeline_trace( WORKER_IDLE );
     }
+#else
+    co_return;
 #endif
 }
 
@@ -788,7 +800,7 @@ Instance::Token::run()
  * tasks.
  */
 
-void
+process_t
 Instance::Token_r::run()
 {
 #if HAVE_PARASOL
@@ -862,6 +874,8 @@ Instance::Token_r::run()
 
 	timeline_trace( WORKER_IDLE );
     }
+#else
+    co_return;
 #endif
 }
 /*- BUG_164 */
@@ -872,7 +886,7 @@ Instance::Token_r::run()
 /*
  * rwlock , non-reference task.  Unique instances only.
  */
-void
+process_t
 Instance::RWLock_Server::run()
 {
 #if HAVE_PARASOL
@@ -895,7 +909,8 @@ Instance::RWLock_Server::run()
     for ( ;; ) {
 	//double start_time = Processor::now();
 
-	Message * msg = wait_for_message( entry_id );
+	Message * msg;
+	wait_for_message( entry_id, msg );
 
 	/* dispatch request to reader queue or worker token*/
 
@@ -1001,6 +1016,8 @@ Instance::RWLock_Server::run()
 	    }
 	}
     }
+#else
+    co_return;
 #endif
 }
 
@@ -1011,7 +1028,7 @@ Instance::RWLock_Server::run()
  * tasks.
  */
 
-void
+process_t
 Instance::Writer_Token::run()
 {
 #if HAVE_PARASOL
@@ -1084,6 +1101,8 @@ Instance::Writer_Token::run()
 
 	timeline_trace( WORKER_IDLE );
     }
+#else
+    co_return;
 #endif
 }    
 /*  -RWLOCK  */
@@ -1095,7 +1114,7 @@ Instance::Writer_Token::run()
  * that fork.  They are dispatched from any other type of task.
  */
 
-void
+process_t
 Instance::Thread::run()
 {
 #if HAVE_PARASOL
@@ -1126,6 +1145,8 @@ Instance::Thread::run()
 
 	timeline_trace( THREAD_STOP, ap, root_ptr() );
     }
+#else
+    co_return;
 #endif
 }
 
@@ -1138,10 +1159,10 @@ Instance::Thread::run()
  * have to go here.
  */
 
-Message *
-Instance::Instance::wait_for_message( long& entry_id )
+process_t
+Instance::Instance::wait_for_message( long& entry_id, Message *& msg )
 {
-    Message *msg = nullptr;
+    msg = nullptr;
 
 #if HAVE_PARASOL
     ps_my_schedule_time = Processor::now();		/* In case we don't block...	*/
@@ -1154,7 +1175,7 @@ Instance::Instance::wait_for_message( long& entry_id )
 	if ( ep->_join_list == nullptr ) {		/* Entry is available to receive.	*/
 	    entry_id = ep->entry_id();			/* This is returned!			*/
 	    _cp->_pending_msgs.erase(i);		/* Remove Message from queue		*/
-	    return msg;					/* All done.				*/
+	    return;					/* All done.				*/
 	}
     }
     
@@ -1184,8 +1205,12 @@ Instance::Instance::wait_for_message( long& entry_id )
 	_cp->_pending_msgs.push_back( msg ); 	    	/* queue message and try again.		*/
     }
     timeline_trace( TASK_IS_READY, 1 );
+#else
+    timeline_trace( TASK_IS_WAITING, 1 );
+    co_await _cp->rendezvous().receive( &msg );
+    entry_id = msg->target->entry()->entry_id();
+    timeline_trace( TASK_IS_READY, 1 );
 #endif
-    return msg;
 }
 
 Message *
@@ -1217,7 +1242,7 @@ Instance::Instance::wait_for_message2( long& entry_id )
  * the current activity.  pp is the associated entry.
  */
 
-void
+process_t
 Instance::Instance::compute( Activity * ap, Activity * pp )
 {
     if ( ap->_slice_time != nullptr ) {
@@ -1225,6 +1250,25 @@ Instance::Instance::compute( Activity * ap, Activity * pp )
 	const double time = ap->get_slice_time();
 	ap->r_service.record( time );
 
+#if !HAVE_PARASOL
+	/* Wait for the processor.  The wait is part of the scheduling delay. */
+
+	const bool queue = _cp->_compute_func != &Processor::sleep;	/* Not a delay. */
+	if ( queue ) {
+	    const double start_time = Processor::now();
+	    co_await processor()->acquire();
+	    const double delta = Processor::now() - start_time;
+	    ap->r_proc_delay.add( delta );
+	    ap->r_proc_delay_sqr.add( square(delta + ap->_prewaiting) - square(ap->_prewaiting) );
+	    ap->_prewaiting += delta;
+	    if ( ap != pp ) {
+		pp->r_proc_delay.add( delta );
+		pp->r_proc_delay_sqr.add( square(delta + pp->_prewaiting) - square(pp->_prewaiting) );
+		pp->_prewaiting += delta;
+	    }
+	}
+#endif
+
 	timeline_trace( TASK_IS_COMPUTING, time );
 
 	r_a_execute = &ap->r_cpu_util;
@@ -1237,7 +1281,14 @@ Instance::Instance::compute( Activity * ap, Activity * pp )
 	    pp->r_cpu_util.record( pp->_cpu_active );	/* CPU util by phase */
 	}
 
-	(processor()->*(_cp->_compute_func))( time );
+	CO_AWAIT( (processor()->*(_cp->_compute_func))( time ) );
+#if !HAVE_PARASOL
+	if ( queue ) {
+	    processor()->release();
+	}
+#endif
+
+	timeline_trace( TASK_IS_DONE_COMPUTING );
 
 	ap->_cpu_active -= 1;
 	ap->r_cpu_util.record(  pp->_cpu_active );	/* Phase P execution.	*/
@@ -1276,7 +1327,6 @@ Instance::Instance::do_forwarding( Message * msg, const Entry * ep )
 
     } else if ( msg->reply_port == -1 ) {
 
-#if HAVE_PARASOL
 	_cp->free_message( msg );
 
     } else {
@@ -1291,20 +1341,28 @@ Instance::Instance::do_forwarding( Message * msg, const Entry * ep )
 	    long reply_port  = msg->reply_port;	/* Local copy	*/
 
 	    timeline_trace( SYNC_INTERACTION_REPLIES, ep, msg->client );
+#if HAVE_PARASOL
 	    ps_send( reply_port, 0, (char *)msg->init( ep, nullptr ), ps_my_std_port );
+#else
+	    (void) reply_port;
+	    _cp->rendezvous().reply( msg, msg );
+#endif
 
 	} else {
 				
 	    timeline_trace( SYNC_INTERACTION_FORWARDED, ep, msg->client, tp->entry() );
 
+#if HAVE_PARASOL
 	    msg->time_stamp   = Processor::now(); 		/* Tag send time.	*/
 	    msg->intermediate = ep;
 	    msg->target       = tp;
 
 	    ps_send( tp->entry()->get_port(),	/* Forward request.	*/
 		     tp->entry()->entry_id(), (char *)msg, msg->reply_port );
-	}
+#else
+	    throw std::runtime_error( "forwarding needs PARASOL" );
 #endif
+	}
     }
 }
 
@@ -1335,12 +1393,12 @@ Instance::Instance::random_shuffle_reply( std::vector<const Entry *>& array )
  * Sequence through activity list.
  */
 
-void
+process_t
 Instance::Instance::run_activities( Entry * ep, Activity * ap, bool reschedule )
 {
     while ( ap ) {
-	execute_activity( ep, ap, reschedule );
-	ap = next_activity( ep, ap, reschedule );
+	CO_AWAIT( execute_activity( ep, ap, reschedule ) );
+	CO_AWAIT( next_activity( ep, ap, reschedule, ap ) );
     }
 }
 
@@ -1350,13 +1408,13 @@ Instance::Instance::run_activities( Entry * ep, Activity * ap, bool reschedule )
  * Run an activity.
  */
 
-void
+process_t
 Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedule )
 {
 #if HAVE_PARASOL
     double start_time = ps_my_schedule_time;
 #else
-    double start_time = 0.;
+    double start_time = Processor::now();
 #endif
     double slices = 0.0;
     const int count = ap->is_specified() ? 1 : 0;
@@ -1378,7 +1436,7 @@ Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedul
 #if HAVE_PARASOL
 	ps_my_schedule_time = Processor::now() + think_time;
 #endif
-	processor()->sleep( think_time );
+	CO_AWAIT( processor()->sleep( think_time ) );
     }
 
     /*
@@ -1394,6 +1452,8 @@ Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedul
 
 #if HAVE_PARASOL
 	delta = Processor::now() - ps_my_schedule_time;
+#else
+	delta = 0.0;			/* compute() adds the wait for the processor. */
 #endif
 	ap->r_proc_delay.record( delta );		/* Delay for schedul.	*/
 	ap->r_proc_delay_sqr.record( square( delta ) );	/* Delay for schedul.	*/
@@ -1410,18 +1470,22 @@ Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedul
 	std::pair<size_t,size_t> history(0,0);
 	for ( ;; ) {
 
-	    compute( ap, phase );
+	    CO_AWAIT( compute( ap, phase ) );
 	    slices += 1.0;
 	    Call * tp = ap->_calls.get_next_target(history);
-#if HAVE_PARASOL
 
 	    if ( !tp ) break;
 
 	    sends += 1.0;
 	    if ( tp->reply() ) {
 	      //if(ep->name()=="retrievePage") printf("reply port=%ld\n", reply_port());
+#if HAVE_PARASOL
 		tp->send_synchronous( ep, _cp->priority(), reply_port() );
 		delta = Processor::now() - ps_my_schedule_time;
+#else
+		co_await tp->send_synchronous( ep, _cp->priority(), 0 );
+		delta = 0.0;		/* No processor is held while blocked.	*/
+#endif
 
 		ap->r_proc_delay.add( delta );
 		ap->r_proc_delay_sqr.add( square(delta + ap->_prewaiting) -  square(ap->_prewaiting) );
@@ -1439,7 +1503,6 @@ Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedul
 		    Processor::reschedule( this );
 		}
 	    }
-#endif
 	} /* end for loop */
 
 	ap->r_sends.record( sends );
@@ -1454,6 +1517,7 @@ Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedul
 
 	ap->r_cycle.record( delta );			/* Entry cycle time.	*/
 	ap->r_cycle_sqr.record( square(delta) );	/* Entry cycle time.	*/
+	ap->r_cycle_hist.insert( delta );
 	if ( ap->_hist_data ) {
 	    ap->_hist_data->insert( delta );
 	}
@@ -1502,6 +1566,7 @@ Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedul
 		    delta = Processor::now() - root_ptr()->_phase_start_time;
 		    ep->_phase[0].r_cycle.record( delta );
 		    ep->_phase[0].r_cycle_sqr.record( square(delta) );
+		    ep->_phase[0].r_cycle_hist.insert( delta );
 		    if ( ep->_phase[0]._hist_data ) {
 			ep->_phase[0]._hist_data->insert( delta );
 		    }
@@ -1555,12 +1620,13 @@ Instance::Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedul
  * May have to do joins and all that good stuff.
  */
 
-Activity * 
-Instance::Instance::next_activity( Entry * ep, Activity * ap_in, bool reschedule )
+process_t
+Instance::Instance::next_activity( Entry * ep, Activity * ap_in, bool reschedule, Activity *& ap_out )
 {
-    Activity * ap_out = nullptr;
     InputActivityList * fork_list = nullptr;
 
+    ap_out = nullptr;
+
     if ( ap_in->_output != 0 ) {
 
 	/*
@@ -1587,11 +1653,11 @@ Instance::Instance::next_activity( Entry * ep, Activity * ap_in, bool reschedule
 		    /* Mark entry busy */
 		    ep->_join_list = join_list;
 		    _cp->_join_start_time = Processor::now();
-		    return nullptr;	/* Do not execute output list. */
+		    CO_RETURN;	/* Do not execute output list. */
 		}
 	    } else {
 		/* tomari:quorum,  Histogram binning needs to be done here. */
-		return nullptr;	/* Thread complete. */
+		CO_RETURN;	/* Thread complete. */
 	    }
 	}
 	fork_list = ap_in->_output->get_next();
@@ -1648,14 +1714,7 @@ again_1:
 	} else if ( fork_list->get_type() == ActivityList::Type::OR_FORK_LIST ) {
 
 	    assert ( fork_list->size() > 0 );
-	    const double exit_value = Random::number();
-	    double sum = 0.0;
-	    size_t i = 0;
-	    for ( i = 0; i < fork_list->size(); ++i ) {
-		sum += static_cast<OrForkActivityList *>(fork_list)->get_prob_at(i);
-		if ( sum > exit_value ) break;
-	    }
-	    ap_out = fork_list->at(i);
+	    ap_out = fork_list->at( static_cast<OrForkActivityList *>(fork_list)->get_next_branch() );
 
 	} else if ( fork_list->get_type() == ActivityList::Type::FORK_LIST ) {
 	    assert( fork_list->size() <= 1 );
@@ -1669,20 +1728,18 @@ again_1:
 #if HAVE_PARASOL
 	    ps_my_end_compute_time = Processor::now();	/* BUG 321 */
 #endif
-	    const double exit_value = Random::number() * (loop_list->get_total() + 1.0);
+	    const double exit_value = loop_list->get_exit_value();
 	    double sum = 0;
 	    for ( ActivityList::const_iterator i  = loop_list->begin(); i < loop_list->end(); ++i ) {
 		sum += loop_list->get_count_at(i-loop_list->begin());
 		if ( sum > exit_value ) {
-		    run_activities( ep, *i, reschedule );
+		    CO_AWAIT( run_activities( ep, *i, reschedule ) );
 		    goto again_2;
 		}
 	    }
 	    ap_out = loop_list->get_exit();
 	}
     }
-
-    return ap_out;
 }
 
 
@@ -1700,6 +1757,8 @@ Instance::Instance::spawn_activities( const long entry_id, ActivityList * fork_l
 {
 #if HAVE_PARASOL
     ps_my_schedule_time = Processor::now();		/* In case we don't block...	*/
+#else
+    throw std::runtime_error( "AND-forks need PARASOL" );
 #endif
 
     for ( ActivityList::const_iterator i = fork_list->begin(); i != fork_list->end(); ++i ) {
@@ -1882,7 +1941,14 @@ Instance::Instance::timeline_trace( const trace_events event, ... )
 
     va_start( args, event );
 
-    if ( _cp->trace_flag && !timeline_flag ) {
+    if ( BinaryTrace::__trace != nullptr ) {
+	/* The end of a computation goes with its start. */
+	const unsigned long mask = (watched_events & TASK_IS_COMPUTING_BIT) != 0 ? watched_events | TASK_IS_DONE_COMPUTING_BIT : watched_events;
+	if ( _cp->trace_flag && ((1UL << event) & mask) != 0 ) {
+	    binary_trace( event, args );
+	}
+
+    } else if ( _cp->trace_flag && !timeline_flag ) {
 	double time;			/* Args for va-arg */
 	Entry * from_entry;
 	Entry * int_entry;
@@ -1996,6 +2062,10 @@ Instance::Instance::timeline_trace( const trace_events event, ... )
 	    (void) fprintf( stddbg, "Computing [%g]", time );
 	    break;
 
+	case TASK_IS_DONE_COMPUTING:
+	    (void) fprintf( stddbg, "Computed." );
+	    break;
+
 	case TASK_IS_WAITING:
 	    (void) fprintf( stddbg, "Waiting." );
 	    break;
@@ -2153,6 +2223,66 @@ Instance::Instance::timeline_trace( const trace_events event, ... )
 }
 
 
+/*
+ * Record the events for messages and computation in the binary trace.
+ * The arguments are those of timeline_trace().  Other events are not
+ * recorded.
+ */
+
+void
+Instance::Instance::binary_trace( const trace_events event, va_list args )
+{
+    const uint32_t id = task_id();
+    const Entry * entry;
+    const Entry * peer;
+
+    switch ( event ) {
+    case ASYNC_INTERACTION_INITIATED:
+    case SYNC_INTERACTION_INITIATED:
+	entry = va_arg( args, Entry * );
+	peer  = va_arg( args, Entry * );
+	BinaryTrace::__trace->record( event == SYNC_INTERACTION_INITIATED ? BinaryTrace::Event::SEND : BinaryTrace::Event::SEND_ASYNC,
+				      Processor::now(), id, entry->entry_id(), peer->entry_id() );
+	break;
+
+    case SYNC_INTERACTION_ESTABLISHED:
+	peer  = va_arg( args, Entry * );
+	(void) va_arg( args, Entry * );		/* Forwarded via.	*/
+	entry = va_arg( args, Entry * );
+	BinaryTrace::__trace->record( BinaryTrace::Event::RECEIVE, Processor::now(), id, entry->entry_id(), peer->entry_id(), va_arg( args, double ) );
+	break;
+
+    case SYNC_INTERACTION_REPLIES:
+	entry = va_arg( args, Entry * );
+	peer  = va_arg( args, Entry * );
+	BinaryTrace::__trace->record( BinaryTrace::Event::REPLY, Processor::now(), id, entry->entry_id(), peer->entry_id() );
+	break;
+
+    case SYNC_INTERACTION_COMPLETED:
+	entry = va_arg( args, Entry * );
+	(void) va_arg( args, Entry * );
+	peer  = va_arg( args, Entry * );	/* The entry that was called */
+	BinaryTrace::__trace->record( BinaryTrace::Event::REPLY_RECEIVED, Processor::now(), id, entry->entry_id(), peer->entry_id() );
+	break;
+
+    case SYNC_INTERACTION_FORWARDED:
+	entry = va_arg( args, Entry * );
+	(void) va_arg( args, Entry * );
+	peer  = va_arg( args, Entry * );
+	BinaryTrace::__trace->record( BinaryTrace::Event::FORWARD, Processor::now(), id, entry->entry_id(), peer->entry_id() );
+	break;
+
+    case TASK_IS_COMPUTING:
+	BinaryTrace::__trace->record( BinaryTrace::Event::COMPUTE_START, Processor::now(), id, BinaryTrace::NO_ENTRY, BinaryTrace::NO_ENTRY, va_arg( args, double ) );
+	break;
+
+    case TASK_IS_DONE_COMPUTING:
+	BinaryTrace::__trace->record( BinaryTrace::Event::COMPUTE_END, Processor::now(), id, BinaryTrace::NO_ENTRY, BinaryTrace::NO_ENTRY );
+	break;
+    }
+}
+
+
 /*
  * All done.  Inform timeline.
  */
@@ -17,11 +17,8 @@
 #ifndef	INSTANCE_H
 #define INSTANCE_H
 
+#include <cstdarg>
 #include <vector>
-#if !HAVE_PARASOL
-#include <thread>
-#include <condition_variable>
-#endif
 #include "lqsim.h"
 #include "task.h"
 
@@ -53,49 +50,46 @@ namespace Instance
 	Instance( Task * task, const std::string& task_name, long task_id );
 	virtual ~Instance() = 0;
     
-#if HAVE_PARASOL
 	long task_id() const { return _task_id; }
+#if HAVE_PARASOL
 	long node_id() const { return _node_id; }
 	long std_port() const { return _std_port; }
 	long reply_port() const { return _reply_port; }
 	long start_port() const { return _start_port; }
 	long thread_port() const { return _thread_port; }
-#else
-	bool set_thread( std::thread* thread ) { _thread = thread; return thread != nullptr; }
-	std::thread * get_thread() { return _thread; }
-	std::thread::id task_id() const { return _thread->get_id(); }
 #endif
 	Processor * processor() const { return _processor; }
 
 	const std::string& name() const { return _cp->name(); }
 	int priority() const { return _cp->priority(); }
 	virtual const std::string& type_name() const = 0;
-	virtual void run() = 0;
+	virtual process_t run() = 0;
 	virtual int parentPort() const{ return -1;}
 	virtual void setParent(int parentPort) {}
 	void timeline_trace( const trace_events event, ... );
+	void binary_trace( const trace_events event, va_list args );
     
     protected:
-	void client_cycle( Random * );
-	void server_cycle(  Entry *, Message * msg, bool reschedule );
-	Message * wait_for_message( long& entry_id );
+	process_t client_cycle( Random * );
+	process_t server_cycle(  Entry *, Message * msg, bool reschedule );
+	process_t wait_for_message( long& entry_id, Message *& msg );
 	Message * wait_for_message2( long& entry_id );
-	void run_activities( Entry * ep, Activity * ap, bool reschedule );
+	process_t run_activities( Entry * ep, Activity * ap, bool reschedule );
 
 	void timeline_quit();
 
     private:
 	virtual Instance * root_ptr() { return this; }
 
-	void execute_activity( Entry * ep, Activity * ap, bool& reschedule );
+	process_t execute_activity( Entry * ep, Activity * ap, bool& reschedule );
 	bool all_activities_done( const Activity * ap );
-	Activity * next_activity( Entry * ep, Activity * ap_in, bool reschedule );
+	process_t next_activity( Entry * ep, Activity * ap_in, bool reschedule, Activity *& ap_out );
 	void spawn_activities( const long entry_id, ActivityList * fork_list );
 	void wait_for_threads( AndForkActivityList * fork_list, double * thread_K_outOf_N_end_compute_time );
 	void flush_threads();
 	int thread_wait( double time_out, char ** msg, const bool flush, double * thread_end_compute_time );
 
-	void compute( Activity * ap, Activity * sp );
+	process_t compute( Activity * ap, Activity * sp );
 	void do_forwarding( Message * msg, const Entry * ep );
 
     public:
@@ -107,15 +101,11 @@ namespace Instance
 	double _hold_start_time;	/* For semaphores		*/
 
     private:
-#if !HAVE_PARASOL
-	std::thread* _thread;
-	std::condition_variable _instance_cv;
-#endif
 	Processor * _processor;
 	std::vector<Message *> _entry;	/* Msg at local entry i		*/
 
-#if HAVE_PARASOL
 	const long _task_id;		/* Parasol Task id.		*/
+#if HAVE_PARASOL
 	const long _node_id;		/* Parasol Node id.		*/
 	const long _std_port;		/* Main port.			*/
 	const long _reply_port;		/* reply port id		*/
@@ -165,11 +155,11 @@ namespace Instance
     {
 	/* CLIENT 		*/
     public:
-	Client( Task * cp, const std::string& task_name  );
+	Client( Task * cp, const std::string& task_name, unsigned int i );
 	~Client();
     
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::CLIENT); }
-	void run();
+	process_t run();
 
     private:
 	Random * _think_time;		/* Distribution generator	*/
@@ -184,7 +174,7 @@ namespace Instance
 	    : Real_Instance( cp, task_name ) {_parent_port=-1;}
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::SERVER); }
-	void run();
+	process_t run();
 	int parentPort() const{ return _parent_port;}
 	void setParent(int parentPort) {_parent_port=parentPort; }
     private:
@@ -201,7 +191,7 @@ namespace Instance
 	    : Virtual_Instance( cp, task_name ), _max_workers(max_workers) {_parent_port=-1;}
 
 	virtual const std::string& type_name() const;
-	void run();
+	process_t run();
 	int parentPort() const{ return _parent_port;}
 	void setParent(int parentPort) {_parent_port=parentPort; }
     private:
@@ -219,7 +209,7 @@ namespace Instance
 	    : Real_Instance( cp, task_name ) {}
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::SYNCHRONIZATION_SERVER); }
-	void run();
+	process_t run();
     };
 
 
@@ -231,7 +221,7 @@ namespace Instance
 	    : Virtual_Instance( cp, task_name ) {}
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::SEMAPHORE); }
-	void run();
+	process_t run();
 
     private:
     };
@@ -245,7 +235,7 @@ namespace Instance
 	    : Real_Instance( cp, task_name ) {}
 
 	const std::string& type_name() const { return Task::type_strings.at(Task::Type::TOKEN); }
-	void run();
+	process_t run();
     };
 
 
@@ -257,7 +247,7 @@ namespace Instance
 	    : Real_Instance( cp, task_name ) {}
 
 	const std::string& type_name() const { return Task::type_strings.at(Task::Type::TOKEN_R); }
-	void run();
+	process_t run();
     };
 
 
@@ -269,7 +259,7 @@ namespace Instance
 	    : Real_Instance( cp, task_name ) {}
 
 	const std::string& type_name() const { return Task::type_strings.at(Task::Type::WRITER_TOKEN); }
-	void run();
+	process_t run();
     };
 
     class RWLock_Server : public Virtual_Instance
@@ -280,7 +270,7 @@ namespace Instance
 	    : Virtual_Instance( cp, task_name ) {}
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::RWLOCK_SERVER); }
-	void run();
+	process_t run();
     };
 
 
@@ -291,7 +281,7 @@ namespace Instance
 	Open_Arrivals( Task * cp, const std::string& task_name );
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::OPEN_ARRIVAL_SOURCE); }
-	void run();
+	process_t run();
     };
 
 
@@ -303,7 +293,7 @@ namespace Instance
 	    : Real_Instance( cp, task_name ) {}
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::WORKER); }
-	void run();
+	process_t run();
     };
 
 
@@ -315,7 +305,7 @@ namespace Instance
 	    : Real_Instance( cp, task_name ), _root_ptr(rip) {}
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::THREAD); }
-	void run();
+	process_t run();
 
     private:
 	virtual Instance * root_ptr() { return _root_ptr; }
@@ -331,7 +321,7 @@ namespace Instance
 	    : Virtual_Instance( cp, task_name ) {}
 
 	virtual const std::string& type_name() const { return Task::type_strings.at(Task::Type::SIGNAL); }
-	void run();
+	process_t run();
     };
 }
 #if HAVE_PARASOL
@@ -0,0 +1,129 @@
+/* loghistogram.cc	-- October 2026
+ *
+ * ------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <lqio/dom_phase.h>
+#include "loghistogram.h"
+
+std::vector<LogHistogram *> LogHistogram::__histograms;
+const std::vector<double> LogHistogram::__percentiles = { 50., 90., 95., 99., 99.9 };
+
+LogHistogram::LogHistogram()
+    : _counts(N_BUCKETS), _n(0)
+{
+    __histograms.push_back( this );
+}
+
+
+LogHistogram::LogHistogram( const LogHistogram& src )
+    : _counts(src._counts), _n(src._n)
+{
+    __histograms.push_back( this );
+}
+
+
+LogHistogram::~LogHistogram()
+{
+    std::vector<LogHistogram *>::iterator histogram = std::find( __histograms.begin(), __histograms.end(), this );
+    if ( histogram != __histograms.end() ) {
+	__histograms.erase( histogram );
+    }
+}
+
+
+void
+LogHistogram::reset()
+{
+    std::fill( _counts.begin(), _counts.end(), 0 );
+    _n = 0;
+}
+
+
+/*
+ * Lower bound of bucket i.
+ */
+
+double
+LogHistogram::lower( const unsigned int i )
+{
+    if ( i == 0 ) return 0.;
+    const unsigned int j = i - 1;
+    return std::ldexp( 1.0 + static_cast<double>(j & (SUB_BUCKETS - 1)) / SUB_BUCKETS, MIN_EXPONENT + static_cast<int>(j >> SUB_BITS) );
+}
+
+
+/*
+ * The value below which p percent of the samples fall, interpolated
+ * linearly within the bucket.  Values in the overflow bucket are
+ * reported as its lower bound.
+ */
+
+double
+LogHistogram::percentile( const double p ) const
+{
+    if ( _n == 0 ) return 0.;
+    const double target = p / 100. * static_cast<double>(_n);
+    double sum = 0.;
+    for ( unsigned int i = 0; i < N_BUCKETS; ++i ) {
+	const double count = static_cast<double>(_counts[i]);
+	if ( count == 0. || sum + count < target ) {
+	    sum += count;
+	    continue;
+	} else if ( i == N_BUCKETS - 1 ) {
+	    return lower( i );
+	}
+	return lower( i ) + (target - sum) / count * (lower( i + 1 ) - lower( i ));
+    }
+    return lower( N_BUCKETS - 1 );
+}
+
+
+void
+LogHistogram::insertDOMResults( LQIO::DOM::Phase * dom ) const
+{
+    if ( dom == nullptr || _n == 0 ) return;
+    for ( std::vector<double>::const_iterator p = __percentiles.begin(); p != __percentiles.end(); ++p ) {
+	dom->setResultServiceTimePercentile( *p, percentile( *p ) );
+    }
+}
+
+
+/*
+ * Only the buckets in use are sent: their number, then the index and
+ * count of each.  The counts are exact as doubles up to 2^53.
+ * unpack() adds them to the current counts, and returns false if the
+ * values run past end or an index is out of range.
+ */
+
+void
+LogHistogram::pack( std::vector<double>& values ) const
+{
+    values.push_back( static_cast<double>(std::count_if( _counts.begin(), _counts.end(), []( uint64_t count ){ return count > 0; } )) );
+    for ( unsigned int i = 0; i < N_BUCKETS; ++i ) {
+	if ( _counts[i] == 0 ) continue;
+	values.push_back( static_cast<double>(i) );
+	values.push_back( static_cast<double>(_counts[i]) );
+    }
+}
+
+
+bool
+LogHistogram::unpack( std::vector<double>::const_iterator& value, const std::vector<double>::const_iterator& end )
+{
+    if ( value == end ) return false;
+    const size_t buckets = static_cast<size_t>(*value++);
+    if ( buckets > N_BUCKETS || static_cast<size_t>(end - value) < 2 * buckets ) return false;
+    for ( size_t k = 0; k < buckets; ++k ) {
+	const size_t i = static_cast<size_t>(*value++);
+	const uint64_t n = static_cast<uint64_t>(*value++);
+	if ( i >= N_BUCKETS ) return false;
+	_counts[i] += n;
+	_n += n;
+    }
+    return true;
+}
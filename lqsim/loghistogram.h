@@ -0,0 +1,81 @@
+/* -*- c++ -*- */
+/************************************************************************/
+/* Copyright the Real-Time and Distributed Systems Group,		*/
+/* Department of Systems and Computer Engineering,			*/
+/* Carleton University, Ottawa, Ontario, Canada. K1S 5B6		*/
+/* 									*/
+/* October 2026								*/
+/************************************************************************/
+
+/*
+ * Log-linear histogram of the cycle time of every phase and activity,
+ * used for percentiles (p99 and so on).  Unlike Histogram, it needs no
+ * range: each power of two from 2^MIN_EXPONENT to 2^MAX_EXPONENT is
+ * split into SUB_BUCKETS equal buckets, so a value is found from the
+ * bits of the double with one shift and the relative error is at most
+ * 1/SUB_BUCKETS.  Smaller values go into bucket 0, larger ones into
+ * the last bucket.
+ *
+ * The counts are kept over the whole run (not per block) so that
+ * histograms from replications can simply be added.
+ */
+
+#ifndef LQSIM_LOGHISTOGRAM_H
+#define LQSIM_LOGHISTOGRAM_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace LQIO {
+    namespace DOM {
+	class Phase;
+    }
+}
+
+class LogHistogram
+{
+public:
+    static constexpr int MIN_EXPONENT = -30;		/* 2^-30 ~ 1e-9		*/
+    static constexpr int MAX_EXPONENT = 34;		/* 2^34 ~ 1.7e10	*/
+    static constexpr unsigned int SUB_BITS = 4;
+    static constexpr unsigned int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr unsigned int N_BUCKETS = ((MAX_EXPONENT - MIN_EXPONENT) << SUB_BITS) + 2;
+
+    LogHistogram();
+    LogHistogram( const LogHistogram& );
+    ~LogHistogram();
+
+    void insert( const double value ) { _counts[index( value )] += 1; _n += 1; }
+    void reset();
+    void clear_results() { reset(); }
+    uint64_t count() const { return _n; }
+    double percentile( const double p ) const;
+
+    void insertDOMResults( LQIO::DOM::Phase * ) const;
+
+    void pack( std::vector<double>& ) const;	/* For replications	*/
+    bool unpack( std::vector<double>::const_iterator&, const std::vector<double>::const_iterator& );
+
+    static std::vector<LogHistogram *> __histograms;
+    static const std::vector<double> __percentiles;	/* Exported to the DOM	*/
+
+private:
+    LogHistogram& operator=( const LogHistogram& );
+
+    static unsigned int index( const double value )
+	{
+	    uint64_t bits;
+	    std::memcpy( &bits, &value, sizeof( bits ) );
+	    const int64_t i = static_cast<int64_t>(bits >> (52 - SUB_BITS)) - (static_cast<int64_t>(1023 + MIN_EXPONENT) << SUB_BITS);
+	    if ( i < 0 ) return 0;				/* Also zero.		*/
+	    else if ( i >= N_BUCKETS - 2 ) return N_BUCKETS - 1;	/* Also NaN.		*/
+	    return static_cast<unsigned int>(i) + 1;
+	}
+    static double lower( const unsigned int i );
+
+private:
+    std::vector<uint64_t> _counts;
+    uint64_t _n;			/* Sum of _counts.		*/
+};
+#endif
@@ -41,6 +41,7 @@
 #include <lqio/commandline.h>
 #include <lqio/srvn_spex.h>
 #include <lqio/dom_pragma.h>
+#include "checkpoint.h"
 #include "errmsg.h"
 #include "model.h"
 #include "pragma.h"
@@ -69,6 +70,7 @@ bool verbose_flag 	      = false;	/* Verbose text output?	    	*/
 bool no_execute_flag	      = false;	/* Run simulation if false	*/
 bool timeline_flag	      = false;	/* Generate output for timeline	*/
 bool trace_msgbuf_flag        = false;	/* Observe msg buffer operation	*/
+bool profile_flag	      = false;	/* Time the parasol kernel.	*/
 #if STACK_TESTING
 bool check_stacks	      = false;	/* Enable parasol stack check.	*/
 #endif
@@ -76,7 +78,7 @@ bool check_stacks	      = false;	/* Enable parasol stack check.	*/
 bool debug_interactive_stepping = false;
 
 unsigned max_num_bins	      = 20;
-unsigned long watched_events = 0xffffffff;	/* trace everything	*/
+unsigned long watched_events = 0xffffffff & ~TASK_IS_DONE_COMPUTING_BIT;	/* trace everything	*/
 
 matherr_type matherr_disposition;	/* What to do on FPE error.	*/
 
@@ -86,6 +88,7 @@ int nice_value		= 10;		/* For nicing. 			*/
 
 char copyright_date[20];
 char * histogram_output_file = 0;
+char * binary_trace_file = nullptr;
 
 FILE * stddbg;				/* debugging output goes here.	*/
 
@@ -127,12 +130,16 @@ static const struct option longopts[] =
     { "no-stop-on-message-loss", no_argument,0, 256+'o' },
     { "reload-lqx",	  no_argument,       0, 256+'r' },
     { "restart",	  no_argument,	     0, 256+'R' },
+    { "checkpoint",	  optional_argument, 0, 256+'C' },
+    { "resume",		  no_argument,	     0, 256+'u' },
+    { "warm-start",	  required_argument, 0, 256+'W' },
     { "no-header",	  no_argument,	     0, 256+'h' },
     { "print-comment",	  no_argument,	     0, 256+'c' },
     { "debug-json",	  no_argument,	     0, 256+'j' },
     { "debug-lqx",        no_argument,       0, 256+'l' },
     { "debug-xml",        no_argument,       0, 256+'x' },
     { "print-lqx",	  no_argument,	     0, 256+'s' },
+    { "profile",	  no_argument,	     0, 256+'P' },
 #if STACK_TESTING
     { "check-stacks",	  no_argument,	     0, 256+'S' },
 #endif
@@ -175,12 +182,16 @@ static const std::map<const std::string,const std::string> opthelp  = {
     { "no-stop-on-message-loss",      "Do not stop the simulator if asynchronous messages are lost due to queue overfull." },
     { "reload-lqx",	    "Run the LQX program, but re-use the results from a previous invocation." },
     { "restart",	    "Reuse existing valid results.  Otherwise, run the simulation." },
+    { "checkpoint",	    "Save the blocks run so far every ARG seconds (default 60) so the simulation can be resumed." },
+    { "resume",		    "Continue the simulation from its checkpoint, if any.  Implies --checkpoint." },
+    { "warm-start",	    "Start the reference tasks with the throughputs found in the results file ARG, e.g., from lqns." },
     { "print-comment",	    "Output the model comment on SPEX results." },
     { "no-header",    	    "Do not output the variable name header on SPEX results." },
     { "debug-lqx",	    "Output debugging information while parsing LQX input." },
     { "debug-xml",	    "Output debugging information while parsing XML input." },
     { "debug-json", 	    "Output debugging information while parsing JSON input." },
     { "print-lqx",	    "Output the LQX progam corresponding to SPEX input." },
+    { "profile",	    "Output on standard error the time spent handling each kind of simulation kernel event." },
     { "check-stacks", 	    "Check stack size after simulation run." }
 };
 
@@ -199,6 +210,8 @@ static const char * trace_opts[] = {
     "msgbuf",
 #define GROUP  6
 	"group",
+#define BINARY 7
+    "binary",
     0
 };
 
@@ -216,6 +229,7 @@ static const char * events[] = {
     "task-ready",	/* TASK_IS_READY, */
     "task-running",	/* TASK_IS_RUNNING, */
     "task-computing",	/* TASK_IS_COMPUTING */
+    "task-computed",	/* TASK_IS_DONE_COMPUTING */
     "task-waiting",	/* TASK_IS_WAITING, */
     "thread-start",	/* THREAD_START, */
     "thread-enqueue",	/* THREAD_ENQUEUE_MSG, */
@@ -295,6 +309,8 @@ main( int argc, char * argv[] )
     char * options;
     char * value;
     extern int optind;
+    bool task_pattern = false;		/* -ttask given.		*/
+    const char * warm_start_file = nullptr;	/* --warm-start.		*/
 
     LQIO::CommandLine command_line( longopts );
 
@@ -500,6 +516,16 @@ main( int argc, char * argv[] )
 		Model::__enable_print_interval = true;
 		break;
 				
+	    case 256+'C':
+		Model::__checkpoint_interval = Checkpoint::DEFAULT_INTERVAL;
+		if ( optarg != nullptr ) {
+		    Model::__checkpoint_interval = strtod( optarg, &value );
+		    if ( *value != '\0' || Model::__checkpoint_interval <= 0. ) {
+			throw std::invalid_argument( optarg );
+		    }
+		}
+		break;
+
 	    case 'Q':
 		pragmas.insert(LQIO::DOM::Pragma::_queue_size_,optarg);
 		break;
@@ -520,6 +546,14 @@ main( int argc, char * argv[] )
 		solve_function = &Model::restart;
 		break;
 
+	    case 256+'u':
+		Model::__resume = true;
+		break;
+
+	    case 256+'W':
+		warm_start_file = optarg;
+		break;
+
 	    case 'S':
 		pragmas.insert(LQIO::DOM::Pragma::_seed_value_,optarg);
 		break;
@@ -532,6 +566,10 @@ main( int argc, char * argv[] )
 	    case 256+'s':
 		print_lqx = true;
 		break;
+
+	    case 256+'P':
+		profile_flag = true;
+		break;
 		
 #if STACK_TESTING
 	    case 256+'S':
@@ -557,6 +595,7 @@ main( int argc, char * argv[] )
 				
 		    case TASK:
 			task_match_pattern = (value != nullptr) ? value : ".*";
+			task_pattern = true;
 			break;
 
 		    case EVENTS:
@@ -570,6 +609,11 @@ main( int argc, char * argv[] )
 		    case MSGBUF:
 			trace_msgbuf_flag = true;
 			break;
+
+		    case BINARY:
+			if ( value == nullptr ) throw std::invalid_argument( "binary" );
+			binary_trace_file = value;
+			break;
 				
 		    default:
 			throw std::invalid_argument( optarg );
@@ -619,6 +663,15 @@ main( int argc, char * argv[] )
 
     LQIO::io_vars.lq_command_line = command_line.c_str();
 
+    if ( warm_start_file != nullptr && !Model::load_warm_start( warm_start_file ) ) {
+	(void) fprintf( stderr, "%s: --warm-start: cannot load results from %s.\n", LQIO::io_vars.toolname(), warm_start_file );
+	exit( FILEIO_ERROR );
+    }
+
+    if ( binary_trace_file != nullptr && !task_pattern ) {
+	task_match_pattern = ".*";		/* Trace all tasks by default.	*/
+    }
+
 #if !defined(__WINNT__)
     if ( nice_value != 10 ) {
 	errno = 0;	/* Lower nice level for run */
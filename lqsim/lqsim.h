@@ -25,6 +25,25 @@
 
 #if HAVE_PARASOL
 #include <parasol/parasol.h>
+#else
+#include "eventhandler.h"
+#endif
+
+/*
+ * Code that can block.  A PARASOL task has a stack of its own, so it
+ * blocks in an ordinary function.  Without PARASOL, a task instance is
+ * a coroutine run by the EventHandler, and every function on the way
+ * down to a blocking call is a coroutine that is awaited.
+ */
+
+#if HAVE_PARASOL
+typedef void process_t;
+#define	CO_AWAIT(call)	(call)
+#define	CO_RETURN	return
+#else
+typedef Process process_t;
+#define	CO_AWAIT(call)	(co_await (call))
+#define	CO_RETURN	co_return
 #endif
 
 #define	MAX_PHASES	3
@@ -44,6 +63,7 @@ extern bool verbose_flag;		/* Verbose text output?	    	*/
 extern bool no_execute_flag;		/* Run simulation if false	*/
 extern bool timeline_flag;		/* Generate output for timeline	*/
 extern bool trace_msgbuf_flag;		/* Observe msg buffer operation	*/
+extern bool profile_flag;		/* Time the parasol kernel.	*/
 extern bool reload_flag;		/* Reload results from LQX run.	*/
 extern bool restart_flag;		/* Restart and mussing run 	*/
 extern bool quorum_delayed_calls;	/* Quorum reply (BUG_311)	*/
@@ -56,6 +76,7 @@ extern int trace_driver;		/* trace sim. drriver.		*/
 extern int scheduling_model;		/* Slice/Natural scheduling.	*/
 
 extern char * histogram_output_file;	/* File name for histogram data	*/
+extern char * binary_trace_file;	/* File name for binary trace	*/
 
 extern std::regex processor_match_pattern;	/* Pattern to match.	    */
 extern std::regex task_match_pattern;		/* Pattern to match.	    */
@@ -98,6 +119,7 @@ typedef enum
     TASK_IS_READY,
     TASK_IS_RUNNING,			/* doing message passing... */
     TASK_IS_COMPUTING,			/* executing virtual code... */
+    TASK_IS_DONE_COMPUTING,
     TASK_IS_WAITING,
     THREAD_START,
     THREAD_ENQUEUE_MSG,
@@ -132,6 +154,7 @@ typedef enum
 #define TASK_IS_READY_BIT (1<<TASK_IS_READY)
 #define TASK_IS_RUNNING_BIT (1<<TASK_IS_RUNNING)
 #define TASK_IS_COMPUTING_BIT (1<<TASK_IS_COMPUTING)
+#define TASK_IS_DONE_COMPUTING_BIT (1<<TASK_IS_DONE_COMPUTING)
 #define TASK_IS_WAITING_BIT (1<<TASK_IS_WAITING)
 #define THREAD_START_BIT (1<<THREAD_START)
 #define THREAD_ENQUEUE_MSG_BIT (1<<THREAD_ENQUEUE_MSG)
@@ -13,9 +13,14 @@
  * $Id: message.cc 17518 2024-12-19 15:18:23Z greg $
  */
 
+#include "lqsim.h"
+#include <cassert>
 #include "message.h"
 #include "processor.h"
 
+#if HAVE_PARASOL
+ps_slab_t Message::__slab = PS_SLAB( "lqsim messages", Message );
+#endif
 
 Message::Message( const Entry * e, Call * tp )
     : client(e), target(tp), activity(nullptr), time_stamp(Processor::now()), reply_port(-1), intermediate(nullptr)
@@ -37,3 +42,24 @@ Message::init( const Entry * ep, Call * destination )
 
     return this;
 }
+
+
+#if HAVE_PARASOL
+/*
+ * Messages are kept together in a slab, which grows as needed.
+ */
+
+void *
+Message::operator new( size_t size )
+{
+    assert( size == sizeof( Message ) );
+    return ps_get_slot( &__slab );
+}
+
+
+void
+Message::operator delete( void * p )
+{
+    if ( p != nullptr ) ps_free_slot( &__slab, p );
+}
+#endif
@@ -16,6 +16,10 @@
 #ifndef LQSIM_MESSAGE_H
 #define LQSIM_MESSAGE_H
 
+#if HAVE_PARASOL
+#include <parasol/para_types.h>
+#endif
+
 class Activity;
 class Entry;
 class Call;
@@ -24,6 +28,13 @@ class Message {
 public:
     Message( const Entry * e=nullptr, Call * tp=nullptr );
     Message * init( const Entry * ep, Call * src );
+#if HAVE_PARASOL
+    static void * operator new( size_t size );
+    static void operator delete( void * p );
+
+private:
+    static ps_slab_t __slab;		/* Asynchronous messages.	*/
+#endif
     
 public:
     const Entry * client;		/* Pointer to sending entry.    */
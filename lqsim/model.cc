@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <functional>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <sstream>
@@ -34,8 +35,11 @@
 #include <lqio/json_document.h>
 #include <lqio/srvn_output.h>
 #include <lqio/srvn_spex.h>
+#include <lqio/sweep.h>
 #include "lqsim.h"
 #include "activity.h"
+#include "bintrace.h"
+#include "checkpoint.h"
 #include "entry.h"
 #include "errmsg.h"
 #include "group.h"
@@ -43,6 +47,7 @@
 #include "model.h"
 #include "pragma.h"
 #include "processor.h"
+#include "replicas.h"
 #include "runlqx.h"		// Coupling here is ugly at the moment
 #include "task.h"
 
@@ -56,6 +61,9 @@ int Model::__genesis_task_id = 0;
 Model * Model::__model = nullptr;
 bool Model::__enable_print_interval = false;
 unsigned int Model::__print_interval = 0;
+double Model::__checkpoint_interval = 0.;
+bool Model::__resume = false;
+std::map<std::string,double> Model::__warm_start;
 double Model::max_service = 0.0;
 const double Model::simulation_parameters::DEFAULT_TIME = 1e5;
 bool deferred_exception = false;	/* domain error detected during run.. throw after parasol stops. */
@@ -70,7 +78,7 @@ bool print_lqx = false;
  */
 
 Model::Model( LQIO::DOM::Document* document, const std::filesystem::path& input_file_name, const std::filesystem::path& output_file_name, LQIO::DOM::Document::OutputFormat output_format )
-    : _document(document), _input_file_name(input_file_name), _output_file_name(output_file_name), _output_format(output_format), _parameters(), _confidence(0.0)
+    : _document(document), _input_file_name(input_file_name), _output_file_name(output_file_name), _output_format(output_format), _parameters(), _confidence(0.0), _replicas(nullptr), _checkpoint(nullptr)
 {
     __model = this;
 
@@ -175,8 +183,15 @@ Model::solve( solve_using run_function, const std::filesystem::path& input_file_
 		/* Don't create directories etc if there are no loops (i.e., parameters only) */
 		SolverInterface::Solve::implicitSolve = LQIO::Spex::has_vars() && !LQIO::Spex::has_loops();
 
-		/* Invoke the LQX program itself */
-		if ( !program->invoke() ) {		/* Run simulation	*/
+		/* Invoke the LQX program itself, on the workers if the points of a sweep are independent */
+		const LQIO::Sweep sweep( program, LQIO::Sweep::independent() ? Pragma::__pragmas->spex_workers() : 1 );
+		if ( sweep.workers() > 1 && document->getPragmaList().find( LQIO::DOM::Pragma::_seed_value_ ) == document->getPragmaList().end() ) {
+		    /* Every worker has to use the seed that a serial run would have picked. */
+		    document->addPragma( LQIO::DOM::Pragma::_seed_value_, std::to_string( time( nullptr ) ) );
+		}
+		if ( sweep( output != nullptr ? output : stdout ) ) {
+		    /* Done. */
+		} else if ( !program->invoke() ) {		/* Run simulation	*/
 		    LQIO::runtime_error( LQIO::ERR_LQX_EXECUTION, input_file_name.c_str() );
 		    status = INVALID_INPUT;
 		} else if ( !SolverInterface::Solve::solveCallViaLQX ) {
@@ -215,6 +230,30 @@ Model::solve( solve_using run_function, const std::filesystem::path& input_file_
 }
 
 
+/*
+ * Read the task throughputs from the results of another solver, such
+ * as lqns, for --warm-start.  The file is loaded before any model so
+ * that it does not disturb the document being solved.
+ */
+
+bool
+Model::load_warm_start( const std::filesystem::path& file_name )
+{
+    unsigned int status = 0;
+    LQIO::DOM::Document* document = LQIO::DOM::Document::load( file_name, LQIO::DOM::Document::InputFormat::AUTOMATIC, status, true );
+    if ( document == nullptr || LQIO::io_vars.anError() ) {
+	if ( document ) delete document;
+	return false;
+    }
+
+    for ( std::map<std::string,LQIO::DOM::Task*>::const_iterator task = document->getTasks().begin(); task != document->getTasks().end(); ++task ) {
+	__warm_start[task->first] = task->second->getResultThroughput();
+    }
+    delete document;
+    return true;
+}
+
+
 /*
  * Step 2: convert DOM into lqn entities.  Runs outside of simulation.
  */
@@ -338,8 +377,8 @@ Model::extend()
 
 /*
 #if !HAVE_PARASOL
- * Called from Model::start to create the processor mutexs and task threads.
- * Everything should be running with this method returns.
+ * Called from Model::run to create the processors and the task
+ * instances.  The instances are started by Task::run().
 #else
  * Called from ps_genesis() by ps_run_parasol().
  *
@@ -355,9 +394,7 @@ Model::extend()
 bool
 Model::create()
 {
-#if HAVE_PARASOL
     std::for_each( Processor::__processors.begin(), Processor::__processors.end(), std::mem_fn( &Processor::create ) );
-#endif
     std::for_each( Group::__groups.begin(), Group::__groups.end(), std::mem_fn( &Group::create ) );
     std::for_each( Task::__tasks.begin(), Task::__tasks.end(), std::mem_fn( &Task::create ) );
 
@@ -391,6 +428,8 @@ Model::create()
 bool
 Model::start()
 {
+    Random::set_common_random_numbers( Pragma::__pragmas->common_random_numbers() );	/* Before the streams are named. */
+    Random::restart_streams();		/* Number the streams as if this were the only solution. */
     std::for_each( Task::__tasks.begin(), Task::__tasks.end(), std::mem_fn( &Task::configure ) );
 
     /*
@@ -403,6 +442,7 @@ Model::start()
 
     /* Which we can use here... */
 
+    warm_start();
     _parameters.set( _document->getPragmaList(), client_cycle_time );
     Random::seed( _parameters._seed );
 
@@ -420,10 +460,115 @@ Model::start()
     } else {
 	simulation_flags = simulation_flags | RPF_WARNING;
     }
+    if ( Pragma::__pragmas->calendar_list() ) {
+	simulation_flags = simulation_flags | RPF_LIST;
+    }
+    if ( profile_flag ) {
+	simulation_flags = simulation_flags | RPF_PROFILE;
+    }
+
+    /*
+     * Fork the workers for the other replications.  Each one runs its
+     * own simulation with its own random number stream then exits.
+     */
 
-    ps_run_parasol( _parameters._run_time+1.0, _parameters._seed, simulation_flags );	/* Calls ps_genesis */
+    const bool paired = Pragma::__pragmas->antithetic() && Pragma::__pragmas->replicas() > 1 && Pragma::__pragmas->replicas() % 2 == 0;
+    if ( Pragma::__pragmas->antithetic() && !paired && !no_execute_flag ) {
+	std::cerr << LQIO::io_vars.lq_toolname << ": antithetic pairs need an even number of replicas; ignored." << std::endl;
+    }
+    if ( Pragma::__pragmas->replicas() > 1 && !no_execute_flag ) {
+	_replicas = new Replicas( Pragma::__pragmas->replicas(), paired );
+    }
+    Random::set_antithetic_pairs( _replicas != nullptr && _replicas->paired() );
+
+    /*
+     * The checkpoint is kept next to the input file.  With --resume,
+     * carry on from the blocks that it holds.  The cross products of
+     * antithetic pairs are not saved, so they are not checkpointed.
+     */
+
+    if ( (__checkpoint_interval > 0. || __resume) && _replicas != nullptr && _replicas->paired() ) {
+	std::cerr << LQIO::io_vars.lq_toolname << ": antithetic replicas cannot be checkpointed." << std::endl;
+    } else if ( (__checkpoint_interval > 0. || __resume) && !no_execute_flag && _input_file_name != "-" ) {
+	const std::vector<double> options = { static_cast<double>(_document->getResultInvocationNumber()), static_cast<double>(_parameters._seed), _parameters._precision,
+					      static_cast<double>(Pragma::__pragmas->sequential()) };
+	_checkpoint = new Checkpoint( LQIO::Filename( _input_file_name, "ckpt" )(), __checkpoint_interval > 0. ? __checkpoint_interval : Checkpoint::DEFAULT_INTERVAL,
+				      Checkpoint::fingerprint( _input_file_name, options ), _replicas != nullptr ? _replicas->size() : 1 );
+	if ( __resume && _checkpoint->load() ) {
+	    const Checkpoint::Parameters parameters = _checkpoint->parameters();
+	    _parameters._initial_delay = parameters.initial_delay;
+	    _parameters._block_period = parameters.block_period;
+	    _parameters._max_blocks = parameters.max_blocks;
+	    if ( verbose_flag ) {
+		(void) fprintf( stderr, "%s: resuming after block %lu.\n", _checkpoint->file_name().string().c_str(), _checkpoint->blocks() );
+	    }
+	}
+    }
+
+    if ( _replicas != nullptr ) {
+	if ( !_replicas->start() ) {
+	    std::cerr << LQIO::io_vars.lq_toolname << ": cannot start replications: " << strerror( errno ) << std::endl;
+	    delete _replicas;
+	    _replicas = nullptr;
+	} else if ( Replicas::worker() > 0 ) {
+	    delete _replicas;
+	    _replicas = nullptr;
+	    Random::seed( _parameters._seed, Replicas::worker() );
+	    verbose_flag = false;
+	}
+    }
+    const unsigned int stream = _checkpoint != nullptr && _checkpoint->loaded() ? _checkpoint->stream( Replicas::worker() ) : Replicas::worker();
+    if ( stream != Replicas::worker() ) {
+	Random::seed( _parameters._seed, stream );	/* Not the streams of the earlier runs. */
+    }
+
+    /* Only the parent (or the only process) writes the binary trace. */
+
+    if ( binary_trace_file != nullptr && Replicas::worker() == 0 ) {
+	BinaryTrace::__trace = BinaryTrace::create( binary_trace_file_name() );
+	if ( BinaryTrace::__trace == nullptr ) {
+	    runtime_error( LQIO::ERR_CANT_OPEN_FILE, binary_trace_file_name().c_str(), strerror( errno ) );
+	}
+    }
+
+    try {
+	ps_run_parasol( _parameters._run_time+1.0, _parameters._seed + stream, simulation_flags );	/* Calls ps_genesis */
+    }
+    catch ( ... ) {
+	if ( Replicas::worker() > 0 ) Replicas::exit( false );
+	throw;
+    }
+    if ( Replicas::worker() > 0 ) {
+	Replicas::exit( !deferred_exception && LQIO::io_vars.anError() == 0 );
+    } else if ( _replicas != nullptr ) {
+	if ( !_replicas->wait() && !deferred_exception ) {
+	    std::cerr << LQIO::io_vars.lq_toolname << ": runtime error: a replication failed." << std::endl;
+	    deferred_exception = true;
+	}
+	delete _replicas;
+	_replicas = nullptr;
+    }
+    if ( _checkpoint != nullptr ) {
+	if ( !deferred_exception ) {
+	    _checkpoint->remove();
+	}
+	delete _checkpoint;
+	_checkpoint = nullptr;
+    }
+
+    if ( verbose_flag ) {
+	for ( ps_slab_t * slab = ps_next_slab( nullptr ); slab != nullptr; slab = ps_next_slab( slab ) ) {
+	    (void) fprintf( stderr, "%s: %ld allocated, %ld in use (at most %ld), %ld blocks.\n", slab->name, slab->gets, slab->used, slab->max_used, slab->nblocks );
+	}
+    }
+    if ( verbose_flag || profile_flag ) {
+	print_profile( stderr );
+    }
 #else
-    run();
+    {
+	EventHandler event_handler;	/* Runs the task instances.	*/
+	run();
+    }
 #endif
 
     /*
@@ -463,6 +608,23 @@ Model::start()
     }
 #endif
 
+    if ( BinaryTrace::__trace != nullptr ) {
+#if HAVE_PARASOL
+	for ( unsigned i = 1; i <= total_tasks; ++i ) {
+	    const Instance::Instance * ip = object_tab.at(i);
+	    if ( ip != nullptr ) BinaryTrace::__trace->name( BinaryTrace::Kind::INSTANCE, i, ip->name() );
+	}
+#endif
+	for ( const Entry * entry : Entry::__entries ) {
+	    BinaryTrace::__trace->name( BinaryTrace::Kind::ENTRY, entry->entry_id(), entry->name() );
+	}
+	if ( !BinaryTrace::__trace->close() ) {
+	    std::cerr << LQIO::io_vars.lq_toolname << ": cannot write " << binary_trace_file_name().string() << ": " << strerror( errno ) << std::endl;
+	}
+	delete BinaryTrace::__trace;
+	BinaryTrace::__trace = nullptr;
+    }
+
 #if HAVE_PARASOL
     for ( unsigned i = 1; i <= total_tasks; ++i ) {
 	Instance::Instance * ip = object_tab.at(i);
@@ -573,9 +735,18 @@ Model::run()
 	     * Start all of the tasks.
 	     */
 
-	    std::for_each( Task::__tasks.begin(), Task::__tasks.end(), []( Task * task ){ task->run(); } );
+	    if ( !std::all_of( Task::__tasks.begin(), Task::__tasks.end(), []( Task * task ){ return task->run(); } ) ) {
+		throw std::runtime_error( "cannot start the tasks" );
+	    }
 
-	    if ( _parameters._initial_delay ) {
+	    const bool resumed = _checkpoint != nullptr && _checkpoint->loaded();
+	    if ( Pragma::__pragmas->sequential() && !resumed ) {
+		if ( verbose_flag ) {
+		    (void) putc( 'I', stderr );
+		}
+		if ( !pilot() ) throw std::runtime_error( "a replication failed" );
+		if ( deferred_exception ) throw std::runtime_error( "terminating" );
+	    } else if ( _parameters._initial_delay ) {
 		if ( verbose_flag ) {
 		    (void) putc( 'I', stderr );
 		}
@@ -590,11 +761,18 @@ Model::run()
 	    reset_stats();
 
 	    /*
-	     * Accumulate statistical data.
+	     * Accumulate statistical data, starting with the blocks saved
+	     * in the checkpoint if resuming.
 	     */
 
+	    unsigned long first_block = 1;
+	    if ( resumed ) {
+		if ( !Replicas::restore( _checkpoint->totals( Replicas::worker() ) ) ) throw std::runtime_error( "checkpoint does not match the model" );
+		first_block = _checkpoint->blocks() + 1;
+	    }
+
 	    bool valid = false;
-	    for ( number_blocks = 1; !valid && number_blocks <= _parameters._max_blocks; number_blocks += 1 ) {
+	    for ( number_blocks = first_block; !valid && number_blocks <= _parameters._max_blocks; number_blocks += 1 ) {
 
 		if ( verbose_flag ) {
 		    (void) fprintf( stderr, " %c", "0123456789"[number_blocks%10] );
@@ -603,23 +781,45 @@ Model::run()
 		sleep( _parameters._block_period );
 		accumulate_data();
 
+		if ( Replicas::worker() > 0 ) {
+		    valid = Replicas::block();		/* The parent decides. */
+		    if ( deferred_exception ) throw std::runtime_error( "terminating" );
+		    continue;
+		}
+
+		const unsigned long blocks = number_blocks;
+		if ( _replicas != nullptr ) {
+		    if ( !_replicas->merge() ) throw std::runtime_error( "a replication failed" );
+		    number_blocks *= _replicas->samples();	/* Pooled over all replications. */
+		}
+
 		if ( number_blocks > 2 ) {
-		    _confidence = rms_confidence();
+		    _confidence = Pragma::__pragmas->sequential() ? max_confidence() : rms_confidence();
 		    if ( verbose_flag ) {
 			(void) fprintf( stderr, "[%.2g]", _confidence );
 			if ( number_blocks % 10 == 0 ) {
 			    (void) putc( '\n', stderr );
 			}
 		    }
-		    valid = _confidence <= _parameters._precision;
+		    valid = _confidence <= _parameters._precision && (!Pragma::__pragmas->sequential() || number_blocks >= MIN_BATCHES);
 		}
 
 		insertDOMResults();
 
+		if ( _checkpoint != nullptr && !valid && blocks < _parameters._max_blocks && _checkpoint->due() ) {
+		    save_checkpoint( blocks );
+		}
+
 		if ( __enable_print_interval && !valid && __print_interval > 0 && number_blocks % __print_interval == 0 ) {
 		    print_intermediate();
 		}
 
+		if ( _replicas != nullptr ) {
+		    const bool stop = valid || blocks == _parameters._max_blocks;
+		    if ( !_replicas->resume( stop ) ) throw std::runtime_error( "a replication failed" );
+		    if ( !stop ) number_blocks = blocks;
+		}
+
 		if ( deferred_exception ) throw std::runtime_error( "terminating" );
 	    }
 
@@ -643,11 +843,11 @@ Model::run()
 
     ps_run_time = -1.1;
     ps_sleep(1.0);
+#endif
 
     /* Remove instances */
 
     std::for_each( Task::__tasks.begin(), Task::__tasks.end(), std::mem_fn( &Task::stop ) );
-#endif
 
     return rc;
 }
@@ -684,6 +884,175 @@ Model::reset_stats()
 
 
 
+/*
+ * MSER-5: the number of leading values of x to discard, a multiple of
+ * MSER_BATCH, which minimizes the standard error of the mean of the
+ * rest.  The search is limited to the first half; x.size() is returned
+ * if the minimum is at the limit, in which case the transient may not
+ * be over.
+ */
+
+static size_t
+mser5( const std::vector<double>& x, const size_t group )
+{
+    const size_t m = x.size() / group;
+    std::vector<double> z( m );
+    for ( size_t j = 0; j < m; ++j ) {
+	z[j] = std::accumulate( x.begin() + j * group, x.begin() + (j + 1) * group, 0.0 ) / static_cast<double>(group);
+    }
+
+    double sum = 0.;
+    double sum_sqr = 0.;
+    double best = std::numeric_limits<double>::max();
+    size_t d_best = m;
+    for ( size_t d = m; d-- > 0; ) {
+	sum += z[d];
+	sum_sqr += square( z[d] );
+	if ( d > m / 2 ) continue;
+	const double k = static_cast<double>(m - d);
+	const double mser = (sum_sqr - square( sum ) / k) / square( k );
+	if ( mser <= best ) {
+	    best = mser;
+	    d_best = d;
+	}
+    }
+    return d_best < m / 2 ? d_best * group : x.size();
+}
+
+
+/*
+ * Lag 1 autocorrelation of the means of batches of b values of x,
+ * starting at begin.
+ */
+
+static double
+autocorrelation( const std::vector<double>& x, const size_t begin, const size_t b )
+{
+    const size_t k = (x.size() - begin) / b;
+    std::vector<double> y( k );
+    for ( size_t j = 0; j < k; ++j ) {
+	y[j] = std::accumulate( x.begin() + begin + j * b, x.begin() + begin + (j + 1) * b, 0.0 ) / static_cast<double>(b);
+    }
+    const double mean = std::accumulate( y.begin(), y.end(), 0.0 ) / static_cast<double>(k);
+    double numerator = 0.;
+    double denominator = 0.;
+    for ( size_t j = 0; j < k; ++j ) {
+	denominator += square( y[j] - mean );
+	if ( j + 1 < k ) numerator += (y[j] - mean) * (y[j + 1] - mean);
+    }
+    return denominator > 0. ? numerator / denominator : 0.;
+}
+
+
+/*
+ * Start each customer of a reference task thinking with the
+ * probability, X * Z / N, that it is thinking in the steady state
+ * predicted by --warm-start.  The others send their first request at
+ * once.  Only the throughputs are used: Parasol cannot seed the
+ * queues with messages, so every customer that is not thinking starts
+ * at its first server and the start is still biased.  The warm up is
+ * therefore not shortened, other than by the MSER-5 test of pragma
+ * sequential.  The results are for one model, so only the first
+ * solution of an LQX or SPEX program uses them.
+ */
+
+void
+Model::warm_start() const
+{
+    for ( Task * task : Task::__tasks ) {
+	if ( task->type() != Task::Type::CLIENT ) continue;
+	double thinking = 1.0;
+	std::map<std::string,double>::const_iterator result = __warm_start.find( task->name() );
+	if ( result != __warm_start.end() && std::isfinite( result->second ) && result->second > 0. ) {
+	    const double customers = task->multiplicity();
+	    const double throughput = result->second;
+	    thinking = std::min( 1.0, throughput * task->think_time() / customers );
+	}
+	dynamic_cast<Reference_Task *>(task)->set_thinking( thinking );
+    }
+    __warm_start.clear();		/* Later solutions of LQX or SPEX start cold. */
+}
+
+
+/*
+ * With pragma sequential, run the model in short batches of the
+ * initial block period, recording the throughput of every entry for
+ * each one.  Once MSER-5 finds the end of the transient for all of the
+ * entries, find the smallest number of batches per block, doubling
+ * each time, for which the lag 1 autocorrelation of the block
+ * throughputs is small.  Every process waits for the slowest one and
+ * uses the largest block.  Statistics restart at the end of the pilot.
+ */
+
+bool
+Model::pilot()
+{
+    const double period = _parameters._block_period;
+    std::vector<const Entry *> entries;
+    for ( std::set<Task *>::const_iterator task = Task::__tasks.begin(); task != Task::__tasks.end(); ++task ) {
+	if ( (*task)->type() == Task::Type::OPEN_ARRIVAL_SOURCE || (*task)->is_async_inf_server() ) continue;		/* Skip. */
+	entries.insert( entries.end(), (*task)->entries().begin(), (*task)->entries().end() );
+    }
+
+    std::vector<std::vector<double>> throughput( entries.size() );
+    std::vector<long> last( entries.size(), 0 );
+    size_t batches = 1;
+    bool steady = false;
+    unsigned int n = 0;
+    reset_stats();
+    for ( n = 1; n <= MAX_PILOT_BATCHES && Processor::now() + period <= _parameters._run_time; ++n ) {
+	sleep( period );
+	if ( deferred_exception ) return true;
+	for ( size_t i = 0; i < entries.size(); ++i ) {
+	    const long count = entries[i]->r_cycle.count();
+	    throughput[i].push_back( static_cast<double>(count - last[i]) );
+	    last[i] = count;
+	}
+	if ( n < MIN_PILOT_BATCHES || n % MSER_BATCH != 0 ) continue;
+
+	size_t transient = 0;
+	for ( std::vector<std::vector<double>>::const_iterator x = throughput.begin(); x != throughput.end(); ++x ) {
+	    transient = std::max( transient, mser5( *x, MSER_BATCH ) );
+	}
+	if ( transient == n ) continue;
+
+	for ( batches = 1; (n - transient) / batches >= MIN_BATCHES; batches *= 2 ) {
+	    if ( std::all_of( throughput.begin(), throughput.end(), [=]( const std::vector<double>& x ){ return autocorrelation( x, transient, batches ) <= MAX_AUTOCORRELATION; } ) ) break;
+	}
+	if ( (n - transient) / batches >= MIN_BATCHES ) {
+	    steady = true;
+	    break;
+	}
+    }
+    if ( !steady ) {
+	batches = std::max( (n - 1) / MIN_BATCHES, 1U );
+    }
+
+    /* Agree with the other processes, then restart the statistics. */
+
+    std::vector<double> values = { Processor::now(), batches * period, steady ? 0. : 1. };
+    if ( _replicas != nullptr ) {
+	if ( !_replicas->maximum( values ) ) return false;
+    } else if ( Replicas::worker() > 0 ) {
+	if ( !Replicas::propose( values ) ) return false;
+    }
+    if ( values[0] > Processor::now() ) {
+	sleep( values[0] - Processor::now() );
+    }
+    _parameters._initial_delay = values[0];
+    _parameters._block_period = values[1];
+    _parameters._max_blocks = static_cast<unsigned long>(std::min( static_cast<double>(simulation_parameters::MAX_SEQUENTIAL_BLOCKS), std::floor( (_parameters._run_time - values[0]) / values[1] ) ));
+    if ( values[2] > 0. && Replicas::worker() == 0 ) {
+	LQIO::runtime_error( ADV_NO_STEADY_STATE, values[0], values[1] );
+    }
+    if ( verbose_flag ) {
+	(void) fprintf( stderr, " [%G,%G]", values[0], values[1] );
+    }
+    reset_stats();
+    return true;
+}
+
+
 /*
  * Check waiting time statistics to see if we meet termination
  * precision.  Normalize confidence and convert to percentage.
@@ -709,6 +1078,59 @@ Model::rms_confidence()
     return n > 0 ? sqrt( sum_sqr / n ) : 0.0;
 }
 
+/*
+ * With pragma sequential, the largest half width of the confidence
+ * interval of the mean of the service time and the throughput of any
+ * entry, as a percentage of the mean.
+ */
+
+double
+Model::max_confidence()
+{
+    const double t = Result::conf95( number_blocks ) * 100.0 / std::sqrt( static_cast<double>(number_blocks) );
+    double confidence = 0.0;
+
+    for ( std::set<Task *>::const_iterator task = Task::__tasks.begin(); task != Task::__tasks.end(); ++task ) {
+	if ( (*task)->type() == Task::Type::OPEN_ARRIVAL_SOURCE || (*task)->is_async_inf_server() ) continue;		/* Skip. */
+
+	for ( std::vector<Entry *>::const_iterator entry = (*task)->entries().begin(); entry != (*task)->entries().end(); ++entry ) {
+	    const Result& r_cycle = (*entry)->r_cycle;
+	    if ( r_cycle.mean() > 0. ) {
+		confidence = std::max( confidence, std::sqrt( r_cycle.variance() ) * t / r_cycle.mean() );
+	    }
+	    if ( r_cycle.mean_count() > 0. ) {
+		confidence = std::max( confidence, std::sqrt( r_cycle.variance_count() ) * t / r_cycle.mean_count() );
+	    }
+	}
+    }
+    return confidence;
+}
+
+
+/*
+ * Save the totals of every process after blocks blocks.  The parent
+ * has the totals of the workers after Replicas::merge().  A failure
+ * is reported but the simulation goes on.
+ */
+
+void
+Model::save_checkpoint( unsigned long blocks )
+{
+    std::vector<double> own;
+    std::vector<const std::vector<double> *> totals;
+    if ( _replicas != nullptr ) {
+	for ( unsigned int i = 0; i < _replicas->size(); ++i ) {
+	    totals.push_back( &_replicas->totals( i ) );
+	}
+    } else {
+	Replicas::pack( own );
+	totals.push_back( &own );
+    }
+    if ( !_checkpoint->save( blocks, { _parameters._initial_delay, _parameters._block_period, _parameters._max_blocks }, totals ) ) {
+	std::cerr << LQIO::io_vars.lq_toolname << ": cannot write checkpoint " << _checkpoint->file_name().string() << ": " << strerror( errno ) << std::endl;
+    }
+}
+
 double
 Model::normalized_conf95( const Result& stat )
 {
@@ -739,6 +1161,23 @@ Model::print_intermediate()
 }
 
 
+/*
+ * Each solution of an LQX or SPEX program writes its own binary
+ * trace, named with the suffix of its output file, so that the next
+ * solution does not overwrite it.
+ */
+
+std::filesystem::path
+Model::binary_trace_file_name() const
+{
+    std::filesystem::path file_name( binary_trace_file );
+    if ( _document->getResultInvocationNumber() > 0 ) {
+	file_name.replace_filename( file_name.stem().string() + SolverInterface::Solve::customSuffix + file_name.extension().string() );
+    }
+    return file_name;
+}
+
+
 /*
  * Human format statistics.
  */
@@ -780,6 +1219,36 @@ Model::print( std::ostream& output ) const
 }
 
 
+#if HAVE_PARASOL
+/*
+ * Parasol kernel counters (--verbose, --profile).  The time for each
+ * event type includes the task code that the event resumes, so it is
+ * only collected with --profile.
+ */
+
+void
+Model::print_profile( FILE * output )
+{
+    (void) fprintf( output, "%-16s %12s", "Event", "Count" );
+    if ( profile_flag ) (void) fprintf( output, " %12s %12s", "Seconds", "us/event" );
+    (void) fputc( '\n', output );
+    for ( long type = 0; type < PS_EVENT_TYPES; ++type ) {
+	const long count = ps_profile.events[type];
+	if ( count == 0 ) continue;
+	(void) fprintf( output, "%-16s %12ld", ps_event_name( type ), count );
+	if ( profile_flag ) (void) fprintf( output, " %12.3f %12.3f", ps_profile.handler_time[type], ps_profile.handler_time[type] * 1.0e6 / count );
+	(void) fputc( '\n', output );
+    }
+    (void) fprintf( output, "%-16s %12ld", "calendar", ps_profile.next_events );
+    if ( profile_flag && ps_profile.next_events > 0 ) (void) fprintf( output, " %12.3f %12.3f", ps_profile.calendar_time, ps_profile.calendar_time * 1.0e6 / ps_profile.next_events );
+    (void) fputc( '\n', output );
+    (void) fprintf( output, "context switches: %ld, find_host: %ld, find_priority: %ld.\n", ps_profile.ctxsw, ps_profile.find_host, ps_profile.find_priority );
+    (void) fprintf( output, "port sends: %ld, mean queue length: %g, longest queue: %ld.\n", ps_profile.sends,
+		    ps_profile.sends > 0 ? ps_profile.queued / ps_profile.sends : 0., ps_profile.max_queued );
+}
+#endif
+
+
 /*
  * Go through data structures and insert results into the DOM
  */
@@ -821,6 +1290,19 @@ void Model::simulation_parameters::set( const std::map<std::string,std::string>&
 	__model->_document->addPragma(LQIO::DOM::Pragma::_seed_value_,value.str());	/* set value in DOM */
 
     }
+    if ( Pragma::__pragmas->sequential() ) {
+	/* The block period is the pilot batch; Model::pilot() sets the rest. */
+	if ( !set( _precision, pragmas, LQIO::DOM::Pragma::_precision_ ) ) {
+	    _precision = 1.0;
+	}
+	_initial_delay = 0;
+	_block_period = minimum_cycle_time > 0 ? minimum_cycle_time * INITIAL_LOOPS : DEFAULT_TIME / INITIAL_LOOPS;
+	_max_blocks = MAX_SEQUENTIAL_BLOCKS;
+	if ( !set( _run_time, pragmas, LQIO::DOM::Pragma::_run_time_ ) ) {
+	    _run_time = std::numeric_limits<double>::max() / 4;		/* Until the precision is met.	*/
+	}
+	return;
+    }
     unsigned long initial_loops = 0;
     if ( set( _precision, pragmas, LQIO::DOM::Pragma::_precision_ ) ) {
 	/* if initial loops NOT set and run-time set then -A, otherwise -C */
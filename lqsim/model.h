@@ -20,10 +20,6 @@
 #include <lqio/dom_document.h>
 #include <lqio/common_io.h>
 #include "result.h"
-#if !HAVE_PARASOL
-#include <thread>
-#include <chrono>
-#endif
 
 extern matherr_type matherr_disposition;    	/* What to do on math fault     */
 
@@ -39,6 +35,8 @@ extern bool print_lqx;
 extern "C" void ps_genesis(void *);
 #endif
 
+class Checkpoint;
+class Replicas;
 class Task;
 
 class Model {
@@ -70,6 +68,7 @@ public:
     private:
 	static const unsigned long MAX_BLOCKS	    = 30;
 	static const unsigned long INITIAL_LOOPS    = 100;
+	static const unsigned long MAX_SEQUENTIAL_BLOCKS = 1000;
 
 	unsigned long _seed;
 	double _run_time;
@@ -95,6 +94,7 @@ public:
     virtual ~Model();
     
     static int solve( solve_using, const std::filesystem::path&, LQIO::DOM::Document::InputFormat, const std::filesystem::path&, LQIO::DOM::Document::OutputFormat, const LQIO::DOM::Pragma& );
+    static bool load_warm_start( const std::filesystem::path& );
 
     bool operator!() const { return _document == nullptr; }
 
@@ -115,6 +115,10 @@ private:
     static void extend();	/* convert entry think times	*/
 #endif
 
+
+    void warm_start() const;
+    bool pilot();
+    void save_checkpoint( unsigned long blocks );
     void reset_stats();
     void accumulate_data();
     void insertDOMResults();
@@ -122,17 +126,22 @@ private:
     const std::filesystem::path& getOutputFileName() const { return (!_output_file_name.empty() && _output_file_name != "-") ? _output_file_name : _input_file_name; }
     
     void print_intermediate();
+    std::filesystem::path binary_trace_file_name() const;
     std::ostream& print( std::ostream& output ) const;
+#if HAVE_PARASOL
+    static void print_profile( FILE * );
+#endif
     
     bool run();
 
     static double rms_confidence();
+    static double max_confidence();
     static double normalized_conf95( const Result& stat );
 
 #if HAVE_PARASOL
     static inline void sleep( double time ) { ps_sleep( time ); }
 #else
-    static inline void sleep( double time ) { std::this_thread::sleep_for( std::chrono::milliseconds(static_cast<long>(time*1000)) ); }
+    static inline void sleep( double time ) { EventHandler::advance( time ); }
 #endif
     
 private:
@@ -143,16 +152,26 @@ private:
     LQIO::DOM::CPUTime _start_time;
     simulation_parameters _parameters;
     double _confidence;
+    Replicas * _replicas;		/* Independent replications	*/
+    Checkpoint * _checkpoint;		/* For --checkpoint/--resume	*/
 #if HAVE_PARASOL
     static int __genesis_task_id;
 #endif
     static Model * __model;
+    static const unsigned int MSER_BATCH = 5;		/* Pilot batches per MSER-5 group.	*/
+    static const unsigned int MIN_PILOT_BATCHES = 50;
+    static const unsigned int MAX_PILOT_BATCHES = 5000;
+    static const unsigned int MIN_BATCHES = 20;		/* For autocorrelation and stopping.	*/
+    static constexpr double MAX_AUTOCORRELATION = 0.1;
     static const std::map<const LQIO::DOM::Document::OutputFormat,const std::string> __parseable_output;
 
 public:
     static double max_service;			/* Max service time found.	*/
     static bool __enable_print_interval;
     static unsigned int __print_interval;	/* Value set by input file.	*/
+    static double __checkpoint_interval;	/* Seconds, 0 for none.		*/
+    static bool __resume;			/* Continue from the checkpoint	*/
+    static std::map<std::string,double> __warm_start;	/* Task throughputs (--warm-start).	*/
 };
 
 double square( const double arg );
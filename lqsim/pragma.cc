@@ -12,6 +12,7 @@
 #include <cstring>
 #include <ctype.h>
 #include <algorithm>
+#include <thread>
 #if !HAVE_GETSUBOPT
 #include <lqio/getsbopt.h>
 #endif
@@ -20,7 +21,10 @@
 
 Pragma * Pragma::__pragmas = nullptr;
 const std::map<const std::string,Pragma::fptr> Pragma::__set_pragma = {
+    { LQIO::DOM::Pragma::_antithetic_,			&Pragma::set_antithetic },
     { LQIO::DOM::Pragma::_block_period_, 	        &Pragma::set_block_period },
+    { LQIO::DOM::Pragma::_calendar_,			&Pragma::set_calendar },
+    { LQIO::DOM::Pragma::_common_random_numbers_,	&Pragma::set_common_random_numbers },
     { LQIO::DOM::Pragma::_convergence_value_,		&Pragma::set_convergence_value },
     { LQIO::DOM::Pragma::_initial_delay_, 	        &Pragma::set_initial_delay },
     { LQIO::DOM::Pragma::_initial_loops_, 	        &Pragma::set_initial_loops },
@@ -29,22 +33,28 @@ const std::map<const std::string,Pragma::fptr> Pragma::__set_pragma = {
     { LQIO::DOM::Pragma::_precision_, 	        	&Pragma::set_precision },
     { LQIO::DOM::Pragma::_queue_size_,			&Pragma::set_queue_size },
     { LQIO::DOM::Pragma::_quorum_reply_,		&Pragma::set_quorum_delayed_calls },
+    { LQIO::DOM::Pragma::_replicas_,			&Pragma::set_replicas },
     { LQIO::DOM::Pragma::_reschedule_on_async_send_,	&Pragma::set_reschedule_on_async_send },
     { LQIO::DOM::Pragma::_run_time_, 			&Pragma::set_run_time },
     { LQIO::DOM::Pragma::_scheduling_model_,		&Pragma::set_scheduling_model },
     { LQIO::DOM::Pragma::_seed_value_, 			&Pragma::set_seed_value },
+    { LQIO::DOM::Pragma::_sequential_,			&Pragma::set_sequential },
     { LQIO::DOM::Pragma::_severity_level_,		&Pragma::set_severity_level },
     { LQIO::DOM::Pragma::_spex_comment_, 		&Pragma::set_spex_comment },
     { LQIO::DOM::Pragma::_spex_convergence_, 		&Pragma::set_spex_convergence },
     { LQIO::DOM::Pragma::_spex_header_, 		&Pragma::set_spex_header },
     { LQIO::DOM::Pragma::_spex_iteration_limit_,	&Pragma::set_spex_iteration_limit },
     { LQIO::DOM::Pragma::_spex_underrelaxation_,	&Pragma::set_spex_underrelaxation },
+    { LQIO::DOM::Pragma::_spex_workers_,		&Pragma::set_spex_workers },
     { LQIO::DOM::Pragma::_stop_on_message_loss_,	&Pragma::set_abort_on_dropped_message }
 };
 
 Pragma::Pragma() :
     _abort_on_dropped_message(true),  	/* halt on dropped msgs.	*/
+    _antithetic(false),
     _block_period(0.0),
+    _calendar_list(false),
+    _common_random_numbers(false),
     _force_infinite(ForceInfinite::NONE),
     _initial_delay(0),
     _initial_loops(0),
@@ -54,16 +64,19 @@ Pragma::Pragma() :
     _precision(0.0),
     _queue_size(0),
     _quorum_delayed_calls(false),	/* Quorum reply (BUG_311)	*/
+    _replicas(1),
     _reschedule_on_async_send(false),	/* force schedule after snr.	*/
     _run_time(0.0),
     _scheduling_model(SCHEDULE_SLICE),
     _seed_value(0.0),
+    _sequential(false),
     _severity_level(LQIO::error_severity::ALL),
     _spex_comment(false),
     _spex_convergence(0.0),
     _spex_header(true),
     _spex_iteration_limit(0),
-    _spex_underrelaxation(1.0)
+    _spex_underrelaxation(1.0),
+    _spex_workers(1)
 {
 }
 
@@ -94,6 +107,17 @@ Pragma::set_abort_on_dropped_message( const std::string& value )
     _abort_on_dropped_message = LQIO::DOM::Pragma::isTrue( value );
 }
 
+/*
+ * Run the replicas in pairs, the second of each pair using 1-u for
+ * every u of the first.  See Replicas.
+ */
+
+void
+Pragma::set_antithetic( const std::string& value )
+{
+    _antithetic = LQIO::DOM::Pragma::isTrue( value );
+}
+
 void Pragma::set_block_period( const std::string& value )
 {
     char * endptr = nullptr;
@@ -103,6 +127,30 @@ void Pragma::set_block_period( const std::string& value )
     }
 }
 
+void
+Pragma::set_calendar( const std::string& value )
+{
+    if ( value == LQIO::DOM::Pragma::_list_ ) {
+	_calendar_list = true;
+    } else if ( value == LQIO::DOM::Pragma::_heap_ ) {
+	_calendar_list = false;
+    } else {
+	throw std::domain_error( value );
+    }
+}
+
+/*
+ * Give each distribution a stream named after what it is for, rather
+ * than numbered by construction order, so that variants of a model
+ * run with the same seed draw the same numbers (see Random::name()).
+ */
+
+void
+Pragma::set_common_random_numbers( const std::string& value )
+{
+    _common_random_numbers = LQIO::DOM::Pragma::isTrue( value );
+}
+
 void Pragma::set_convergence_value(const std::string& value )
 {
     char * endptr = nullptr;
@@ -178,6 +226,20 @@ Pragma::set_quorum_delayed_calls( const std::string& value )
     _quorum_delayed_calls = LQIO::DOM::Pragma::isTrue( value );
 }
 
+/*
+ * Number of independent replications, each run by its own process.
+ * Zero means one per hardware thread.
+ */
+
+void
+Pragma::set_replicas( const std::string& value )
+{
+    char * endptr = nullptr;
+    const long replicas = std::strtol( value.c_str(), &endptr, 10 );
+    if ( replicas < 0 || *endptr != '\0' ) throw std::domain_error( value );
+    _replicas = replicas > 0 ? replicas : std::max( std::thread::hardware_concurrency(), 1U );
+}
+
 void
 Pragma::set_reschedule_on_async_send( const std::string& value )
 {
@@ -194,6 +256,17 @@ void Pragma::set_seed_value( const std::string& value )
     }
 }
 
+/*
+ * Find the warm-up period and the block size from a pilot run, then
+ * stop when every entry meets the precision (see Model::run()).
+ */
+
+void
+Pragma::set_sequential( const std::string& value )
+{
+    _sequential = LQIO::DOM::Pragma::isTrue( value );
+}
+
 void Pragma::set_run_time( const std::string& value )
 {
     char * endptr = nullptr;
@@ -265,6 +338,21 @@ Pragma::set_spex_underrelaxation(const std::string& value)
     if ( (_spex_underrelaxation <= 0 || 1 < _spex_underrelaxation ) || *endptr != '\0' ) throw std::domain_error( value );
 }
 
+
+/*
+ * Number of processes for the points of a SPEX sweep.  Zero means one
+ * per hardware thread.
+ */
+
+void
+Pragma::set_spex_workers(const std::string& value)
+{
+    char * endptr = nullptr;
+    const long workers = std::strtol( value.c_str(), &endptr, 10 );
+    if ( workers < 0 || *endptr != '\0' ) throw std::domain_error( value );
+    _spex_workers = workers > 0 ? workers : std::max( std::thread::hardware_concurrency(), 1U );
+}
+
 
 /*
  * Print out available pragmas.
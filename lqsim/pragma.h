@@ -29,7 +29,10 @@ public:
     static void set( const std::map<std::string,std::string>& list );
 
     bool abort_on_dropped_message() const { return _abort_on_dropped_message; }
+    bool antithetic() const { return _antithetic; }
     double block_period() const { return _block_period; }
+    bool calendar_list() const { return _calendar_list; }
+    bool common_random_numbers() const { return _common_random_numbers; }
     double convergence_value() const { return _convergence_value; }
     ForceInfinite force_infinite() const { return _force_infinite; }
     double initial_delay() const { return _initial_delay; }
@@ -38,22 +41,28 @@ public:
     unsigned int number_of_blocks() const { return _number_of_blocks; }
     double precision() const { return _precision; }
     unsigned long queue_size() const { return _queue_size; }
+    unsigned int replicas() const { return _replicas; }
     int quorum_delayed_calls() const { return _quorum_delayed_calls; }
     bool reschedule_on_async_send() const { return _reschedule_on_async_send; }
     int scheduling_model() const { return _scheduling_model; }
     double seed_value() const { return _seed_value; }
+    bool sequential() const { return _sequential; }
     LQIO::error_severity severity_level() { return _severity_level; }
     bool spex_comment() const { return _spex_comment; }
     double spex_convergence() const { return _spex_convergence; }
     bool spex_header() const { return _spex_header; }
     unsigned int spex_iteration_limit() const { return _spex_iteration_limit; }
     double spex_underrelaxation() const { return _spex_underrelaxation; }
+    unsigned int spex_workers() const { return _spex_workers; }
 
     static void usage( std::ostream& output );
 
 private:
     void set_abort_on_dropped_message( const std::string& );
+    void set_antithetic( const std::string& );
     void set_block_period( const std::string& );
+    void set_calendar( const std::string& );
+    void set_common_random_numbers( const std::string& );
     void set_convergence_value( const std::string& );
     void set_force_infinite( const std::string& );
     void set_initial_delay( const std::string& );
@@ -63,20 +72,26 @@ private:
     void set_precision( const std::string& );
     void set_queue_size( const std::string& );
     void set_quorum_delayed_calls( const std::string& );
+    void set_replicas( const std::string& );
     void set_reschedule_on_async_send( const std::string& );
     void set_run_time( const std::string& );
     void set_scheduling_model( const std::string& );
     void set_seed_value( const std::string& );
+    void set_sequential( const std::string& );
     void set_severity_level(const std::string& );
     void set_spex_comment( const std::string& );
     void set_spex_convergence( const std::string& );
     void set_spex_header( const std::string& );
     void set_spex_iteration_limit(  const std::string& );
     void set_spex_underrelaxation( const std::string& );
+    void set_spex_workers( const std::string& );
 
 private:
     bool _abort_on_dropped_message;
+    bool _antithetic;			/* Antithetic pairs of replicas	*/
     double _block_period;
+    bool _calendar_list;		/* PARASOL linked list calendar	*/
+    bool _common_random_numbers;	/* Streams named, not numbered	*/
     double _convergence_value;		/* SPEX */
     ForceInfinite _force_infinite;
     double _initial_delay;
@@ -87,16 +102,19 @@ private:
     double _precision;
     unsigned long _queue_size;
     int _quorum_delayed_calls;
+    unsigned int _replicas;		/* Independent replications	*/
     bool _reschedule_on_async_send;
     double _run_time;
     int _scheduling_model;
     double _seed_value;
+    bool _sequential;			/* Automatic warm-up and blocks	*/
     LQIO::error_severity _severity_level;
     bool _spex_comment;
     double _spex_convergence;
     bool _spex_header;
     unsigned int _spex_iteration_limit;
     double _spex_underrelaxation;
+    unsigned int _spex_workers;
 
 public:
     static Pragma * __pragmas;
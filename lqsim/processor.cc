@@ -20,10 +20,6 @@
 #include <cstdlib>
 #include <iomanip>
 #include <regex>
-#if !HAVE_PARASOL
-#include <thread>
-#include <chrono>
-#endif
 #include <lqio/input.h>
 #include <lqio/error.h>
 #include <lqio/labels.h>
@@ -41,8 +37,6 @@
 std::set<Processor *, Processor::ltProcessor> Processor::__processors;	/* Processor table.		*/
 #if HAVE_PARASOL
 Processor *Processor::processor_table[MAX_NODES+1];			/* NodeId to processor		*/
-#else
-static const auto start_time =  std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now());
 #endif
 
 #if HAVE_PARASOL
@@ -90,14 +84,15 @@ Processor::Processor( LQIO::DOM::Processor* dom )
 }
 
 
-#if HAVE_PARASOL
 /*
- * Create a processor
+ * Create a processor.  Without PARASOL, start with all of its
+ * processors free.
  */
 
 Processor&
 Processor::create()
 {
+#if HAVE_PARASOL
     _node_id = ps_build_node( name().c_str(), multiplicity(), cpu_rate(), quantum(),
 			      scheduling_types.at(discipline()),
 			      SF_PER_NODE|SF_PER_HOST );
@@ -108,9 +103,12 @@ Processor::create()
 	r_util.init( ps_get_node_stat_index( _node_id ) );	// defined by Parasol
 	processor_table[_node_id] = this;
     }
+#else
+    _active = 0;
+    _waiting.clear();
+#endif
     return *this;
 }
-#endif
 
 
 
@@ -200,40 +198,56 @@ Processor::get_compute_func() const
 }
 
 
-#if !HAVE_PARASOL
-/* static */ double
-Processor::now()
-{
-    const auto stop_time = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now());
-    const std::chrono::duration<double> diff = stop_time - start_time;
-    return diff.count();
-}
-#endif
-
-
+/*
+ * Without PARASOL, the caller holds the processor (see acquire()).
+ */
 
-void
+process_t
 Processor::compute( double time )
 {
 #if HAVE_PARASOL
     ps_compute( time );
 #else
-    std::unique_lock<std::mutex> lock(_mutex);
-    _active += 1;
-    // if _active > copies wait
-    // wait_for( time... ).
-    std::this_thread::sleep_for( std::chrono::milliseconds(static_cast<long>(time*1000)) );
-    // notify
-    _active -= 1;
+    co_await EventHandler::delay( time / cpu_rate() );
 #endif
 }
 
 
 #if !HAVE_PARASOL
-void
+Process
 Processor::sleep( double time )
 {
-    std::this_thread::sleep_for( std::chrono::milliseconds(static_cast<long>(time*1000)) );
+    co_await EventHandler::delay( time );
+}
+
+
+/*
+ * Wait for a free processor.  Tasks get the processor in the order in
+ * which they ask for it, so all processors are first-come,
+ * first-served.  Infinite processors never make a task wait.
+ */
+
+Process
+Processor::acquire()
+{
+    if ( !is_infinite() && _active >= static_cast<int>(multiplicity()) ) {
+	co_await _waiting.wait();		/* release() hands its processor over. */
+    } else {
+	_active += 1;
+	r_util.record( _active );
+    }
+}
+
+
+void
+Processor::release()
+{
+    if ( _waiting.empty() ) {
+	_active -= 1;
+	r_util.record( _active );
+    } else {
+	_waiting.notify_one();
+    }
 }
 #endif
 
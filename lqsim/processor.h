@@ -21,8 +21,6 @@
 #include <string>
 #if HAVE_PARASOL
 #include <parasol/para_internals.h>
-#else
-#include <mutex>
 #endif
 #include <lqio/dom_processor.h>
 #include "lqsim.h"
@@ -36,14 +34,14 @@ namespace Instance {
 
 class Processor {
 public:
-    typedef void (Processor::*compute_fptr)( double );
+    typedef process_t (Processor::*compute_fptr)( double );
 
 #if HAVE_PARASOL
     static inline double now() { return ps_now; }
     inline void sleep( double time ) { ps_sleep( time ); }
 #else
-    static double now();
-    void sleep( double time );
+    static inline double now() { return EventHandler::now(); }
+    Process sleep( double time );
 #endif
 
     /*
@@ -99,13 +97,12 @@ public:
     unsigned multiplicity() const;								/* Special access!		*/
     void add_task( Task * );
 
-#if HAVE_PARASOL
     Processor& create();
+#if HAVE_PARASOL
     long node_id() const { return _node_id; }
 #else
-//   compute will add event (END) with time + delta
-//    void acquire();	// get processor lock, insert onto event list for start  increment global bust count.
-//    void release();	// release processor lock, decrement global busy count.
+    Process acquire();
+    void release();
 #endif
 
     bool is_infinite() const;
@@ -121,7 +118,7 @@ public:
     std::ostream& print( std::ostream& ) const;
 
 private:
-    void compute( double time );
+    process_t compute( double time );
 
 public:
     bool trace_flag;			/* For tracing.			*/
@@ -142,7 +139,7 @@ private:
     LQIO::DOM::Processor * _dom;
     std::vector<Task *> _tasks;
 #if !HAVE_PARASOL
-    std::mutex _mutex;
+    Signal _waiting;			/* Tasks waiting for a processor.*/
 #endif
 };
 
@@ -12,30 +12,223 @@
 
 
 #include "random.h"
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 
-std::random_device Random::__random_device;
-std::mt19937 Random::__generator(Random::__random_device());
-std::uniform_real_distribution<double> Random::__f(0.,1.);
+unsigned long Random::__seed = 0;
+unsigned int Random::__replica = 0;
+unsigned int Random::__epoch = 0;
+unsigned int Random::__streams = 0;
+bool Random::__common = false;
+bool Random::__pairs = false;
+bool Random::__antithetic = false;
 
-double HyperExponential::operator()()
+/* Stream 0, for number() */
+
+static Uniform __uniform( 0., 1. );
+
+double
+Random::number()
+{
+    return __uniform();
+}
+
+
+/*
+ * Restart every stream.  The stream numbers are kept, so the
+ * distributions constructed before and after the seed do not share a
+ * stream.  Replicas 2k and 2k+1 of antithetic pairs use the same
+ * numbers, the second as 1-u.
+ */
+
+void
+Random::seed( unsigned long value, unsigned int replica )
+{
+    __seed = value;
+    __replica = __pairs ? replica / 2 : replica;
+    __antithetic = __pairs && replica % 2 == 1;
+    __epoch += 1;
+}
+
+
+/*
+ * Use the stream named by key (FNV-1a) for common random numbers.
+ * The top bit keeps named streams apart from numbered ones.
+ */
+
+void
+Random::name( const std::string& key )
+{
+    if ( !__common ) return;
+    uint32_t hash = 0x811c9dc5;
+    for ( std::string::const_iterator c = key.begin(); c != key.end(); ++c ) {
+	hash = (hash ^ static_cast<unsigned char>(*c)) * 0x01000193;
+    }
+    _stream = hash | 0x80000000;
+    _counter = 0;
+    _next = BATCH;
+}
+
+
+/*
+ * Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3", SC'11).  The key is the low half of the seed and the
+ * stream, the counter is the block number, the replication and the
+ * high half of the seed.  The blocks of a batch are independent, so
+ * the rounds are done on all of them at once, which the compiler can
+ * vectorize.
+ */
+
+void
+Random::refill()
 {
-#if 0
-    if ( drand48() <= 0.5 / (_cv_sqr - 0.5) ) {
-	return _f(_generator())( _mean * _cv_sqr );
-    } else {
-	return _f(_generator())( _mean / 2.0 );
+    static constexpr unsigned int N = BATCH / 2;
+    static constexpr uint32_t M0 = 0xD2511F53;
+    static constexpr uint32_t M1 = 0xCD9E8D57;
+    static constexpr uint32_t W0 = 0x9E3779B9;
+    static constexpr uint32_t W1 = 0xBB67AE85;
+
+    if ( _epoch != __epoch ) {
+	_epoch = __epoch;
+	_counter = 0;
+    }
+
+    uint32_t c0[N], c1[N], c2[N], c3[N];
+    for ( unsigned int i = 0; i < N; ++i ) {
+	const uint64_t counter = _counter + i;
+	c0[i] = static_cast<uint32_t>(counter);
+	c1[i] = static_cast<uint32_t>(counter >> 32);
+	c2[i] = __replica;
+	c3[i] = static_cast<uint32_t>(static_cast<uint64_t>(__seed) >> 32);
+    }
+    _counter += N;
+
+    uint32_t k0 = static_cast<uint32_t>(__seed);
+    uint32_t k1 = _stream;
+    for ( unsigned int round = 0; round < 10; ++round ) {
+	for ( unsigned int i = 0; i < N; ++i ) {
+	    const uint64_t p0 = static_cast<uint64_t>(M0) * c0[i];
+	    const uint64_t p1 = static_cast<uint64_t>(M1) * c2[i];
+	    const uint32_t x0 = static_cast<uint32_t>(p1 >> 32) ^ c1[i] ^ k0;
+	    const uint32_t x2 = static_cast<uint32_t>(p0 >> 32) ^ c3[i] ^ k1;
+	    c0[i] = x0;
+	    c1[i] = static_cast<uint32_t>(p1);
+	    c2[i] = x2;
+	    c3[i] = static_cast<uint32_t>(p0);
+	}
+	k0 += W0;
+	k1 += W1;
+    }
+
+    for ( unsigned int i = 0; i < N; ++i ) {
+	_x[2*i]   = ((static_cast<uint64_t>(c0[i]) << 32) | c1[i]) >> 11;
+	_x[2*i+1] = ((static_cast<uint64_t>(c2[i]) << 32) | c3[i]) >> 11;
+    }
+    if ( __antithetic ) {
+	for ( unsigned int i = 0; i < BATCH; ++i ) {
+	    _x[i] = Bits::max() - _x[i];
+	}
     }
-#else
+    _next = 0;
+}
+
+
+/*
+ * Transform a whole batch at a time.  1-u is in (0,1].
+ */
+
+double
+Exponential::operator()()
+{
+    if ( empty() ) {
+	refill();
+	for ( unsigned int i = 0; i < BATCH; ++i ) {
+	    _y[i] = -_mean * std::log( 1.0 - _x[i] * 0x1.0p-53 );
+	}
+    }
+    return _y[_next++];
+}
+
+
+double HyperExponential::operator()()
+{
     const double prob = 0.5 * (1.0 - (std::sqrt((_cv_sqr-1.0)/(_cv_sqr+1.0))));
-    const double temp = _f(__generator)>prob ? (_mean/(1.0-prob)) : (_mean/prob);
-    return -0.5 * temp * log(_f(__generator));
-#endif
+    const double temp = uniform()>prob ? (_mean/(1.0-prob)) : (_mean/prob);
+    return -0.5 * temp * log(1.0 - uniform());
 }
 
 
 
 double Pareto::operator()()
 {
-    return _scale * pow( 1.0 - _f(__generator), -1.0 / _shape );
+    return _scale * pow( 1.0 - uniform(), -1.0 / _shape );
+}
+
+
+
+/*
+ * Called when the model is configured, so the new stream is numbered
+ * like the distributions.  The key only names it for common random
+ * numbers.
+ */
+
+void
+Choice::name( const std::string& key )
+{
+    _random = std::make_shared<Uniform>( 0., 1. );
+    _random->name( key );
+}
+
+
+
+/*
+ * Scale the weights so that they average one, then pair each column
+ * that is short with one that is over.  The weights must not all be
+ * zero.
+ */
+
+void
+Alias::configure( const std::vector<double>& weights )
+{
+    const size_t n = weights.size();
+    const double total = std::accumulate( weights.begin(), weights.end(), 0.0 );
+    _prob.assign( n, 1.0 );
+    _alias.resize( n );
+    std::iota( _alias.begin(), _alias.end(), 0 );
+    if ( n == 0 || total <= 0.0 ) return;
+
+    std::vector<double> p( n );
+    std::vector<size_t> small;
+    std::vector<size_t> large;
+    for ( size_t i = 0; i < n; ++i ) {
+	p[i] = weights[i] * n / total;
+	if ( p[i] < 1.0 ) {
+	    small.push_back( i );
+	} else {
+	    large.push_back( i );
+	}
+    }
+    while ( !small.empty() && !large.empty() ) {
+	const size_t s = small.back();
+	const size_t l = large.back();
+	small.pop_back();
+	_prob[s] = p[s];
+	_alias[s] = l;
+	p[l] -= 1.0 - p[s];
+	if ( p[l] < 1.0 ) {
+	    large.pop_back();
+	    small.push_back( l );
+	}
+    }
+    /* Whatever is left over is one, give or take round off. */
+}
+
+
+size_t
+Alias::operator()() const
+{
+    const double u = _choice() * _prob.size();
+    const size_t i = std::min( static_cast<size_t>(u), _prob.size() - 1 );
+    return u - i < _prob[i] ? i : _alias[i];
 }
@@ -4,37 +4,98 @@
  * number() generates a uniformly distributed random numer between
  * [0,1).
  *
+ * Every distribution, and every Choice of a call target, OR-fork
+ * branch, loop or forward, draws from its own stream of a
+ * Philox4x32-10 counter-based generator.  Number i of a stream is a function of the
+ * seed, the stream, the replication and i only, so the numbers drawn
+ * by one task or activity do not depend on the order of events
+ * elsewhere in the model.  Streams are numbered in the order the
+ * distributions are constructed after restart_streams(), which is
+ * called at the start of every solution, so each point of an LQX or
+ * SPEX program uses the streams it would if it were solved alone.
+ * Numbers are generated BATCH at a time.
+ *
+ * With common random numbers, name() gives a stream the hash of what
+ * it is for (an activity's service time, say) instead, so two variants
+ * of a model run with the same seed use the same numbers for the same
+ * purposes even if their distributions are constructed in another
+ * order.  With antithetic pairs, the odd replica of each pair uses
+ * 1-u for every u drawn by the even one.
+ *
  * Copyright the Real-Time and Distributed Systems Group,
  * Department of Systems and Computer Engineering,
  * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
  *
  * Nov 2024.
- *     
+ *
  * $Id: task.h 17410 2024-10-31 13:54:12Z greg $
  */
 
 #ifndef	LQSIM_RANDOM_H
 #define LQSIM_RANDOM_H
 
+#include <cstdint>
+#include <memory>
 #include <random>
+#include <string>
+#include <vector>
 
 class Random
 {
+public:
+    static constexpr unsigned int BATCH = 16;	/* Numbers per refill (two per Philox block) */
+
+    /* Use a stream with the std::*_distribution classes. */
+
+    class Bits {
+    public:
+	typedef uint64_t result_type;
+	Bits( Random& random ) : _random(random) {}
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return (static_cast<result_type>(1) << 53) - 1; }
+	result_type operator()() { return _random.next(); }
+
+    private:
+	Random& _random;
+    };
+
 protected:
-    Random() {}
+    Random() : _stream(__streams++), _counter(0), _epoch(__epoch), _next(BATCH) {}
 
 public:
     virtual ~Random() {}
     virtual double operator()() = 0;
-    static double number() { return __f(__generator); }
-    static void seed( unsigned int value ) { __generator.seed( value ); }
+    static double number();
+    static void seed( unsigned long value ) { seed( value, 0 ); }
+    static void seed( unsigned long value, unsigned int replica );
+    static void restart_streams() { __streams = 1; }
+    static void set_common_random_numbers( bool common ) { __common = common; }
+    static bool common_random_numbers() { return __common; }
+    static void set_antithetic_pairs( bool pairs ) { __pairs = pairs; }
+    void name( const std::string& );
+
+protected:
+    bool empty() const { return _next == BATCH || _epoch != __epoch; }
+    void refill();
+    double uniform() { if ( empty() ) refill(); return _x[_next++] * 0x1.0p-53; }
+    uint64_t next() { if ( empty() ) refill(); return _x[_next++]; }
 
 private:
-    static std::random_device __random_device;
-    static std::uniform_real_distribution<double> __f;	/* uniform from 0 to 1 */
+    static unsigned long __seed;
+    static unsigned int __replica;
+    static unsigned int __epoch;	/* Incremented by seed() to restart all streams. */
+    static unsigned int __streams;	/* Next stream number.		*/
+    static bool __common;		/* Streams named by name().	*/
+    static bool __pairs;		/* Replicas are antithetic pairs. */
+    static bool __antithetic;		/* The odd replica of a pair.	*/
+
+    unsigned int _stream;
+    uint64_t _counter;			/* Next Philox block.		*/
+    unsigned int _epoch;
 
-public:
-    static std::mt19937 __generator;
+protected:
+    unsigned int _next;			/* Next number in _x.		*/
+    uint64_t _x[BATCH];			/* 53 bit integers.		*/
 };
 
 
@@ -53,15 +114,16 @@ private:
 
 class Exponential : public Random
 {
-    /* The std::exponential_distribution takes a rate, not a time */
+    /* Generated a batch at a time, -mean * log(1-u). */
 public:
-    Exponential( double mean ) : Random(), _f(1.0/mean) {}
+    Exponential( double mean ) : Random(), _mean(mean) {}
     virtual ~Exponential() {}
 
-    double operator()() { return _f(__generator); }
+    double operator()();
 
 private:
-    std::exponential_distribution<double> _f;
+    const double _mean;
+    double _y[BATCH];
 };
 
 
@@ -73,7 +135,7 @@ public:
     Gamma( double alpha, double beta ) : Random(), _f(alpha,beta) {}
     virtual ~Gamma() {}
 
-    double operator()() { return _f(__generator); }
+    double operator()() { Bits bits( *this ); return _f(bits); }
 
 private:
     std::gamma_distribution<double> _f;
@@ -84,7 +146,7 @@ private:
 class HyperExponential : public Random
 {
 public:
-    HyperExponential( double mean, double cv_sqr ) : Random(), _mean(mean), _cv_sqr(cv_sqr), _f(0.,1.) {}
+    HyperExponential( double mean, double cv_sqr ) : Random(), _mean(mean), _cv_sqr(cv_sqr) {}
     virtual ~HyperExponential() {}
 
     double operator()();
@@ -92,7 +154,6 @@ public:
 private:
     const double _mean;
     const double _cv_sqr;
-    std::uniform_real_distribution<double> _f;
 };
 
 
@@ -100,15 +161,14 @@ private:
 class Pareto : public Random
 {
 public:
-    Pareto( double scale, double shape ) : Random(), _scale(scale), _shape(shape), _f(0.,1.) {}
+    Pareto( double scale, double shape ) : Random(), _scale(scale), _shape(shape) {}
     virtual ~Pareto() {}
 
     double operator()();
-    
+
 private:
     const double _scale;
     const double _shape;
-    std::uniform_real_distribution<double> _f;
 };
 
 
@@ -116,12 +176,58 @@ private:
 class Uniform : public Random
 {
 public:
-    Uniform( double minimum, double maximum ) : Random(), _f(minimum,maximum) {}
+    Uniform( double minimum, double maximum ) : Random(), _minimum(minimum), _range(maximum-minimum) {}
     virtual ~Uniform() {}
 
-    double operator()() { return _f(__generator); }
+    double operator()() { return _minimum + _range * uniform(); }
+
+private:
+    const double _minimum;
+    const double _range;
+};
+
+
+
+/*
+ * A uniform number for choosing a branch, a target or whether to
+ * loop.  name() gives the choice a stream of its own, so that the
+ * routing of one task does not depend on the order of events
+ * elsewhere.  Until then, it is Random::number().
+ */
+
+class Choice
+{
+public:
+    Choice() : _random() {}
+
+    void name( const std::string& );
+    double operator()() const { return _random ? (*_random)() : Random::number(); }
+
+private:
+    std::shared_ptr<Random> _random;
+};
+
+
+
+/*
+ * Walker's alias method: choose one of n outcomes with the given
+ * weights in constant time using one uniform number.  The table is
+ * built by configure() (Vose's algorithm).
+ */
+
+class Alias
+{
+public:
+    Alias() : _prob(), _alias(), _choice() {}
+
+    void configure( const std::vector<double>& weights );
+    void name( const std::string& name ) { _choice.name( name ); }
+    size_t size() const { return _prob.size(); }
+    size_t operator()() const;
 
 private:
-    std::uniform_real_distribution<double> _f;
+    std::vector<double> _prob;		/* Probability of keeping column i. */
+    std::vector<size_t> _alias;		/* Otherwise, the outcome to use.   */
+    Choice _choice;
 };
 #endif
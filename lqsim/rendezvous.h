@@ -1,6 +1,17 @@
 /*  -*- c++ -*-
  *
- * Message passing data structure.
+ * Message passing data structure.  The client and server are
+ * processes run by the EventHandler:
+ *
+ *	client:	co_await rendezvous.send( in, &out );	// returns after the reply
+ *		rendezvous.post( in );			// no reply
+ *	server:	co_await rendezvous.receive( &in );
+ *		...
+ *		rendezvous.reply( in, out );
+ *
+ * Messages are received in the order in which they were sent.  Any
+ * number of servers can receive from the same rendezvous, and they
+ * can reply in any order.
  *
  * ------------------------------------------------------------------------
  * $Id: rendezvous.h 17495 2024-11-21 21:38:47Z greg $
@@ -10,118 +21,76 @@
 #ifndef _LQSIM_RENDEZVOUS_H
 #define _LQSIM_RENDEZVOUS_H
 
-#include <condition_variable>
+#include <algorithm>
+#include <cassert>
 #include <deque>
-#include <mutex>
-#include <utility>
-
-namespace Instance {
-    class Instance;
-}
+#include <list>
+#include "eventhandler.h"
 
 namespace Rendezvous {
     template <typename in_t, typename out_t>
     class Rendezvous {				/* send rendezvous struct		*/
-	friend class Instance::Instance;
-
     private:
+	struct Message {
+	    Message( const in_t i, out_t* o, Signal* r ) : in(i), out(o), replied(r) {}
+	    in_t in;
+	    out_t* out;
+	    Signal* replied;			/* The client waits here, or null.	*/
+	};
+
 	Rendezvous( const Rendezvous& ) = delete;
 	Rendezvous& operator=( const Rendezvous& ) = delete;
 
     public:
-	Rendezvous() : _mutex(), _send_cv(), _recv_cv() {}
+	Rendezvous() : _receive(), _sent(), _accepted() {}
 	virtual ~Rendezvous() {}
 
-	void send( const in_t in, out_t* out ) {
-	    std::unique_lock<std::mutex> lock(_mutex);
-	    /* arguments are pointers to in and out messages. */
-	    while ( is_full() ) { // (i.e. _send != nullptr),
-		_send_cv.wait(lock);
-	    }
-	    put( in, out );
-#if 0
-	    messsage.first.reply_cv.wait(lock);
-#endif
+	Process send( const in_t in, out_t* out ) {
+	    Signal replied;
+	    _sent.push_back( Message( in, out, &replied ) );
+	    _receive.notify_one();
+	    co_await replied.wait();
 	}
-    
-	void receive( in_t* in ) {
-	    std::unique_lock<std::mutex> lock(_mutex);
-	    /* return the pointer to the send buffer */
-	    while ( is_empty() ) { // (i.e. _send == nullptr ) then 
-		_recv_cv.wait();
-	    }
-	    get( in );
-	}
-    
-	void reply( const out_t out ) {
-	    pop( out );
-	    _recv_cv.notify_one();
-	}
-
-    protected:
-	/* All these methods needed to be executed INSIDE the critical section */
-	virtual bool is_empty() const = 0;
-	virtual bool is_full() const = 0;
-	virtual void put( const in_t in, out_t* out ) = 0;	/* send */
-	virtual void get( in_t* in ) = 0;			/* receive */
-	virtual void pop( const out_t out ) = 0;		/* reply */
-
-    private:
-	std::mutex _mutex;
-	std::condition_variable _send_cv;
-	std::condition_variable _recv_cv;
-    };
 
-    template <typename in_t, typename out_t>
-    class Single_Server : public Rendezvous<in_t,out_t> {
-    public:
-	Single_Server() : Rendezvous<in_t,out_t>(), _empty(true), _messages(std::pair<in_t,out_t*>()) {}
-	virtual ~Single_Server() {}
-
-    protected:
-	virtual bool is_empty() const { return _empty; }
-	virtual bool is_full() const { return !_empty; }
-	virtual void put( const in_t in, out_t* out ) {
-	    _messages.first = in;
-	    _messages.second = out;
-	    _empty = false;
-	}
-	virtual void get( in_t* in ) {
-	    *in = _messages.first;
+	void post( const in_t in ) {
+	    _sent.push_back( Message( in, nullptr, nullptr ) );
+	    _receive.notify_one();
 	}
-	virtual void pop( const out_t out ) {
-	    *_messages.second = out;
-	    _empty = true;
+
+	Process receive( in_t* in ) {
+	    while ( _sent.empty() ) {
+		co_await _receive.wait();
+	    }
+	    *in = _sent.front().in;
+	    if ( _sent.front().replied != nullptr ) {
+		_accepted.push_back( _sent.front() );
+	    }
+	    _sent.pop_front();
 	}
 
-    private:
-	bool _empty;
-	std::pair<in_t,out_t*> _messages;
-    };
+	void reply( const in_t in, const out_t out ) {
+	    typename std::list<Message>::iterator message = std::find_if( _accepted.begin(), _accepted.end(), [=]( const Message& m ){ return m.in == in; } );
+	    assert( message != _accepted.end() );
+	    *message->out = out;
+	    message->replied->notify_one();
+	    _accepted.erase( message );
+	}
 
-    template <typename in_t, typename out_t>
-    class Multi_Server : public Rendezvous<in_t,out_t> {
-    public:
-	Multi_Server( size_t capacity ) : Rendezvous<in_t,out_t>(), _capacity(capacity), _messages() {}
-	virtual ~Multi_Server() {}
+	/* Forget the processes of the last run.  Their frames are gone. */
 
-    protected:
-	virtual bool is_empty() const { return _messages.empty(); }
-	virtual bool is_full() const { return _messages.size() == _capacity; }
-	virtual void put( const in_t in, out_t* out ) {
-	    _messages.emplace_back(std::pair<in_t,out_t*>(in,out));
-	}
-	virtual void get( in_t* in ) {
-	    *in = _messages.front().first;
-	}
-	virtual void pop( const out_t out ) {
-	    *_messages.front().second = out;
-	    _messages.pop_front();
+	void clear() {
+	    _receive.clear();
+	    _sent.clear();
+	    _accepted.clear();
 	}
 
+	bool empty() const { return _sent.empty(); }
+	bool idle() const { return !_receive.empty(); }	/* A server is waiting.	*/
+
     private:
-	const size_t _capacity;
-	std::deque<std::pair<in_t,out_t*>> _messages;
+	Signal _receive;			/* Servers waiting for a message.	*/
+	std::deque<Message> _sent;		/* Not yet received.			*/
+	std::list<Message> _accepted;		/* Received, waiting for the reply.	*/
     };
 }
 #endif
@@ -0,0 +1,354 @@
+/* -*- c++ -*-
+ * Run independent replications of a simulation on worker processes.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026.
+ */
+
+#include "lqsim.h"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <functional>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "histogram.h"
+#include "loghistogram.h"
+#include "replicas.h"
+#include "result.h"
+
+unsigned int Replicas::__worker = 0;
+int Replicas::__to_parent = -1;
+int Replicas::__from_parent = -1;
+
+
+Replicas::~Replicas()
+{
+    kill();
+}
+
+
+/*
+ * Fork the workers, with a pair of pipes to each.  In the parent,
+ * return true if all of the workers were started.  In a worker,
+ * return true with worker() set.
+ */
+
+bool
+Replicas::start()
+{
+    std::signal( SIGPIPE, SIG_IGN );	/* A worker that dies is reported by read()/write(). */
+    fflush( nullptr );			/* Otherwise the workers write out anything buffered. */
+
+    for ( unsigned int worker = 1; worker < _n; ++worker ) {
+	int down[2];
+	int up[2];
+	if ( pipe( down ) < 0 ) {
+	    kill();
+	    return false;
+	} else if ( pipe( up ) < 0 ) {
+	    close( down[0] );
+	    close( down[1] );
+	    kill();
+	    return false;
+	}
+
+	const pid_t pid = fork();
+	if ( pid == 0 ) {
+	    std::for_each( _to_worker.begin(), _to_worker.end(), &close );
+	    std::for_each( _from_worker.begin(), _from_worker.end(), &close );
+	    _pids.clear();			/* The siblings are not ours.	*/
+	    _to_worker.clear();
+	    _from_worker.clear();
+	    close( down[1] );
+	    close( up[0] );
+	    __worker = worker;
+	    __from_parent = down[0];
+	    __to_parent = up[1];
+	    return true;
+	}
+
+	close( down[0] );
+	close( up[1] );
+	if ( pid < 0 ) {
+	    close( down[1] );
+	    close( up[0] );
+	    kill();
+	    return false;
+	}
+	_pids.push_back( pid );
+	_to_worker.push_back( down[1] );
+	_from_worker.push_back( up[0] );
+    }
+    return true;
+}
+
+
+/*
+ * Read the totals from every worker and add them to the parent's, in
+ * worker order, so the pooled results do not depend on which worker
+ * is fastest.  The parent's own totals are saved for the next block.
+ */
+
+bool
+Replicas::merge()
+{
+    _totals.clear();
+    pack( _totals );
+    _worker_totals.resize( _from_worker.size() );
+
+    for ( unsigned int i = 0; i < _from_worker.size(); ++i ) {
+	std::vector<double>& totals = _worker_totals[i];
+	size_t n = 0;
+	if ( !read( _from_worker[i], &n, sizeof( n ) ) || !fits( n ) ) return false;
+	totals.resize( n );
+	if ( !read( _from_worker[i], totals.data(), n * sizeof( double ) ) ) return false;
+	if ( !unpack( totals ) ) return false;
+    }
+    if ( _paired ) {
+	pair();
+    }
+    return true;
+}
+
+
+/*
+ * The totals of processes 2k and 2k+1 went up by the results x and y
+ * of the block just run.  Add x*y to the cross products of each
+ * result, then turn the pooled totals into those of the pair means.
+ */
+
+void
+Replicas::pair()
+{
+    const size_t n = Result::__results.size();
+    _previous.resize( _n );
+    _cross.resize( 2 * n, 0. );
+    for ( unsigned int k = 0; k + 1 < _n; k += 2 ) {
+	const std::vector<double>& x = totals( k );
+	const std::vector<double>& y = totals( k + 1 );
+	std::vector<double>& x0 = _previous[k];
+	std::vector<double>& y0 = _previous[k+1];
+	x0.resize( x.size(), 0. );
+	y0.resize( y.size(), 0. );
+	for ( size_t i = 0; i < n; ++i ) {
+	    const size_t sum = i * Result::PACKED;		/* See Result::pack() */
+	    const size_t count = sum + 2;
+	    _cross[2*i]   += (x[sum] - x0[sum]) * (y[sum] - y0[sum]);
+	    _cross[2*i+1] += (x[count] - x0[count]) * (y[count] - y0[count]);
+	}
+	x0 = x;
+	y0 = y;
+    }
+    for ( size_t i = 0; i < n; ++i ) {
+	Result::__results[i]->pair( _cross[2*i], _cross[2*i+1] );
+    }
+}
+
+
+/*
+ * Tell the workers whether to run another block.  If so, the parent
+ * goes back to its own totals, otherwise the pooled totals are the
+ * results.
+ */
+
+bool
+Replicas::resume( bool stop )
+{
+    const char c = stop ? 1 : 0;
+    for ( std::vector<int>::const_iterator fd = _to_worker.begin(); fd != _to_worker.end(); ++fd ) {
+	if ( !write( *fd, &c, sizeof( c ) ) ) return false;
+    }
+    if ( !stop ) {
+	std::for_each( Result::__results.begin(), Result::__results.end(), std::mem_fn( &Result::clear_results ) );
+	std::for_each( Histogram::__histograms.begin(), Histogram::__histograms.end(), std::mem_fn( &Histogram::clear_results ) );
+	std::for_each( LogHistogram::__histograms.begin(), LogHistogram::__histograms.end(), std::mem_fn( &LogHistogram::clear_results ) );
+	unpack( _totals );
+    }
+    return true;
+}
+
+
+/*
+ * Replace each of values with the largest of that value over the
+ * parent and all of the workers, and send the result back to the
+ * workers, which call propose() with the same number of values.  Used
+ * so that every process uses the same warm-up and block period.
+ */
+
+bool
+Replicas::maximum( std::vector<double>& values )
+{
+    std::vector<double> other( values.size() );
+    for ( std::vector<int>::const_iterator fd = _from_worker.begin(); fd != _from_worker.end(); ++fd ) {
+	if ( !read( *fd, other.data(), other.size() * sizeof( double ) ) ) return false;
+	std::transform( values.begin(), values.end(), other.begin(), values.begin(), []( double a, double b ){ return std::max( a, b ); } );
+    }
+    for ( std::vector<int>::const_iterator fd = _to_worker.begin(); fd != _to_worker.end(); ++fd ) {
+	if ( !write( *fd, values.data(), values.size() * sizeof( double ) ) ) return false;
+    }
+    return true;
+}
+
+
+/*
+ * Return true if every worker exited normally.
+ */
+
+bool
+Replicas::wait()
+{
+    bool ok = true;
+    std::for_each( _to_worker.begin(), _to_worker.end(), &close );
+    std::for_each( _from_worker.begin(), _from_worker.end(), &close );
+    _to_worker.clear();
+    _from_worker.clear();
+    for ( std::vector<pid_t>::const_iterator pid = _pids.begin(); pid != _pids.end(); ++pid ) {
+	int status = 0;
+	if ( waitpid( *pid, &status, 0 ) != *pid || !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) {
+	    ok = false;
+	}
+    }
+    _pids.clear();
+    return ok;
+}
+
+
+/*
+ * Stop any workers that are still running.
+ */
+
+void
+Replicas::kill()
+{
+    std::for_each( _pids.begin(), _pids.end(), []( pid_t pid ){ ::kill( pid, SIGTERM ); } );
+    wait();
+}
+
+
+/*
+ * Called by a worker at the end of each block.  Returns true if the
+ * simulation should stop, which is also the case if the parent is
+ * gone.
+ */
+
+bool
+Replicas::block()
+{
+    std::vector<double> totals;
+    pack( totals );
+    const size_t n = totals.size();
+    char stop = 1;
+    if ( !write( __to_parent, &n, sizeof( n ) ) || !write( __to_parent, totals.data(), n * sizeof( double ) ) || !read( __from_parent, &stop, sizeof( stop ) ) ) {
+	return true;
+    }
+    return stop != 0;
+}
+
+
+bool
+Replicas::propose( std::vector<double>& values )
+{
+    return write( __to_parent, values.data(), values.size() * sizeof( double ) ) && read( __from_parent, values.data(), values.size() * sizeof( double ) );
+}
+
+
+void
+Replicas::exit( bool ok )
+{
+    close( __to_parent );
+    close( __from_parent );
+    _exit( ok ? 0 : 1 );
+}
+
+
+/*
+ * The order of the results is the order in which they were
+ * constructed, which is the same in the parent and all of the
+ * workers.  The Results and Histograms come first, with a fixed
+ * number of values each, then the LogHistograms, with only the
+ * buckets in use (so the number of values varies).  unpack() adds to
+ * the current totals.
+ */
+
+void
+Replicas::pack( std::vector<double>& totals )
+{
+    std::for_each( Result::__results.begin(), Result::__results.end(), [&]( const Result * result ){ result->pack( totals ); } );
+    std::for_each( Histogram::__histograms.begin(), Histogram::__histograms.end(), [&]( const Histogram * histogram ){ histogram->pack( totals ); } );
+    std::for_each( LogHistogram::__histograms.begin(), LogHistogram::__histograms.end(), [&]( const LogHistogram * histogram ){ histogram->pack( totals ); } );
+}
+
+
+bool
+Replicas::unpack( const std::vector<double>& totals )
+{
+    if ( !fits( totals.size() ) ) return false;
+    std::vector<double>::const_iterator value = totals.begin();
+    std::for_each( Result::__results.begin(), Result::__results.end(), [&]( Result * result ){ result->unpack( value ); } );
+    std::for_each( Histogram::__histograms.begin(), Histogram::__histograms.end(), [&]( Histogram * histogram ){ histogram->unpack( value ); } );
+    return std::all_of( LogHistogram::__histograms.begin(), LogHistogram::__histograms.end(), [&]( LogHistogram * histogram ){ return histogram->unpack( value, totals.end() ); } )
+	&& value == totals.end();
+}
+
+
+/*
+ * True if n values could have come from pack().
+ */
+
+bool
+Replicas::fits( size_t n )
+{
+    size_t least = Result::__results.size() * Result::PACKED;
+    for ( std::vector<Histogram *>::const_iterator histogram = Histogram::__histograms.begin(); histogram != Histogram::__histograms.end(); ++histogram ) {
+	least += (*histogram)->packed();
+    }
+    least += LogHistogram::__histograms.size();
+    return least <= n && n <= least + LogHistogram::__histograms.size() * 2 * LogHistogram::N_BUCKETS;
+}
+
+
+/*
+ * Add the totals that this process had saved in a checkpoint to its
+ * (empty) results.  False if the values do not match the model.
+ */
+
+bool
+Replicas::restore( const std::vector<double>& totals )
+{
+    return unpack( totals );
+}
+
+
+bool
+Replicas::read( int fd, void * buf, size_t size )
+{
+    char * p = static_cast<char *>(buf);
+    while ( size > 0 ) {
+	const ssize_t n = ::read( fd, p, size );
+	if ( n < 0 && errno == EINTR ) continue;
+	if ( n <= 0 ) return false;
+	p += n;
+	size -= n;
+    }
+    return true;
+}
+
+
+bool
+Replicas::write( int fd, const void * buf, size_t size )
+{
+    const char * p = static_cast<const char *>(buf);
+    while ( size > 0 ) {
+	const ssize_t n = ::write( fd, p, size );
+	if ( n < 0 && errno == EINTR ) continue;
+	if ( n <= 0 ) return false;
+	p += n;
+	size -= n;
+    }
+    return true;
+}
@@ -0,0 +1,81 @@
+/* -*- c++ -*-
+ * Run independent replications of a simulation on worker processes.
+ *
+ * The parent runs the first replication itself.  Every other
+ * replication runs in a worker, a copy of lqsim forked after the model
+ * is configured, which simulates the model with its own random number
+ * stream.  After each block, a worker sends the totals of all of its
+ * results to the parent and waits to be told whether to go on.  The
+ * parent adds the totals of all workers to its own, in worker order,
+ * so the blocks of every replication are pooled as if one simulation
+ * had run them all.  The parent stops the workers once the pooled
+ * confidence interval is small enough, then outputs the results as
+ * usual.
+ *
+ * Antithetic replications run in pairs, the second of each pair using
+ * 1-u for every random number u of the first.  The pooled results are
+ * then those of the pair means, whose variance is less than that of
+ * independent replications when the pair is negatively correlated.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026.
+ */
+
+#ifndef LQSIM_REPLICAS_H
+#define LQSIM_REPLICAS_H
+
+#include <vector>
+#include <sys/types.h>
+
+class Replicas {
+public:
+    Replicas( unsigned int n, bool paired=false ) : _n(n), _paired(paired), _pids(), _to_worker(), _from_worker(), _totals(), _worker_totals(), _previous(), _cross() {}
+    ~Replicas();
+
+    unsigned int size() const { return _n; }
+    bool paired() const { return _paired; }	/* Antithetic pairs.		*/
+    unsigned int samples() const { return _paired ? _n / 2 : _n; }	/* Per block.	*/
+    bool start();			/* Fork the workers; false if it failed. */
+    bool merge();			/* Pool the results of the next block.	*/
+    bool resume( bool stop );		/* Tell the workers to continue or stop. */
+    bool maximum( std::vector<double>& );	/* Agree on the largest values.	*/
+    bool wait();			/* Wait for the workers to exit.	*/
+    const std::vector<double>& totals( unsigned int i ) const { return i == 0 ? _totals : _worker_totals.at( i - 1 ); }	/* After merge() */
+
+    static unsigned int worker() { return __worker; }
+    static bool block();		/* Worker: send results; true to stop.	*/
+    static bool propose( std::vector<double>& );	/* Worker: see maximum().	*/
+    [[noreturn]] static void exit( bool ok );
+    static void pack( std::vector<double>& );
+    static bool restore( const std::vector<double>& );	/* Add totals from a checkpoint. */
+
+private:
+    Replicas( const Replicas& ) = delete;
+    Replicas& operator=( const Replicas& ) = delete;
+
+    void kill();
+    void pair();
+    static bool unpack( const std::vector<double>& );
+    static bool fits( size_t );
+    static bool read( int, void *, size_t );
+    static bool write( int, const void *, size_t );
+
+private:
+    const unsigned int _n;		/* Number of processes.			*/
+    const bool _paired;
+    std::vector<pid_t> _pids;
+    std::vector<int> _to_worker;	/* Pipes to the workers.		*/
+    std::vector<int> _from_worker;	/* Pipes from the workers.		*/
+    std::vector<double> _totals;	/* The parent's own totals.		*/
+    std::vector<std::vector<double>> _worker_totals;	/* ... and those of each worker. */
+    std::vector<std::vector<double>> _previous;	/* Totals at the last merge().	*/
+    std::vector<double> _cross;		/* Sum and count cross products.	*/
+
+    static unsigned int __worker;	/* 1..n in a worker, 0 otherwise.	*/
+    static int __to_parent;
+    static int __from_parent;
+};
+#endif
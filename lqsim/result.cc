@@ -7,6 +7,7 @@
 
 
 #include "lqsim.h"
+#include <algorithm>
 #include <cstdarg>
 #include <sstream>
 #include <iomanip>
@@ -20,6 +21,8 @@
 
 unsigned long number_blocks;
 
+std::vector<Result *> Result::__results;
+
 /*
  * Calculate the t1 and t2 values used for estimating the confidence
  * intervals.
@@ -108,6 +111,22 @@ std::ostream& Result::print( std::ostream& output ) const
 }
 
 
+Result::Result( const Result& src )
+    : _dom(src._dom), _name(src._name), _sum(src._sum), _sum_sqr(src._sum_sqr), _count(src._count), _count_sqr(src._count_sqr), _avg_count(src._avg_count), _n(src._n), _resid(src._resid)
+{
+    __results.push_back( this );
+}
+
+
+Result::~Result()
+{
+    std::vector<Result *>::iterator result = std::find( __results.begin(), __results.end(), this );
+    if ( result != __results.end() ) {
+	__results.erase( result );
+    }
+}
+
+
 /*
  * Clear result fields.
  */
@@ -125,6 +144,54 @@ Result::clear_results()
 
 
 
+/*
+ * Append the totals to values so that another process can add them to
+ * its own with unpack().
+ */
+
+void
+Result::pack( std::vector<double>& values ) const
+{
+    values.push_back( _sum );
+    values.push_back( _sum_sqr );
+    values.push_back( _count );
+    values.push_back( _count_sqr );
+    values.push_back( _avg_count );
+    values.push_back( static_cast<double>(_n) );
+}
+
+
+void
+Result::unpack( std::vector<double>::const_iterator& value )
+{
+    _sum       += *value++;
+    _sum_sqr   += *value++;
+    _count     += *value++;
+    _count_sqr += *value++;
+    _avg_count += *value++;
+    _n	       += static_cast<unsigned>(*value++);
+}
+
+
+/*
+ * The pooled totals are those of antithetic pairs of replicas, with
+ * cross_sum and cross_count the sums of x*y over the blocks x and y of
+ * each pair.  Make them the totals of the pair means, (x+y)/2, so that
+ * the confidence interval includes the covariance of the pairs.
+ */
+
+void
+Result::pair( double cross_sum, double cross_count )
+{
+    _sum       = _sum / 2.;
+    _sum_sqr   = (_sum_sqr + 2. * cross_sum) / 4.;
+    _count     = _count / 2.;
+    _count_sqr = (_count_sqr + 2. * cross_count) / 4.;
+    _avg_count = _avg_count / 2.;
+    _n	       = _n / 2;
+}
+
+
 void
 Result::reset()
 {
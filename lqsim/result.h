@@ -8,6 +8,8 @@
 #ifndef LQSIM_RESULT_H
 #define LQSIM_RESULT_H
 
+#include <vector>
+
 extern unsigned long number_blocks;	/* For block statistics. 	*/
 static inline double square( const double arg ) { return arg * arg; }
 
@@ -24,10 +26,13 @@ class Result {
     friend class Instance::Instance; 		// Old interface for processors.
 
 protected:
-    Result( const std::string& name, LQIO::DOM::DocumentObject * dom ) :  _dom(dom), _name(getName(name)), _sum(0.), _sum_sqr(0.), _count(0.), _count_sqr(0.), _avg_count(0.), _n(0), _resid(0.) {}
+    Result( const std::string& name, LQIO::DOM::DocumentObject * dom ) :  _dom(dom), _name(getName(name)), _sum(0.), _sum_sqr(0.), _count(0.), _count_sqr(0.), _avg_count(0.), _n(0), _resid(0.) { __results.push_back( this ); }
+    Result( const Result& );
 
 public:
-    virtual ~Result() {}
+    static constexpr unsigned int PACKED = 6;	/* Values per result from pack(). */
+
+    virtual ~Result();
     typedef LQIO::DOM::DocumentObject& (LQIO::DOM::DocumentObject::*set_fn)( const double );
 
     virtual void record( double ) = 0;	/* record a sample.		*/
@@ -40,6 +45,9 @@ public:
     virtual void reset();		/* Result the raw counter	*/     
     void clear_results();		/* Clear everything.		*/
     bool has_results() const { return _count > 0.; }
+    void pack( std::vector<double>& ) const;	/* For replications	*/
+    void unpack( std::vector<double>::const_iterator& );
+    void pair( double cross_sum, double cross_count );	/* Antithetic pairs */
 
     double mean() const;
     double variance() const;
@@ -60,6 +68,9 @@ protected:
 private:
     std::string getName( const std::string& ) const;
 
+public:
+    static std::vector<Result *> __results;	/* All results, in order of construction. */
+
 private:
     LQIO::DOM::DocumentObject * _dom;
     const std::string _name;
@@ -83,6 +94,7 @@ public:
     virtual void record( double );	/* record a sample.		*/
     void add( double );			/* Add preemption time		*/
     virtual void reset();
+    long count() const { return _count; }	/* Samples since reset().	*/
 
 protected:
     virtual double getMean() const { return _count > 0 ? _sum / static_cast<double>(_count) : 0.; }
@@ -7,6 +7,7 @@
 
 #include <lqio/dom_bindings.h>
 #include <lqio/dom_document.h>
+#include <lqio/sweep.h>
 #include <lqx/Program.h>
 #include <lqx/MethodTable.h>
 #include <lqx/Environment.h>
@@ -46,6 +47,11 @@ namespace SolverInterface
 	    customSuffix = ss.str();
 	}
 
+	/* Another worker may be solving this point of a sweep */
+	if ( !LQIO::Sweep::solving() ) {
+	    return LQX::Symbol::encodeBoolean(true);
+	}
+
 #if defined(DEBUG_MESSAGES)
 	env->cleanInvokeGlobalMethod("print_symbol_table", NULL);
 #endif
@@ -84,6 +90,9 @@ namespace SolverInterface
 	catch ( const std::logic_error& error ) {
 	    throw LQX::RuntimeException( error.what() );
 	}
+	if ( !ok ) {
+	    LQIO::Sweep::failed();
+	}
 	return LQX::Symbol::encodeBoolean(ok);
     }
 }
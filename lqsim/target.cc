@@ -10,6 +10,7 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <numeric>
 #include <lqio/error.h>
 #include "entry.h"
 #include "entry.h"
@@ -24,7 +25,7 @@ Call::Call( Entry * entry, LQIO::DOM::Call * dom )
     : r_delay("Wait",dom),
       r_delay_sqr("Wait sq",dom),
       r_loss_prob("Loss",dom),
-      _entry(entry), _link(-1), _tprob(0.0), _calls(0.0), _reply(false), _call(dom)
+      _entry(entry), _link(-1), _calls(0.0), _reply(false), _call(dom)
 {
     _reply = (dom->getCallType() == LQIO::DOM::Call::Type::RENDEZVOUS || dom->getCallType() == LQIO::DOM::Call::Type::FORWARD);
 }
@@ -37,7 +38,7 @@ Call::Call( Entry * entry, double calls )
     : r_delay("Wait",nullptr),
       r_delay_sqr("Wait sqr",nullptr),
       r_loss_prob("Loss",nullptr),
-      _entry(entry), _link(-1), _tprob(0.0), _calls(calls), _reply(false), _call(nullptr)
+      _entry(entry), _link(-1), _calls(calls), _reply(false), _call(nullptr)
 {
 }
 
@@ -50,19 +51,20 @@ Call::initialize()
 
 
 /*
- * Rendezvous message.  Recycle message.
+ * Rendezvous message.  Recycle message.  Without PARASOL, the reply
+ * port only marks the message as synchronous.
  */
 
-void
+process_t
 Call::send_synchronous( const Entry * src, const int priority, const long reply_port )
 {
+    Message msg( src, this );
+
+#if HAVE_PARASOL
     long j1; 			/* junk args			*/
     long acceptor_port;		/* Std port of acceptor.	*/
     Message *acceptor_id;	/* id str of msg acceptor.	*/
     double time_stamp;		/* Time of reception.		*/
-    Message msg( src, this );
-
-#if HAVE_PARASOL
     Instance::Instance * ip = object_tab[ps_myself];
 
     ip->timeline_trace( SYNC_INTERACTION_INITIATED, src, _entry );
@@ -80,7 +82,12 @@ Call::send_synchronous( const Entry * src, const int priority, const long reply_
     ps_my_schedule_time = ps_now;		/* In case we don't block...	*/
 
     ps_receive( reply_port, NEVER, &j1, &time_stamp, (char **)&acceptor_id, &acceptor_port );
-    ip->timeline_trace( SYNC_INTERACTION_COMPLETED, src, acceptor_id->client );
+    ip->timeline_trace( SYNC_INTERACTION_COMPLETED, src, acceptor_id->client, _entry );
+#else
+    Message * acceptor_id;	/* Reply from the acceptor.	*/
+    msg.reply_port = reply_port;
+    _entry->task()->dispatch();
+    co_await _entry->task()->rendezvous().send( &msg, &acceptor_id );
 #endif
 }
 
@@ -94,7 +101,6 @@ Call::send_synchronous( const Entry * src, const int priority, const long reply_
 void
 Call::send_asynchronous( const Entry * src, const int priority )
 {
-#if HAVE_PARASOL
     Entry * dst = _entry;
     Task * cp = dst->task();
     Message * msg = cp->alloc_message();
@@ -102,6 +108,7 @@ Call::send_asynchronous( const Entry * src, const int priority )
 	msg->init( src, this );
 
 	r_loss_prob.record( 0 );
+#if HAVE_PARASOL
 	Instance::Instance * ip = object_tab[ps_myself];
 	ip->timeline_trace( ASYNC_INTERACTION_INITIATED, src, _entry );
 
@@ -113,6 +120,10 @@ Call::send_asynchronous( const Entry * src, const int priority )
 				      priority + _entry->priority() ) == SYSERR ) {
 	    throw std::runtime_error( "Call::send_asynchronous" );
 	}
+#else
+	cp->dispatch();
+	cp->rendezvous().post( msg );
+#endif
     } else {
 	r_loss_prob.record( 1 );
 	if ( Pragma::__pragmas->abort_on_dropped_message() ) {
@@ -120,7 +131,6 @@ Call::send_asynchronous( const Entry * src, const int priority )
 	    throw std::runtime_error( "Call::send_asynchronous" );
 	}
     }
-#endif
 }
 
 void
@@ -286,10 +296,12 @@ Targets::store_target_info( Entry * to_entry, double value )
 
 
 /*
- * Compute the PDF for arg.  If normalize is true, the 'calls' field of
- * tinfo_ptr->target is not normalized, so perform a normalization step.
- * In no calls are made at all, tprob is set to zero and sum is set to 1.0.
- * Otherwise, validate sum for proper probability.  Return the sum.
+ * Build the alias table for choosing a target.  If normalize is true,
+ * the 'calls' field of tinfo_ptr->target is not normalized, so the
+ * probability of calling target i is calls/(sum+1) and that of making
+ * no call is 1/(sum+1).  Otherwise (forwarding), the calls are
+ * probabilities and no call is made with probability 1-sum.  Return
+ * the sum.
  */
 
 double
@@ -299,11 +311,13 @@ Targets::configure( LQIO::DOM::Phase::Type type, bool normalize )
     
     std::for_each( _target.begin(), _target.end(), std::mem_fn( &Call::configure ) );
     const double sum = std::accumulate( _target.begin(), _target.end(), static_cast<double>(0.0),
-				  []( double sum, Call& target ){ target._tprob = sum + target.calls(); return target._tprob; } );
+				  []( double sum, const Call& target ){ return sum + target.calls(); } );
 
-    if ( _type != LQIO::DOM::Phase::Type::DETERMINISTIC && normalize ) {	// STOCHASTIC conflicts with Parasol.
-	/* Normalize STOCHASTIC, but not forwarding. */
-	std::for_each( _target.begin(), _target.end(), [=]( Call& target ){ target._tprob /= (sum + 1); } );
+    if ( _type != LQIO::DOM::Phase::Type::DETERMINISTIC ) {	// STOCHASTIC conflicts with Parasol.
+	std::vector<double> weights( _target.size() + 1 );
+	std::transform( _target.begin(), _target.end(), weights.begin(), std::mem_fn( &Call::calls ) );
+	weights.back() = normalize ? 1.0 : std::max( 0.0, 1.0 - sum );
+	_alias.configure( weights );
     }
     return sum;
 }
@@ -327,15 +341,13 @@ Call *
 Targets::get_next_target( std::pair<size_t,size_t>& history ) const
 {
     if ( size() == 0 ) return nullptr;
-    double p;		/* branch probability		*/
     size_t& i = history.first;
     size_t& j = history.second;
     
     switch ( _type ) {
 
     case LQIO::DOM::Phase::Type::STOCHASTIC:
-	p = Random::number();
-	for ( i = 0; i < size() && p >= _target[i]._tprob; i = i + 1 );
+	i = _alias();
 	break;
 
     case LQIO::DOM::Phase::Type::DETERMINISTIC:
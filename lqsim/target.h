@@ -13,6 +13,8 @@
 #include <assert.h>
 #include <lqio/dom_call.h>
 #include <lqio/dom_phase.h>
+#include "lqsim.h"
+#include "random.h"
 #include "result.h"
 
 class Activity;
@@ -40,7 +42,7 @@ public:
 
     void configure();
 
-    void send_synchronous ( const Entry *, const int priority,  const long reply_port );
+    process_t send_synchronous ( const Entry *, const int priority,  const long reply_port );
     void send_asynchronous( const Entry *, const int priority );
     FILE * print( FILE * ) const;
     Call& insertDOMResults();
@@ -54,7 +56,6 @@ public:
 private:
     Entry * _entry;			/* target entry 		*/
     int _link;				/* Link to send data on.	*/
-    double _tprob;			/* test probability		*/
     double _calls;			/* # of calls.			*/
     bool _reply;			/* Generate reply.		*/
     LQIO::DOM::Call* _call;		/* ...instead of dynamic_cast	*/
@@ -64,7 +65,7 @@ class Targets {				/* send table struct		*/
 public:
     typedef std::vector<Call>::const_iterator const_iterator;
 
-    Targets() : _type(LQIO::DOM::Phase::STOCHASTIC), _target() {}
+    Targets() : _type(LQIO::DOM::Phase::STOCHASTIC), _target(), _alias() {}
     ~Targets() {}
 
     size_t size() const { return _target.size(); }
@@ -74,6 +75,7 @@ public:
     void store_target_info( Entry * to_entry, LQIO::DOM::Call* a_call );
     void store_target_info( Entry * to_entry, double );
     double configure( LQIO::DOM::Phase::Type, bool=true );
+    void name( const std::string& name ) { _alias.name( name ); }
     void initialize();
     Call * get_next_target( std::pair<size_t,size_t>& ) const;
     std::ostream& print( std::ostream& ) const;
@@ -85,6 +87,7 @@ public:
 private:
     LQIO::DOM::Phase::Type _type;	/* 				*/
     std::vector<Call> _target;		/* target array			*/
+    Alias _alias;			/* STOCHASTIC target, or size() for none. */
 };
 #endif
 
@@ -37,11 +37,6 @@
 
 std::set<Task *, Task::ltTask> Task::__tasks;	/* Task table.	*/
 
-#if !HAVE_PARASOL
-template class Rendezvous::Multi_Server<int,int>;
-template class Rendezvous::Single_Server<int,int>;
-#endif
-
 const std::map<const Task::Type,const std::string> Task::type_strings =  {
     { Task::Type::UNDEFINED,              "Undefined" },
     { Task::Type::CLIENT,                 "client" },
@@ -89,8 +84,11 @@ Task::Task( LQIO::DOM::Task* dom, Processor * processor, Group * group )
       _joins(),
 #if HAVE_PARASOL
       _pending_msgs(),
-      _free_msgs(),
+#else
+      _rendezvous(),
 #endif
+      _max_msgs(0),
+      _n_msgs(0),
       trace_flag(false),
       _hist_data(nullptr),
       r_cycle("Cycle time",dom),
@@ -109,9 +107,6 @@ Task::~Task()
 {
     std::for_each( activities().begin(), activities().end(), []( Activity * activity ){ delete activity; } );
     std::for_each( precedences().begin(), precedences().end(), []( ActivityList * list ){ delete list; } );
-#if HAVE_PARASOL
-    std::for_each( _free_msgs.begin(), _free_msgs.end(), []( Message * message ){ delete message; } );
-#endif
 
     if ( _hist_data ) {
 	delete _hist_data;
@@ -187,9 +182,7 @@ Task::create()
     initialize();
 
     if ( has_send_no_reply() ) {
-#if HAVE_PARASOL
-	alloc_pool();
-#endif
+	set_max_messages();
     }
 
     return *this;
@@ -290,13 +283,14 @@ Task::find_activity( const std::string& name ) const
 }
 
 
-#if HAVE_PARASOL
 /*
- * allocate message pool for asynchronous messages.
+ * Set the number of asynchronous messages that can be queued for the
+ * task.  Messages sent when the queue is full are lost.  The messages
+ * themselves come from a slab that grows as needed.
  */
 
 void
-Task::alloc_pool()
+Task::set_max_messages()
 {
     unsigned long size = Pragma::__pragmas->queue_size();
     if ( size == 0 ) {
@@ -312,22 +306,17 @@ Task::alloc_pool()
 	    size = DEFAULT_QUEUE_SIZE;
 	}
     }
-
-    for ( unsigned long i = 0; i < size; ++i ) {
-	_free_msgs.push_back( new Message );
-    }
+    _max_msgs = size;
+    _n_msgs = 0;
 }
 
 
 Message *
 Task::alloc_message()
 {
-    Message * msg = nullptr;
-    if ( _free_msgs.size() > 0 ) {
-	msg = _free_msgs.front();
-	_free_msgs.pop_front();
-    }
-    return msg;
+    if ( _n_msgs >= _max_msgs ) return nullptr;
+    _n_msgs += 1;
+    return new Message;
 }
 
 void
@@ -339,9 +328,9 @@ Task::free_message( Message * msg )
     Call *tp = msg->target;
     tp->r_delay.record( delta );
     tp->r_delay_sqr.record( square( delta ) );
-    _free_msgs.push_back( msg );
+    _n_msgs -= 1;
+    delete msg;
 }
-#endif
 
 
 
@@ -692,16 +681,13 @@ Task::derive_utilization() const
 /* ------------------------------------------------------------------------ */
 
 Reference_Task::Reference_Task( LQIO::DOM::Task* dom, Processor * processor, Group * group )
-    : Task( dom, processor, group ), _clients()
+    : Task( dom, processor, group ), _clients(), _thinking(1.0)
 {
 }
 
 
 Reference_Task::~Reference_Task()
 {
-#if !HAVE_PARASOL
-    std::for_each( _clients.begin(), _clients.end(), []( Instance::Client * client ) { delete client; } );
-#endif
 }
 
 
@@ -710,7 +696,7 @@ Reference_Task::create_instance()
 {
     _clients.clear();		// can't do this in destructor
     for ( unsigned i = 0; i < multiplicity(); ++i ) {
-	_clients.push_back( new Instance::Client( this, name() ) );
+	_clients.push_back( new Instance::Client( this, name(), i ) );
     }
 }
 
@@ -721,7 +707,8 @@ Reference_Task::run()
 #if HAVE_PARASOL
     return std::all_of( _clients.begin(), _clients.end(), []( Instance::Instance * task ){ return ps_resume( task->task_id() ) == OK; } );
 #else
-    return std::all_of( _clients.begin(), _clients.end(), []( Instance::Instance * task ){ return task->set_thread( new std::thread( &Instance::Instance::run, task ) ); } );
+    std::for_each( _clients.begin(), _clients.end(), []( Instance::Instance * task ){ EventHandler::start( task->run() ); } );
+    return true;
 #endif
 }
 
@@ -732,8 +719,8 @@ Reference_Task::stop()
 #if HAVE_PARASOL
     std::for_each( _clients.begin(), _clients.end(), []( Instance::Instance * task ){ return ps_kill( task->task_id() ); } );
 #else
-    // Need to stop...
-    std::for_each( _clients.begin(), _clients.end(), []( Instance::Instance * task ){ task->get_thread()->join(); } );
+    std::for_each( _clients.begin(), _clients.end(), []( Instance::Client * client ) { delete client; } );
+    _clients.clear();
 #endif
     return *this;
 }
@@ -750,9 +737,6 @@ Server_Task::Server_Task( LQIO::DOM::Task* dom, Processor * processor, Group * g
 
 Server_Task::~Server_Task()
 {
-#if !HAVE_PARASOL
-    delete _server;
-#endif
 }
 
 int
@@ -781,9 +765,7 @@ Server_Task::set_synchronization_server()
 void
 Server_Task::create_instance()
 {
-#if HAVE_PARASOL
     _server = new Instance::Server( this, name() );
-#endif
 }
 
 
@@ -793,7 +775,8 @@ Server_Task::run()
 #if HAVE_PARASOL
     return ps_resume( _server->task_id() ) == OK;
 #else
-    return _server->set_thread( new std::thread( &Instance::Instance::run, _server ) );
+    EventHandler::start( _server->run() );
+    return true;
 #endif
 }
 
@@ -805,7 +788,8 @@ Server_Task::stop()
     ps_suspend( _server->task_id() );
     ps_kill( _server->task_id() );
 #else
-    _server->get_thread()->join();
+    delete _server;
+    rendezvous().clear();
 #endif
     _server = nullptr;
     return *this;
@@ -819,7 +803,6 @@ Multi_Server_Task::Multi_Server_Task( LQIO::DOM::Task* dom, Processor * processo
 #if HAVE_PARASOL
       _worker_port(-1)
 #else
-      _rendezvous(dom->getCopiesValue()),
       _servers()
 #endif
 {
@@ -828,9 +811,6 @@ Multi_Server_Task::Multi_Server_Task( LQIO::DOM::Task* dom, Processor * processo
 
 Multi_Server_Task::~Multi_Server_Task()
 {
-#if !HAVE_PARASOL
-    delete _server;
-#endif
 }
 
 
@@ -857,6 +837,10 @@ Multi_Server_Task::create_instance()
 #if HAVE_PARASOL
     _server = new Instance::Multiserver( this, name(), multiplicity() );
     _worker_port = ps_allocate_port( name().c_str(), _server->task_id() );
+#else
+    for ( unsigned i = 0; i < multiplicity(); ++i ) {
+	_servers.push_back( new Instance::Server( this, name() ) );
+    }
 #endif
 }
 
@@ -867,7 +851,8 @@ Multi_Server_Task::run()
 #if HAVE_PARASOL
     return ps_resume( _server->task_id() ) == OK;
 #else
-    return false;
+    std::for_each( _servers.begin(), _servers.end(), []( Instance::Instance * task ){ EventHandler::start( task->run() ); } );
+    return true;
 #endif
 }
 
@@ -881,7 +866,9 @@ Multi_Server_Task::stop()
     _server = nullptr;
     _worker_port = -1;
 #else
-    std::for_each( _servers.begin(), _servers.end(), []( Instance::Instance * task ){ task->get_thread()->join(); } );
+    std::for_each( _servers.begin(), _servers.end(), []( Instance::Instance * task ){ delete task; } );
+    _servers.clear();
+    rendezvous().clear();
 #endif
     return *this;
 }
@@ -893,7 +880,7 @@ Infinite_Server_Task::Infinite_Server_Task( LQIO::DOM::Task* dom, Processor * pr
       _server(nullptr),
       _worker_port(-1)
 #if !HAVE_PARASOL
-    , _rendezvous(dom->getCopiesValue())
+    , _servers()
 #endif
 {
 }
@@ -901,9 +888,6 @@ Infinite_Server_Task::Infinite_Server_Task( LQIO::DOM::Task* dom, Processor * pr
 
 Infinite_Server_Task::~Infinite_Server_Task()
 {
-#if !HAVE_PARASOL
-    delete _server;
-#endif
 }
 
 int
@@ -942,13 +926,28 @@ Infinite_Server_Task::create_instance()
 }
 
 
+#if !HAVE_PARASOL
+/*
+ * Add a server if all of them are busy, so no message waits.
+ */
+
+void
+Infinite_Server_Task::dispatch()
+{
+    if ( rendezvous().idle() ) return;
+    _servers.push_back( new Instance::Server( this, name() ) );
+    EventHandler::start( _servers.back()->run() );
+}
+#endif
+
+
 bool
 Infinite_Server_Task::run()
 {
 #if HAVE_PARASOL
     return ps_resume( _server->task_id() ) == OK;
 #else
-    return false;
+    return true;		/* Servers are added by dispatch(). */
 #endif
 }
 
@@ -961,6 +960,10 @@ Infinite_Server_Task::stop()
     ps_kill( _server->task_id() );
     _server = nullptr;
     _worker_port = -1;
+#else
+    std::for_each( _servers.begin(), _servers.end(), []( Instance::Instance * task ){ delete task; } );
+    _servers.clear();
+    rendezvous().clear();
 #endif
     return *this;
 }
@@ -1355,7 +1358,8 @@ Pseudo_Task::run()
 #if HAVE_PARASOL
     return ps_resume( _task->task_id() ) == OK;
 #else
-    return _task->set_thread( new std::thread( &Instance::Instance::run, _task ) );
+    EventHandler::start( _task->run() );
+    return true;
 #endif
 }
 
@@ -1365,7 +1369,9 @@ Pseudo_Task::stop()
 {
 #if HAVE_PARASOL
     ps_kill( _task->task_id() );
-    _task = 0;
+#else
+    delete _task;
 #endif
+    _task = 0;
     return *this;
 }
@@ -26,9 +26,9 @@
 #include "actlist.h"
 #include "processor.h"
 #include "result.h"
+#include "message.h"
 #if HAVE_PARASOL
 #include <parasol/para_internals.h>
-#include "message.h"
 #else
 #include "rendezvous.h"
 #endif
@@ -131,9 +131,12 @@ public:
 #if HAVE_PARASOL
     void set_group_id( int group_id ) { _group_id = group_id; }
     int group_id() const { return _group_id; }
+#else
+    Rendezvous::Rendezvous<Message *,Message *>& rendezvous() { return _rendezvous; }
+    virtual void dispatch() {}			/* Before a message is sent.	*/
+#endif
     Message * alloc_message();
     void free_message( Message * msg );
-#endif
 
     Activity * find_activity( const std::string& activity_name ) const;
 
@@ -172,9 +175,7 @@ protected:
 private:
     bool has_send_no_reply() const;
 
-#if HAVE_PARASOL
-    void alloc_pool();
-#endif
+    void set_max_messages();
 
     double throughput() const;
     double throughput_variance() const;
@@ -198,8 +199,11 @@ private:
 
 #if HAVE_PARASOL
     std::list<Message *> _pending_msgs;		/* Messages blocked by join.	*/
-    std::list<Message *> _free_msgs;		/* Pool of messages 		*/
+#else
+    Rendezvous::Rendezvous<Message *,Message *> _rendezvous;	/* Messages to the instances.	*/
 #endif
+    unsigned long _max_msgs;			/* Queue length (async).	*/
+    unsigned long _n_msgs;			/* Async messages queued.	*/
 
 public:
     bool trace_flag;				/* True if task is to be traced	*/
@@ -226,6 +230,8 @@ public:
 
     virtual Type type() const { return Task::Type::CLIENT; }
     virtual double think_time() const { return getDOM()->getThinkTimeValue(); }
+    double thinking() const { return _thinking; }
+    void set_thinking( double thinking ) { _thinking = thinking; }
 
     virtual bool run();
     virtual Reference_Task& stop();
@@ -235,6 +241,7 @@ protected:
 
 private:
     std::vector<Instance::Client *> _clients;	/* task id's of clients		*/
+    double _thinking;				/* P(start thinking).		*/
 };
 
 class Server_Task : public Task
@@ -257,11 +264,6 @@ protected:
 protected:
     Instance::Instance * _server;		/* task id of main inst	        */
     bool _sync_server;				/* True if we sync here		*/
-
-private:
-#if !HAVE_PARASOL
-    Rendezvous::Single_Server<int,int> _rendezvous;
-#endif
 };
 
 class Multi_Server_Task : public Task
@@ -290,8 +292,7 @@ private:
 #if HAVE_PARASOL
     int _worker_port;				/* Port for workers to send to.	*/
 #else
-    Rendezvous::Multi_Server<int,int> _rendezvous;
-    std::vector<Instance::Client *> _servers;	/* task id's of clients		*/
+    std::vector<Instance::Instance *> _servers;	/* All receive from rendezvous.	*/
 #endif
 };
 
@@ -307,6 +308,9 @@ public:
     virtual bool is_async_inf_server() const;
     virtual int worker_port() const { return _worker_port; }
 
+#if !HAVE_PARASOL
+    virtual void dispatch();
+#endif
     virtual bool run();
     virtual Infinite_Server_Task& stop();
 
@@ -319,7 +323,7 @@ protected:
 private:
     int _worker_port;				/* Port for workers to send to.	*/
 #if !HAVE_PARASOL
-    Rendezvous::Multi_Server<int,int> _rendezvous;
+    std::vector<Instance::Instance *> _servers;	/* All receive from rendezvous.	*/
 #endif
 };
 
@@ -0,0 +1,268 @@
+/************************************************************************/
+/* Copyright the Real-Time and Distributed Systems Group,		*/
+/* Department of Systems and Computer Engineering,			*/
+/* Carleton University, Ottawa, Ontario, Canada. K1S 5B6		*/
+/* 									*/
+/* October 2026								*/
+/************************************************************************/
+
+/*
+ * lqsim-trace -- convert a binary trace written by lqsim -tbinary=file
+ * to CSV or to the Chrome trace-event format (chrome://tracing,
+ * Perfetto).
+ *
+ *	lqsim-trace [--csv|--json] [--output=file] trace
+ *
+ * For the Chrome format, each task is a process and each of its
+ * instances a thread.  Time is in microseconds, taking one unit of
+ * simulation time as a millisecond as the timeline output does.
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "bintrace.h"
+
+static const struct option longopts[] = {
+    { "csv",    no_argument,       0, 'c' },
+    { "json",   no_argument,       0, 'j' },
+    { "output", required_argument, 0, 'o' },
+    { "help",   no_argument,       0, 'h' },
+    { nullptr, 0, 0, 0 }
+};
+
+static const char * toolname = "lqsim-trace";
+
+static void
+usage()
+{
+    fprintf( stderr, "Usage: %s [--csv|--json] [--output=file] trace\n", toolname );
+    fprintf( stderr, "\t-c, --csv\tOutput comma separated values (default).\n" );
+    fprintf( stderr, "\t-j, --json\tOutput Chrome trace-event JSON.\n" );
+    fprintf( stderr, "\t-o, --output\tWrite to file rather than to standard output.\n" );
+}
+
+
+/*
+ * Quote s for JSON.  Names come from the model so only quotes and
+ * backslashes need escaping.
+ */
+
+static std::string
+quote( const std::string& s )
+{
+    std::string result = "\"";
+    for ( std::string::const_iterator c = s.begin(); c != s.end(); ++c ) {
+	if ( *c == '"' || *c == '\\' ) result += '\\';
+	result += *c;
+    }
+    return result + "\"";
+}
+
+
+class Trace {
+public:
+    Trace() : _header(), _records(), _instances(), _entries() {}
+    bool read( FILE * );
+
+    void csv( FILE * ) const;
+    void json( FILE * ) const;
+
+private:
+    std::string instance( uint32_t id ) const;
+    std::string entry( uint32_t id ) const;
+
+private:
+    BinaryTrace::Header _header;
+    std::vector<BinaryTrace::Record> _records;		/* Oldest first.	*/
+    std::map<uint32_t,std::string> _instances;
+    std::map<uint32_t,std::string> _entries;
+};
+
+
+/*
+ * Read the header, the records in the order they were written, then
+ * the name table if lqsim got to write it.
+ */
+
+bool
+Trace::read( FILE * input )
+{
+    if ( fread( &_header, sizeof( _header ), 1, input ) != 1
+	 || memcmp( _header.magic, BinaryTrace::MAGIC, sizeof( _header.magic ) ) != 0 ) {
+	fprintf( stderr, "%s: not an lqsim binary trace.\n", toolname );
+	return false;
+    } else if ( _header.version != BinaryTrace::FORMAT_VERSION || _header.record_size != sizeof( BinaryTrace::Record ) ) {
+	fprintf( stderr, "%s: unsupported trace version %u.\n", toolname, _header.version );
+	return false;
+    }
+
+    std::vector<BinaryTrace::Record> ring( _header.capacity );
+    if ( fread( ring.data(), sizeof( BinaryTrace::Record ), ring.size(), input ) != ring.size() ) {
+	fprintf( stderr, "%s: trace is truncated.\n", toolname );
+	return false;
+    }
+    if ( _header.count <= _header.capacity ) {
+	_records.assign( ring.begin(), ring.begin() + _header.count );
+    } else {
+	const size_t oldest = _header.count & (_header.capacity - 1);
+	_records.assign( ring.begin() + oldest, ring.end() );
+	_records.insert( _records.end(), ring.begin(), ring.begin() + oldest );
+    }
+
+    if ( _header.names == 0 ) {
+	fprintf( stderr, "%s: warning: trace has no names; lqsim did not finish.\n", toolname );
+	return true;
+    }
+    for ( uint64_t i = 0; i < _header.n_names; ++i ) {
+	BinaryTrace::Name name;
+	if ( fread( &name, sizeof( name ), 1, input ) != 1 ) return false;
+	std::string s( name.length, '\0' );
+	if ( name.length > 0 && fread( &s[0], 1, name.length, input ) != name.length ) return false;
+	if ( name.kind == static_cast<uint32_t>(BinaryTrace::Kind::INSTANCE) ) {
+	    _instances[name.id] = s;
+	} else {
+	    _entries[name.id] = s;
+	}
+    }
+    return true;
+}
+
+
+std::string
+Trace::instance( uint32_t id ) const
+{
+    std::map<uint32_t,std::string>::const_iterator i = _instances.find( id );
+    return i != _instances.end() ? i->second : std::to_string( id );
+}
+
+
+std::string
+Trace::entry( uint32_t id ) const
+{
+    if ( id == BinaryTrace::NO_ENTRY ) return std::string();
+    std::map<uint32_t,std::string>::const_iterator e = _entries.find( id );
+    return e != _entries.end() ? e->second : std::to_string( id );
+}
+
+
+void
+Trace::csv( FILE * output ) const
+{
+    fprintf( output, "time,event,task,instance,entry,peer,value\n" );
+    for ( std::vector<BinaryTrace::Record>::const_iterator r = _records.begin(); r != _records.end(); ++r ) {
+	fprintf( output, "%.17g,%s,%s,%u,%s,%s,%.17g\n", r->time, BinaryTrace::event_name( r->event ),
+		 instance( r->instance ).c_str(), r->instance, entry( r->entry ).c_str(), entry( r->peer ).c_str(), r->value );
+    }
+}
+
+
+/*
+ * Computation is a duration ("B"/"E"), messages are instant events
+ * on the thread of the instance.  Tasks are numbered in order of their
+ * names for the pid.
+ */
+
+void
+Trace::json( FILE * output ) const
+{
+    std::map<std::string,unsigned int> pids;
+    for ( std::map<uint32_t,std::string>::const_iterator i = _instances.begin(); i != _instances.end(); ++i ) {
+	pids.insert( std::pair<std::string,unsigned int>( i->second, 0 ) );
+    }
+    unsigned int n = 0;
+    for ( std::map<std::string,unsigned int>::iterator p = pids.begin(); p != pids.end(); ++p ) {
+	p->second = ++n;
+    }
+
+    fprintf( output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+    const char * separator = "";
+    for ( std::map<std::string,unsigned int>::const_iterator p = pids.begin(); p != pids.end(); ++p ) {
+	fprintf( output, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":%s}}", separator, p->second, quote( p->first ).c_str() );
+	separator = ",\n";
+    }
+    for ( std::map<uint32_t,std::string>::const_iterator i = _instances.begin(); i != _instances.end(); ++i ) {
+	fprintf( output, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":%s}}", separator,
+		 pids[i->second], i->first, quote( i->second + "(" + std::to_string( i->first ) + ")" ).c_str() );
+    }
+
+    for ( std::vector<BinaryTrace::Record>::const_iterator r = _records.begin(); r != _records.end(); ++r ) {
+	std::map<uint32_t,std::string>::const_iterator i = _instances.find( r->instance );
+	const unsigned int pid = i != _instances.end() ? pids[i->second] : 0;
+	const double ts = r->time * 1000.;
+	const BinaryTrace::Event event = static_cast<BinaryTrace::Event>(r->event);
+	fprintf( output, "%s{\"pid\":%u,\"tid\":%u,\"ts\":%.17g,", separator, pid, r->instance, ts );
+	separator = ",\n";
+	switch ( event ) {
+	case BinaryTrace::Event::COMPUTE_START:
+	    fprintf( output, "\"name\":\"compute\",\"ph\":\"B\",\"args\":{\"demand\":%.17g}}", r->value );
+	    break;
+	case BinaryTrace::Event::COMPUTE_END:
+	    fprintf( output, "\"name\":\"compute\",\"ph\":\"E\"}" );
+	    break;
+	default:
+	    fprintf( output, "\"name\":%s,\"ph\":\"i\",\"s\":\"t\",\"args\":{\"entry\":%s,\"peer\":%s",
+		     quote( BinaryTrace::event_name( r->event ) ).c_str(), quote( entry( r->entry ) ).c_str(), quote( entry( r->peer ) ).c_str() );
+	    if ( event == BinaryTrace::Event::RECEIVE ) {
+		fprintf( output, ",\"sent\":%.17g", r->value );
+	    }
+	    fprintf( output, "}}" );
+	    break;
+	}
+    }
+    fprintf( output, "\n]}\n" );
+}
+
+
+int
+main( int argc, char * argv[] )
+{
+    bool json = false;
+    const char * output_file = nullptr;
+
+    for ( ;; ) {
+	const int c = getopt_long( argc, argv, "cjo:h", longopts, nullptr );
+	if ( c == EOF ) break;
+	switch ( c ) {
+	case 'c': json = false; break;
+	case 'j': json = true; break;
+	case 'o': output_file = optarg; break;
+	case 'h': usage(); return EXIT_SUCCESS;
+	default:  usage(); return EXIT_FAILURE;
+	}
+    }
+    if ( argc - optind != 1 ) {
+	usage();
+	return EXIT_FAILURE;
+    }
+
+    FILE * input = fopen( argv[optind], "rb" );
+    if ( input == nullptr ) {
+	fprintf( stderr, "%s: cannot open %s: %s.\n", toolname, argv[optind], strerror( errno ) );
+	return EXIT_FAILURE;
+    }
+    Trace trace;
+    const bool ok = trace.read( input );
+    fclose( input );
+    if ( !ok ) return EXIT_FAILURE;
+
+    FILE * output = stdout;
+    if ( output_file != nullptr && strcmp( output_file, "-" ) != 0 ) {
+	output = fopen( output_file, "w" );
+	if ( output == nullptr ) {
+	    fprintf( stderr, "%s: cannot open %s: %s.\n", toolname, output_file, strerror( errno ) );
+	    return EXIT_FAILURE;
+	}
+    }
+    if ( json ) {
+	trace.json( output );
+    } else {
+	trace.csv( output );
+    }
+    return fclose( output ) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -255,6 +255,61 @@ LOCAL	ps_event_t	*next_event(void);
 
 /************************************************************************/
 
+LOCAL	void	list_to_heap(void);
+
+/* Moves the events from the calendar list to the calendar heap.	*/
+
+/************************************************************************/
+
+LOCAL	void	heap_to_list(void);
+
+/* Moves the events from the calendar heap back to the calendar list.	*/
+
+/************************************************************************/
+
+LOCAL	void	heap_insert(
+
+/* Adds an event to the calendar heap.					*/
+
+	ps_event_t	*ep			/* event pointer	*/
+);
+
+/************************************************************************/
+
+LOCAL	void	heap_delete(
+
+/* Removes an event from the calendar heap.				*/
+
+	ps_event_t	*ep			/* event pointer	*/
+);
+
+/************************************************************************/
+
+LOCAL	void	heap_sift(
+
+/* Moves an event up or down the calendar heap to its proper place.	*/
+
+	long	i				/* event index		*/
+);
+
+/************************************************************************/
+
+LOCAL	double	heap_latest(void);
+
+/* Returns the time of the latest event in the calendar heap.		*/
+
+/************************************************************************/
+
+LOCAL	ps_event_t	*heap_block(
+
+/* Returns the first END_BLOCK event at the current time found in the	*/
+/* calendar heap below index i, or the null event pointer.		*/
+
+	long	i				/* event index		*/
+);
+
+/************************************************************************/
+
 LOCAL	void	ready(
 
 /* Makes the given task TASK_READY and queues it on the appropriate	*/
@@ -497,7 +552,7 @@ LOCAL	void	free_mess(
 
 LOCAL 	void 	free_pair(
 
-/* Stuffs a freed tp pair onto the tpflist.				*/
+/* Returns a tp pair to its slab.					*/
 
 	ps_tp_pair_t *pp			/* tp pair pointer	*/
 );
@@ -523,7 +578,7 @@ LOCAL	ps_mess_t	*get_mess(void);
 
 LOCAL 	ps_tp_pair_t *get_pair(void);
 
-/* Returns a pointer to a tp pair using tpflist if possible		*/
+/* Returns a pointer to a tp pair from its slab.			*/
 
 /************************************************************************/
 
@@ -604,6 +659,21 @@ LOCAL 	long	port_send(
 
 /************************************************************************/
 
+LOCAL	double	profile_clock(void);
+
+/* Returns the elapsed time in seconds for timing the kernel.		*/
+
+/************************************************************************/
+
+LOCAL	void	profile_send(
+
+/* Counts a message queued on a port and the length of its queue.	*/
+
+	ps_port_t	*pp			/* port pointer		*/
+);
+
+/************************************************************************/
+
 LOCAL	long	relative(
 
 /* Tests if given task is a relative of the target task.  A relative is	*/
@@ -656,6 +726,17 @@ LOCAL	int	stat_compare(
 	ps_stat_t 	*s2
 );
 
+/************************************************************************/
+
+LOCAL	int	event_compare(
+
+/* This is a callback function that is passed in to quicksort for 	*/
+/* sorting the calendar heap in event order.				*/
+
+	ps_event_t	**e1,
+	ps_event_t	**e2
+);
+
 #ifdef STACK_TESTING
 
 /************************************************************************/
@@ -857,6 +938,12 @@ void cap_handler(ps_task_t *tp);
 	if(ntask_bps) set_task_state((tp), (newstate)); \
 	else (tp)->state = (newstate);
 
+#define	HEAP_ON		64		/* events to switch to the heap	*/
+#define	HEAP_OFF	16		/* events to switch to the list	*/
+#define	SLAB_MIN	64		/* slots in a slab's first block*/
+#define	SLAB_MAX	4096		/* most slots in a slab block	*/
+#define	EARLIER(e1, e2) ((e1)->time < (e2)->time || ((e1)->time == (e2)->time && (e1)->seq < (e2)->seq))
+
 #define bus_delay	(mp->size/bp->trate)
 #define	link_delay	(mp->size/lp->trate)
 
@@ -872,11 +959,11 @@ void cap_handler(ps_task_t *tp);
 #if	!HAVE_SIGALTSTACK && !_WIN32 && !_WIN64
 #define mctx_save(mctx) _setjmp((mctx)->jb) 		/* save machine context */ 
 #define mctx_restore(mctx) _longjmp((mctx)->jb, 1)	/* restore machine context */
-#define ctxsw(old,new)	if(!_setjmp((old)->jb)) _longjmp((new)->jb, 1)
+#define ctxsw(old,new)	do { ps_profile.ctxsw++; if(!_setjmp((old)->jb)) _longjmp((new)->jb, 1); } while(0)
 #else
 #define mctx_save(mctx) setjmp((mctx)->jb) 		/* save machine context */ 
 #define mctx_restore(mctx) longjmp((mctx)->jb, 1)	/* restore machine context */
-#define ctxsw(old,new)	if(!setjmp((old)->jb)) longjmp((new)->jb, 1)
+#define ctxsw(old,new)	do { ps_profile.ctxsw++; if(!setjmp((old)->jb)) longjmp((new)->jb, 1); } while(0)
 #endif
 
 /*	CPU states and flags						*/
@@ -995,6 +1082,8 @@ void cap_handler(ps_task_t *tp);
 #define	NULL_PORT_PTR	((ps_port_t *) 0)
 #define	NULL_PAIR_PTR	((ps_tp_pair_t *) 0)
 #define	NULL_MESS_PTR	((ps_mess_t *) 0)
+#define	NULL_SLOT_PTR	((ps_slot_t *) 0)
+#define	NULL_SLAB_PTR	((ps_slab_t *) 0)
 #define NULL_BUF_PTR	((ps_buf_t *) 0)
 #define NULL_CFSRQ_PTR	((ps_cfs_rq_t *) 0)
 #define NULL_SCHED_PTR	((sched_info *) 0)
@@ -1049,20 +1138,48 @@ LOCAL const char *task_state_names[] = {
 	"BLOCKED",
 	NULL };
 
+LOCAL const char *event_type_names[] = {
+	"END_SYNC",
+	"END_COMPUTE",
+	"END_QUANTUM",
+	"END_TRANS",
+	"END_SLEEP",
+	"END_RECEIVE",
+	"END_BLOCK",
+	"LINK_FAILURE",
+	"LINK_REPAIR",
+	"BUS_FAILURE",
+	"BUS_REPAIR",
+	"NODE_FAILURE",
+	"NODE_REPAIR",
+	"USER_EVENT",
+	NULL };
+
 LOCAL rb_node leaf = { RB_BLACK, NIL, NIL, NIL, 0.0,NULL_SCHED_PTR};	
 
 /* WCS - 12 June 1999 - Moved.  See get_dss and ts_report. 		*/
 extern long ps_trsct;				/* trace_rep stack ctest*/
 
 LOCAL	ps_event_t	calendar[2];		/* future event list	*/
-LOCAL	ps_event_t	*event_fl;		/* event free list	*/
+LOCAL	long	event_count;			/* events in calendar	*/
+LOCAL	long	heap_on;			/* events are in heap	*/
+LOCAL	ps_event_t	**heap;			/* future event heap	*/
+LOCAL	long	heap_size;			/* events in heap	*/
+LOCAL	long	heap_max;			/* heap capacity	*/
+LOCAL	long long	heap_seq;		/* last tie breaker	*/
+LOCAL	double	heap_last;			/* latest event time	*/
+LOCAL	long	heap_last_ok;			/* heap_last is valid	*/
+LOCAL	long	heap_flag;			/* heap calendar flag	*/
+LOCAL	long	profile_flag;			/* kernel timing flag	*/
+LOCAL	ps_slab_t	event_slab = PS_SLAB("events", ps_event_t);
 LOCAL	mctx_t	d_context;			/* driver context	*/
 LOCAL	long	step_flag;			/* single step flag	*/
 LOCAL	long	break_flag;			/* break polong flag	*/
 LOCAL	double	break_time;			/* break polong time	*/
 LOCAL	long	reaper_port;			/* grim reaper port	*/
-LOCAL	ps_mess_t *next_mess = NULL_MESS_PTR;	/* free mess pointer	*/
-LOCAL 	ps_tp_pair_t *tpflist = NULL_PAIR_PTR;	/* tp pair free list	*/
+LOCAL	ps_slab_t	mess_slab = PS_SLAB("message envelopes", ps_mess_t);
+LOCAL	ps_slab_t	pair_slab = PS_SLAB("task port pairs", ps_tp_pair_t);
+LOCAL	ps_slab_t	*slab_list = NULL_SLAB_PTR;	/* registered slabs	*/
 LOCAL 	long	sp_dir;				/* stack direction flag	*/
 #if !HAVE_SIGALTSTACK || _WIN32 || _WIN64
 LOCAL	long	sp_ind;				/* stack jmp_buf index	*/
@@ -198,6 +198,8 @@ extern	ps_table_t	ps_stat_tab;
 #define RPF_TRACE	0x01			/* Trace flag		*/
 #define RPF_STEP	0x02			/* Step(debugger) flag	*/
 #define RPF_WARNING	0x04			/* warning flag		*/
+#define RPF_LIST	0x08			/* list calendar flag	*/
+#define RPF_PROFILE	0x10			/* kernel timing flag	*/
 
 /************************************************************************/
 /*                 P A R A S O L   G L O B A L S			*/
@@ -208,6 +210,7 @@ extern 	double		ps_now;			/* current time		*/
 extern	ps_table_t	ps_task_tab;		/* task table		*/
 extern	long		ts_flag;		/* trace state flag	*/
 extern  double		ps_run_time;		/* stop time		*/
+extern	ps_profile_t	ps_profile;		/* kernel counters	*/
 
 /************************************************************************/
 /*                 P A R A S O L   P R O T O T Y P E S			*/
@@ -556,6 +559,46 @@ extern 	char	*ps_get_buffer(
 
 /************************************************************************/
 
+extern	void	*ps_get_slot(
+
+/* Gets an object from a slab, growing the slab if it is empty.  The	*/
+/* slab is registered with ps_next_slab on first use.			*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+);
+
+/************************************************************************/
+
+extern	void	ps_free_slot(
+
+/* Returns an object to its slab.  The object is not overwritten, so	*/
+/* it can be examined until the next ps_get_slot on the same slab.	*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	void	*p				/* object pointer	*/
+);
+
+/************************************************************************/
+
+extern	ps_slab_t	*ps_next_slab(
+
+/* Returns the slab registered after sp, or the first slab if sp is	*/
+/* null, for reporting the allocation counters.				*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+);
+
+/************************************************************************/
+
+extern	const char	*ps_event_name(
+
+/* Returns the name of an event type for reporting ps_profile.		*/
+
+	long	type				/* event type		*/
+);
+
+/************************************************************************/
+
 extern	SYSCALL	ps_join_port_set(
 
 /* Adds an existing owned port to a specified port set.			*/
@@ -133,6 +133,8 @@ typedef	struct	ps_event_t {			/* PARASOL event struct	*/
 	long	*gp;				/* generic pointer	*/
 	struct	ps_event_t	*next;		/* next event pointer	*/
 	struct	ps_event_t	*prior;		/* prior event pointer	*/
+	long long	seq;			/* heap tie breaker	*/
+	long	hx;				/* heap index		*/
 } ps_event_t;
 
 /************************************************************************/
@@ -241,6 +243,45 @@ typedef	struct	ps_sema_t {			/* semaphore struct	*/
 
 /************************************************************************/
 
+typedef	union	ps_slot_t {			/* slab slot header	*/
+	union	ps_slot_t	*next;		/* next free slot	*/
+	double	align;				/* keeps slots aligned	*/
+} ps_slot_t;
+
+typedef	struct	ps_slab_t {			/* fixed size allocator	*/
+	const	char	*name;			/* object name		*/
+	size_t	size;				/* object size		*/
+	long	grow;				/* slots in next block	*/
+	ps_slot_t	*free;			/* free slot list	*/
+	ps_slot_t	*blocks;		/* allocated blocks	*/
+	long	nblocks;			/* # of blocks		*/
+	long	gets;				/* # of allocations	*/
+	long	used;				/* slots in use		*/
+	long	max_used;			/* most slots in use	*/
+	struct	ps_slab_t	*next;		/* next registered slab	*/
+} ps_slab_t;
+
+#define	PS_SLAB(name, type)	{ (name), sizeof(type), 0, 0, 0, 0, 0, 0, 0, 0 }
+
+/************************************************************************/
+
+#define	PS_EVENT_TYPES	14			/* # of event types	*/
+
+typedef	struct	ps_profile_t {			/* kernel profile	*/
+	long	events[PS_EVENT_TYPES];		/* events by type	*/
+	double	handler_time[PS_EVENT_TYPES];	/* seconds by type	*/
+	long	next_events;			/* calendar removals	*/
+	double	calendar_time;			/* seconds in same	*/
+	long	ctxsw;				/* context switches	*/
+	long	find_host;			/* host searches	*/
+	long	find_priority;			/* preemption searches	*/
+	long	sends;				/* messages queued	*/
+	double	queued;				/* sum of queue lengths	*/
+	long	max_queued;			/* longest port queue	*/
+} ps_profile_t;
+
+/************************************************************************/
+
 typedef	struct	ps_stat_t {			/* statistics struct	*/
 	char	*name;				/* statistic name	*/
 	double	resid;				/* non-rounding resid	*/
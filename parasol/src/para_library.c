@@ -155,6 +155,7 @@
 #include <strings.h>
 #endif
 #include <setjmp.h>
+#include <time.h>
 
 #define TEMP_STR_SIZE	128
 
@@ -172,6 +173,7 @@ double		ps_now;				/* current time		*/
 ps_table_t	ps_task_tab;			/* task table		*/
 long		ts_flag;			/* trace state flag	*/
 double		ps_run_time;			/* stop time		*/
+ps_profile_t	ps_profile;			/* kernel counters	*/
 
 /* WCS - 30 Aug 1997 - Added.  See get_dss and ts_report. */
 long		ps_trsct;			/* trace_rep stack ctest*/
@@ -1643,6 +1645,99 @@ char	*ps_get_buffer(
 
 /************************************************************************/
 
+void	ps_free_slot(
+
+/* Returns an object to its slab.  The object is not overwritten, so	*/
+/* it can be examined until the next ps_get_slot on the same slab.	*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	void	*p				/* object pointer	*/
+)
+{
+	ps_slot_t	*slp;			/* slot pointer		*/
+
+	slp = ((ps_slot_t *) p) - 1;
+	slp->next = sp->free;
+	sp->free = slp;
+	sp->used--;
+}
+
+/************************************************************************/
+
+void	*ps_get_slot(
+
+/* Gets an object from a slab, growing the slab if it is empty.  The	*/
+/* slab is registered with ps_next_slab on first use.  Each block holds	*/
+/* twice as many slots as the one before, up to SLAB_MAX, and its slots	*/
+/* are handed out in address order.  Freed slots are reused first.	*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+)
+{
+	long	i;				/* loop index		*/
+	long	stride;				/* slot size (headers)	*/
+	ps_slot_t	*bp;			/* block pointer	*/
+	ps_slot_t	*slp;			/* slot pointer		*/
+
+	if(sp->free == NULL_SLOT_PTR) {
+		if(sp->grow == 0) {
+			sp->grow = SLAB_MIN;
+			sp->next = slab_list;
+			slab_list = sp;
+		}
+		stride = 1 + (sp->size + sizeof(ps_slot_t) - 1) / sizeof(ps_slot_t);
+		if(!(bp = (ps_slot_t *) malloc((1 + sp->grow*stride) * sizeof(ps_slot_t))))
+			ps_abort("Insufficient memory");
+		bp->next = sp->blocks;
+		sp->blocks = bp;
+		sp->nblocks++;
+		slp = bp + 1;
+		for(i = 1; i < sp->grow; i++) {
+			slp->next = slp + stride;
+			slp += stride;
+		}
+		slp->next = NULL_SLOT_PTR;
+		sp->free = bp + 1;
+		if(sp->grow < SLAB_MAX)
+			sp->grow *= 2;
+	}
+	slp = sp->free;
+	sp->free = slp->next;
+	sp->gets++;
+	if(++sp->used > sp->max_used)
+		sp->max_used = sp->used;
+	return((void *) (slp + 1));
+}
+
+/************************************************************************/
+
+ps_slab_t	*ps_next_slab(
+
+/* Returns the slab registered after sp, or the first slab if sp is	*/
+/* null, for reporting the allocation counters.				*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+)
+{
+	return(sp == NULL_SLAB_PTR ? slab_list : sp->next);
+}
+
+/************************************************************************/
+
+const char	*ps_event_name(
+
+/* Returns the name of an event type for reporting ps_profile.		*/
+
+	long	type				/* event type		*/
+)
+{
+	if(type < 0 || type >= PS_EVENT_TYPES)
+		return("UNKNOWN");
+	return(event_type_names[type]);
+}
+
+/************************************************************************/
+
 SYSCALL	ps_join_port_set(
 
 /* Adds an existing owned port to a specified port set.			*/
@@ -2343,6 +2438,7 @@ SYSCALL ps_resend(
 	}
 	else 
 		pp->first = pp->last = mp;
+	profile_send(pp);
 
 	mp->sender = ps_myself;
 	mp->port = mp->org_port = port;
@@ -2426,6 +2522,7 @@ SYSCALL	ps_send_priority(
 	}
 	else 
 		pp->first = pp->last = mp;
+	profile_send(pp);
 
 	mp->sender = ps_myself;
 	mp->port = mp->org_port = port;
@@ -3753,6 +3850,9 @@ SYSCALL	ps_run_parasol(
 	break_flag = FALSE;
 	ts_flag = (flags & RPF_TRACE) ? TRUE : FALSE;
 	w_flag = (flags & RPF_WARNING) ? TRUE : FALSE;
+	heap_flag = (flags & RPF_LIST) ? FALSE : TRUE;
+	profile_flag = (flags & RPF_PROFILE) ? TRUE : FALSE;
+	memset(&ps_profile, 0, sizeof(ps_profile));
 	bs_time = -1.0;
 	init_table(&ps_node_tab, DEFAULT_MAX_NODES, sizeof(ps_node_t));
 	init_table(&ps_group_tab, DEFAULT_MAX_GROUPS, sizeof(ps_group_t));
@@ -4452,7 +4552,10 @@ LOCAL void driver(void)
 {
 	ps_event_t	*ep;			/* event pointer	*/
 	ps_event_t	*next_event();		/* next event function	*/
-	void	(*handler_tab[14])(ps_event_t *ep) = {
+	double	start;				/* profile start time	*/
+	double	stop;				/* profile stop time	*/
+	long	type;				/* event type		*/
+	void	(*handler_tab[PS_EVENT_TYPES])(ps_event_t *ep) = {
 			end_sync_handler,
 			end_compute_handler, 
 			end_quantum_handler,
@@ -4477,12 +4580,21 @@ LOCAL void driver(void)
 			step_flag = TRUE;
 			debug();
 		}
-		if((ep = next_event()) == NULL_EVENT_PTR) {
+		if(profile_flag)
+			start = profile_clock();
+		ep = next_event();
+		if(profile_flag) {
+			stop = profile_clock();
+			ps_profile.calendar_time += stop - start;
+			start = stop;
+		}
+		if(ep == NULL_EVENT_PTR) {
 #ifdef STACK_TESTING
 		  test_all_stacks();
 #endif /* STACK_TESTING */
 		  ps_abort("Empty calendar");
 		}
+		ps_profile.next_events++;
 		if(ep->time < ps_now)
 			ps_abort("Attempt to move time backwards");
 		if(ep->time >= ps_run_time) {
@@ -4491,7 +4603,10 @@ LOCAL void driver(void)
 		}
 		if(ep->time > ps_now) 
 			ps_now = ep->time;
-		(*handler_tab[ep->type])(ep);
+		ps_profile.events[type = ep->type]++;
+		(*handler_tab[type])(ep);
+		if(profile_flag)
+			ps_profile.handler_time[type] += profile_clock() - start;
 	}
 }
  
@@ -4776,6 +4891,7 @@ LOCAL	void	end_trans_handler(
 		pp->last = pp->last->next = mp;		
 	else
 		pp->first = pp->last = mp;
+	profile_send(pp);
 
 	if(tp->state == TASK_RECEIVING && tp->wport == mp->port) {
 		tp->wport = NULL_PORT;
@@ -4800,24 +4916,24 @@ ps_event_t	*add_event(
 	long	*gp				/* generic pointer	*/
 )
 {
-	long	i;				/* loop index		*/
 	ps_event_t	*ep, *epf, *epl;	 /* event pointers	*/
 
-	if(event_fl == NULL_EVENT_PTR) {
-		if(!(ep = event_fl = (ps_event_t *) malloc(100*sizeof(ps_event_t))))
-			ps_abort("Insufficient memory");
-		for(i = 1; i < 100; i++) {
-			epf = ep++;
-			epf->prior = ep;
-		}
-		ep->prior = NULL_EVENT_PTR;
-	}
-	ep = event_fl;
-	event_fl = ep->prior;
+	ep = (ps_event_t *) ps_get_slot(&event_slab);
 	ep->time = time;
 	ep->type = type;
 	ep->gp = gp;
-	if(time <= (epf = calendar[0].next)->time){
+	if(heap_flag && !heap_on && event_count >= HEAP_ON)
+		list_to_heap();
+	event_count++;
+	if(heap_on) {
+		if(heap_size == 0 || time <= (epf = heap[0])->time ||
+		   (time+time) < (epf->time+heap_latest()))
+			ep->seq = -(++heap_seq);	/* ahead of ties	*/
+		else
+			ep->seq = ++heap_seq;		/* behind ties		*/
+		heap_insert(ep);
+	}
+	else if(time <= (epf = calendar[0].next)->time){
 		ep->next = epf;
 		ep->prior = epf->prior;
 		calendar[0].next = epf->prior = ep;
@@ -4900,6 +5016,7 @@ LOCAL	void	find_host(
 	double	q;				/* quantum		*/
 	long	task;				/* task index		*/
 
+	ps_profile.find_host++;
 	host = NULL_HOST;
 	tp->sched_time = ps_now;		/* Ready to run now!	*/
 	np=node_ptr(tp->node);
@@ -5079,6 +5196,7 @@ LOCAL 	void	find_priority(
 	long	host;				/* host cpu id index	*/
 	double	q;				/* cpu quantum		*/
 	
+	ps_profile.find_priority++;
 	if (np->discipline == PS_CFS){
 		find_priority_cfs(np,hp);
 		return;
@@ -5598,7 +5716,11 @@ LOCAL	void	init_event(void)
 {
 	ps_event_t	*ep;			/* event pointer	*/
 
-	event_fl = NULL_EVENT_PTR;
+	event_count = 0;
+	heap_on = FALSE;
+	heap_size = 0;
+	heap_seq = 0;
+	heap_last_ok = FALSE;
 	(ep = calendar)->time = -1.0;
 	ep->type = CALENDAR;
 	ep->prior = NULL_EVENT_PTR;
@@ -5622,16 +5744,197 @@ LOCAL	ps_event_t	*next_event(void)
 {
 	ps_event_t	*ep, *cep;		/* event pointers	*/
 
-	if((cep = calendar)->next->next == NULL_EVENT_PTR)
-		return(NULL_EVENT_PTR);
+	if(heap_on) {
+		if(heap_size == 0)
+			return(NULL_EVENT_PTR);
+		heap_delete(ep = heap[0]);
+		if(heap_size < HEAP_OFF)
+			heap_to_list();
+	}
+	else {
+		if((cep = calendar)->next->next == NULL_EVENT_PTR)
+			return(NULL_EVENT_PTR);
 
-	ep = cep->next;
-	cep->next = ep->next;
-	ep->next->prior = cep;
-	ep->prior = event_fl;
-	event_fl = ep;
+		ep = cep->next;
+		cep->next = ep->next;
+		ep->next->prior = cep;
+	}
+	event_count--;
+	ps_free_slot(&event_slab, ep);
 	return(ep);
 }
+
+/************************************************************************/
+
+LOCAL	void	list_to_heap(void)
+
+/* Moves the events from the calendar list to the calendar heap.  A	*/
+/* sorted array is already a heap.  The tie breakers are renumbered so	*/
+/* that the events keep their order in the list, and events added	*/
+/* later can still go ahead of or behind all of them.			*/
+
+{
+	ps_event_t	*ep;			/* event pointer	*/
+
+	heap_size = 0;
+	heap_seq = event_count;
+	for(ep = calendar[0].next; ep != &calendar[1]; ep = ep->next) {
+		ep->seq = heap_size - event_count;
+		heap_insert(ep);
+	}
+	calendar[0].next = &calendar[1];
+	calendar[1].prior = &calendar[0];
+	heap_on = TRUE;
+}
+
+/************************************************************************/
+
+LOCAL	void	heap_to_list(void)
+
+/* Moves the events from the calendar heap back to the calendar list	*/
+/* once there are too few of them for the heap to pay off.		*/
+
+{
+	ps_event_t	*ep;			/* event pointer	*/
+	long	i;				/* event index		*/
+
+	qsort(heap, heap_size, sizeof(ps_event_t *), (compar)event_compare);
+	for(ep = calendar, i = 0; i < heap_size; i++) {
+		ep->next = heap[i];
+		heap[i]->prior = ep;
+		ep = heap[i];
+	}
+	ep->next = &calendar[1];
+	calendar[1].prior = ep;
+	heap_size = 0;
+	heap_on = FALSE;
+}
+
+/************************************************************************/
+
+LOCAL	void	heap_insert(
+
+/* Adds an event to the calendar heap.  The time of the latest event	*/
+/* (calendar[1].prior in the list) is tracked here as well.		*/
+
+	ps_event_t	*ep			/* event pointer	*/
+)
+{
+	ps_event_t	**new_heap;		/* new heap pointer	*/
+
+	if(heap_size == heap_max) {
+		heap_max = heap_max ? 2 * heap_max : 128;
+		if(!(new_heap = (ps_event_t **) realloc(heap, 
+		    heap_max*sizeof(ps_event_t *))))
+			ps_abort("Insufficient memory");
+		heap = new_heap;
+	}
+	if(heap_size == 0 || ep->time > heap_last) {
+		heap_last = ep->time;
+		heap_last_ok = TRUE;
+	}
+	heap[heap_size] = ep;
+	heap_sift(heap_size++);
+}
+
+/************************************************************************/
+
+LOCAL	void	heap_delete(
+
+/* Removes an event from the calendar heap.  The event's heap index	*/
+/* makes this O(log n) regardless of where the event is.		*/
+
+	ps_event_t	*ep			/* event pointer	*/
+)
+{
+	long	i = ep->hx;			/* event index		*/
+
+	if(ep->time >= heap_last)
+		heap_last_ok = FALSE;
+	if(i != --heap_size) {
+		heap[i] = heap[heap_size];
+		heap_sift(i);
+	}
+	ep->hx = -1;
+}
+
+/************************************************************************/
+
+LOCAL	void	heap_sift(
+
+/* Moves an event up or down the calendar heap to its proper place.	*/
+
+	long	i				/* event index		*/
+)
+{
+	ps_event_t	*ep = heap[i];		/* event pointer	*/
+	long	j;				/* parent/child index	*/
+
+	while(i > 0 && EARLIER(ep, heap[j = (i - 1) / 2])) {
+		heap[i] = heap[j];
+		heap[i]->hx = i;
+		i = j;
+	}
+	while((j = 2 * i + 1) < heap_size) {
+		if(j + 1 < heap_size && EARLIER(heap[j+1], heap[j]))
+			j++;
+		if(!EARLIER(heap[j], ep))
+			break;
+		heap[i] = heap[j];
+		heap[i]->hx = i;
+		i = j;
+	}
+	heap[i] = ep;
+	ep->hx = i;
+}
+
+/************************************************************************/
+
+LOCAL	double	heap_latest(void)
+
+/* Returns the time of the latest event in the calendar heap.  It is	*/
+/* only recomputed (from the leaves) after the latest event has been	*/
+/* removed.								*/
+
+{
+	long	i;				/* event index		*/
+
+	if(!heap_last_ok) {
+		heap_last = heap[0]->time;
+		for(i = heap_size / 2; i < heap_size; i++)
+			if(heap[i]->time > heap_last)
+				heap_last = heap[i]->time;
+		heap_last_ok = TRUE;
+	}
+	return(heap_last);
+}
+
+/************************************************************************/
+
+LOCAL	ps_event_t	*heap_block(
+
+/* Returns the first END_BLOCK event at the current time found in the	*/
+/* calendar heap below index i, or the null event pointer.  Only the	*/
+/* subtrees holding events at the current time are searched.		*/
+
+	long	i				/* event index		*/
+)
+{
+	ps_event_t	*ep;			/* event pointer	*/
+	ps_event_t	*lep, *rep;		/* child event pointers	*/
+
+	if(i >= heap_size || (ep = heap[i])->time != ps_now)
+		return(NULL_EVENT_PTR);
+	if(ep->type == END_BLOCK)
+		return(ep);
+	lep = heap_block(2 * i + 1);
+	rep = heap_block(2 * i + 2);
+	if(lep == NULL_EVENT_PTR)
+		return(rep);
+	if(rep == NULL_EVENT_PTR)
+		return(lep);
+	return(EARLIER(lep, rep) ? lep : rep);
+}
 	
 /************************************************************************/
 
@@ -5757,18 +6060,30 @@ void	remove_event(
 	
 	if(ep == NULL_EVENT_PTR)
 		return;
-	if(ep->prior == NULL_EVENT_PTR ||
-	   ep->next == NULL_EVENT_PTR ||
-	   ep->next->prior == NULL_EVENT_PTR ||
-	   ep->prior->next == NULL_EVENT_PTR ||
-	   ep->next->prior != ep ||
-	   ep->prior->next != ep)
-		ps_abort("Attempting to remove a non calendar event");
+	if(heap_on) {
+		if(ep->hx < 0 ||
+		   ep->hx >= heap_size ||
+		   heap[ep->hx] != ep)
+			ps_abort("Attempting to remove a non calendar event");
+
+		heap_delete(ep);
+		if(heap_size < HEAP_OFF)
+			heap_to_list();
+	}
+	else {
+		if(ep->prior == NULL_EVENT_PTR ||
+		   ep->next == NULL_EVENT_PTR ||
+		   ep->next->prior == NULL_EVENT_PTR ||
+		   ep->prior->next == NULL_EVENT_PTR ||
+		   ep->next->prior != ep ||
+		   ep->prior->next != ep)
+			ps_abort("Attempting to remove a non calendar event");
 	
-	ep->prior->next = ep->next;
-	ep->next->prior = ep->prior;
-	ep->prior = event_fl;
-	event_fl = ep;
+		ep->prior->next = ep->next;
+		ep->next->prior = ep->prior;
+	}
+	event_count--;
+	ps_free_slot(&event_slab, ep);
 #if defined(DEBUG)
 	print_event( "remove_event", ep );
 #endif
@@ -5786,14 +6101,20 @@ LOCAL	void	sched(void)
 	ps_event_t	*ep;			/* event pointer	*/
 	ps_task_t	*tp, *ctp;		/* task pointers	*/
 
-	ep = calendar;
-	ep = ep->next;
-	while(ep->time == ps_now) {
-		if(ep->type == END_BLOCK)
-			break;
+	if(heap_on)
+		ep = heap_block(0);
+	else {
+		ep = calendar;
 		ep = ep->next;
+		while(ep->time == ps_now) {
+			if(ep->type == END_BLOCK)
+				break;
+			ep = ep->next;
+		}
+		if(ep->time != ps_now || ep->type != END_BLOCK)
+			ep = NULL_EVENT_PTR;
 	}
-	if(ep->time == ps_now && ep->type == END_BLOCK) {
+	if(ep != NULL_EVENT_PTR) {
 		remove_event(ep);
 		if((tp = ps_task_ptr((size_t)ep->gp))->state != TASK_BLOCKED)
 			ps_abort("Bad END_BLOCK event");
@@ -6072,6 +6393,8 @@ LOCAL	 void 	event_report(void)
 
 {
 	ps_event_t	*ep;			/* event pointer	*/
+	ps_event_t	**copy;			/* events in time order	*/
+	long	i;				/* loop index		*/
 	ps_task_t	*tp;			/* task pointer		*/
 	ps_mess_t	*mp;			/* message pointer	*/
 	ps_bus_t	*bp;			/* bus pointer		*/
@@ -6085,61 +6408,75 @@ LOCAL	 void 	event_report(void)
 		" User event "
 	};
 	
-	ep = calendar[0].next;
-	if(ep != &calendar[1]) {
-		fprintf(stderr, "\n\n       F U T U R E   E V E N T S\n\n");
-		fprintf(stderr, "     Time      |     Type     |  ID | Name\n");
-		fprintf(stderr,
-		    "-----------------------------------------------------\n");
-		while(ep != &calendar[1]) {
-			fprintf(stderr, "%12.4f   | %s |", ep->time, 
-			    e_name[ep->type]);
-			switch(ep->type) {
-
-			case END_SYNC:
-			case END_COMPUTE:
-			case END_QUANTUM:
-			case END_SLEEP:
-			case END_RECEIVE:
-			case END_BLOCK:
-				tp = ps_task_ptr((size_t)ep->gp);
-				fprintf(stderr, "%4ld | %s\n", (size_t)ep->gp,
-					tp->name);
-				break;
-			
-			case END_TRANS:
-				mp = (ps_mess_t *) ep->gp;
-				tp = ps_task_ptr(port_ptr(mp->port)->owner);
-				fprintf(stderr, "%4ld | %s\n", 
-				    port_ptr(mp->port)->owner, tp->name);
-				break;
+/*	The heap is not kept in time order, so sort a copy of it.	*/
 
-			case LINK_FAILURE:
-			case LINK_REPAIR:
-				lp = (ps_link_t *) ep->gp;
-				fprintf(stderr, "%4ld | %s\n", lid(lp),
-				    lp->name);
-				break;
+	if(event_count == 0)
+		return;
+	if(!(copy = (ps_event_t **) malloc(event_count*sizeof(ps_event_t *))))
+		ps_abort("Insufficient memory");
+	if(heap_on) {
+		memcpy(copy, heap, event_count*sizeof(ps_event_t *));
+		qsort(copy, event_count, sizeof(ps_event_t *), 
+		    (compar)event_compare);
+	}
+	else
+		for(i = 0, ep = calendar[0].next; ep != &calendar[1]; 
+		    ep = ep->next)
+			copy[i++] = ep;
 
-			case BUS_FAILURE:
-			case BUS_REPAIR:
-				bp = (ps_bus_t *) ep->gp;
-				fprintf(stderr, "%4ld | %s\n", bid(bp),
-				    bp->name);
-				break;
+	fprintf(stderr, "\n\n       F U T U R E   E V E N T S\n\n");
+	fprintf(stderr, "     Time      |     Type     |  ID | Name\n");
+	fprintf(stderr,
+	    "-----------------------------------------------------\n");
+	for(i = 0; i < event_count; i++) {
+		ep = copy[i];
+		fprintf(stderr, "%12.4f   | %s |", ep->time, 
+		    e_name[ep->type]);
+		switch(ep->type) {
+
+		case END_SYNC:
+		case END_COMPUTE:
+		case END_QUANTUM:
+		case END_SLEEP:
+		case END_RECEIVE:
+		case END_BLOCK:
+			tp = ps_task_ptr((size_t)ep->gp);
+			fprintf(stderr, "%4ld | %s\n", (size_t)ep->gp,
+				tp->name);
+			break;
+		
+		case END_TRANS:
+			mp = (ps_mess_t *) ep->gp;
+			tp = ps_task_ptr(port_ptr(mp->port)->owner);
+			fprintf(stderr, "%4ld | %s\n", 
+			    port_ptr(mp->port)->owner, tp->name);
+			break;
 
-			case NODE_FAILURE:
-			case NODE_REPAIR:
-				np = (ps_node_t *) ep->gp;
-				fprintf(stderr, "%4ld | %s\n", nid(np),
-				    np->name);
-				break;
+		case LINK_FAILURE:
+		case LINK_REPAIR:
+			lp = (ps_link_t *) ep->gp;
+			fprintf(stderr, "%4ld | %s\n", lid(lp),
+			    lp->name);
+			break;
+
+		case BUS_FAILURE:
+		case BUS_REPAIR:
+			bp = (ps_bus_t *) ep->gp;
+			fprintf(stderr, "%4ld | %s\n", bid(bp),
+			    bp->name);
+			break;
+
+		case NODE_FAILURE:
+		case NODE_REPAIR:
+			np = (ps_node_t *) ep->gp;
+			fprintf(stderr, "%4ld | %s\n", nid(np),
+			    np->name);
+			break;
 
-			}
-			ep = ep->next;
 		}
-		fprintf(stderr, "\n");
 	}
+	fprintf(stderr, "\n");
+	free(copy);
 }
 
 /************************************************************************/
@@ -6851,21 +7188,19 @@ LOCAL	void	free_mess(
 	ps_mess_t	*mp			/* message pointer	*/
 )
 {
-	mp->next = next_mess;
-	next_mess = mp;
+	ps_free_slot(&mess_slab, mp);
 }
 
 /************************************************************************/
 
 LOCAL void free_pair(
 
-/* Stuffs a freed tp pair onto the tpflist.				*/
+/* Returns a tp pair to its slab.					*/
 
 	ps_tp_pair_t	*pp			/* tp pair pointer	*/
 )
 {	
-	pp->next = tpflist;
-	tpflist = pp;
+	ps_free_slot(&pair_slab, pp);
 }
 
 /************************************************************************/
@@ -6897,40 +7232,17 @@ LOCAL	ps_mess_t	*get_mess(void)
 /* Get message envelope							*/
 
 {
-	long	i;				/* loop index		*/
-	ps_mess_t	*mp, *nmp;		/* message pointers	*/
-
-	if(next_mess == NULL_MESS_PTR) {
-		if(!(mp = next_mess = (ps_mess_t *) malloc(100*sizeof(ps_mess_t))))
-			ps_abort("Insufficient memory");
-		for(i = 1; i < 100; i++) {
-			nmp = mp++;
-			nmp->next = mp;
-		}
-		mp->next = NULL_MESS_PTR;
-	}
-	mp = next_mess;
-	next_mess = next_mess->next;
-	return(mp);
+	return((ps_mess_t *) ps_get_slot(&mess_slab));
 }
 
 /************************************************************************/
 
 LOCAL 	ps_tp_pair_t *get_pair(void)
 
-/* Returns a pointer to a tp pair using tpflist if possible		*/
+/* Returns a pointer to a tp pair from its slab.			*/
 
 {
-	ps_tp_pair_t	*pp;			/* tp pair pointer	*/
-
-	if(tpflist) {
-		pp = tpflist;
-		tpflist = pp->next;
-	}
-	else 
-		if(!(pp = (ps_tp_pair_t *) malloc(sizeof(ps_tp_pair_t))))
-			ps_abort("Insufficient memory");
-	return(pp);
+	return((ps_tp_pair_t *) ps_get_slot(&pair_slab));
 }
 
 /************************************************************************/
@@ -7210,6 +7522,7 @@ LOCAL 	long	port_send(
 	}
 	else 
 		pp->first = pp->last = mp;
+	profile_send(pp);
 
 	mp->sender = ps_myself;
 	mp->port = port;
@@ -7252,6 +7565,39 @@ LOCAL 	long	port_send(
 
 /************************************************************************/
 
+LOCAL	double	profile_clock(void)
+
+/* Returns the elapsed time in seconds for timing the kernel with	*/
+/* RPF_PROFILE.								*/
+
+{
+#if HAVE_CLOCK_GETTIME
+	struct	timespec	ts;		/* current time		*/
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return(ts.tv_sec + ts.tv_nsec * 1.0e-9);
+#else
+	return((double) clock() / CLOCKS_PER_SEC);
+#endif
+}
+
+/************************************************************************/
+
+LOCAL	void	profile_send(
+
+/* Counts a message queued on a port and the length of its queue.	*/
+
+	ps_port_t	*pp			/* port pointer		*/
+)
+{
+	ps_profile.sends++;
+	ps_profile.queued += pp->nmess;
+	if(pp->nmess > ps_profile.max_queued)
+		ps_profile.max_queued = pp->nmess;
+}
+
+/************************************************************************/
+
 LOCAL	long	relative(
 
 /* Tests if given task is a relative of the target task.  A relative is	*/
@@ -7576,6 +7922,20 @@ LOCAL	int	stat_compare(
 
 /************************************************************************/
 
+LOCAL	int	event_compare(
+
+/* This is a callback function that is passed in to quicksort for 	*/
+/* sorting the calendar heap in event order.				*/
+
+	ps_event_t	**e1,
+	ps_event_t	**e2
+)
+{
+	return EARLIER(*e1, *e2) ? -1 : 1;
+}
+
+/************************************************************************/
+
 #ifdef STACK_TESTING
 
 void	test_all_stacks(void)
@@ -9,6 +9,7 @@
 #include <iomanip>
 #include <cstdlib>
 #include <cstring>
+#include <thread>
 #include <getopt.h>
 #include <ctype.h>
 #if HAVE_LIBGEN_H
@@ -21,6 +22,7 @@
 #include <lqio/filename.h>
 #include <lqio/gnuplot.h>
 #include <lqio/qnap2_document.h>
+#include <mva/mva.h>
 #include "pragma.h"
 #include "model.h"
 
@@ -44,6 +46,8 @@ const struct option longopts[] =
     { LQIO::DOM::Pragma::_schweitzer_,          no_argument,            0, 's' },
     { LQIO::DOM::Pragma::_force_multiserver_,   no_argument,            0, 'M' },
     { LQIO::DOM::Pragma::_hvfcfs_,		required_argument,	0, 0x100+'v' },
+    { "mva-threads",				required_argument,	0, 0x100+'T' },
+    { "mva-rolling-storage",			no_argument,		0, 0x100+'R' },
     { "queue-length",                           optional_argument,      0, 'q' },
     { "response-time",                          optional_argument,      0, 'r' },
     { "throughput",                             optional_argument,      0, 't' },
@@ -86,6 +90,8 @@ const static std::map<const std::string,const std::string> opthelp  = {
     { "file-format",				"When plotting, add instructions to output as ARG to the output file." },
     { "help",                                   "Show this." },
     { "multiserver",                            "Use ARG for multiservers.  ARG={conway,reiser,rolia,zhou}." },
+    { "mva-threads",				"Use ARG threads for Exact MVA.  ARG=0 uses all available cores." },
+    { "mva-rolling-storage",			"Only store two population levels for Exact MVA." },
     { "no-execute",				"Load the model and run LQX, but do not solve the model." },
     { "output",                                 "Send output to ARG." },
     { "queue-length",                           "Output gnuplot to plot station queue-length.  ARG specifies a class or station." },
@@ -275,6 +281,21 @@ int main (int argc, char *argv[])
 	case 0x100+'v':
 	    pragmas.insert(LQIO::DOM::Pragma::_hvfcfs_,optarg);
 	    break;
+
+	case 0x100+'R':
+	    MVA::__rolling = true;
+	    break;
+
+	case 0x100+'T': {
+	    char * endptr = nullptr;
+	    const unsigned long n = strtoul( optarg, &endptr, 10 );
+	    if ( *endptr != '\0' ) {
+		std::cerr << program_name << ": --mva-threads=" << optarg << ", invalid argument." << std::endl;
+		exit( 1 );
+	    }
+	    MVA::__threads = n > 0 ? n : std::max( std::thread::hardware_concurrency(), 1U );
+	    break;
+	}
 	    
 	case 'w':
 	    print_gnuplot = true;			/* Output WhatIf as gnuplot	*/
@@ -31,6 +31,7 @@
 #include <cstring>
 #include <filesystem>
 #include <limits>
+#include <map>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -62,6 +63,7 @@
 #include "json_document.h"
 #include "srvndiff.h"
 #include "parseable.h"
+#include "confidence_intervals.h"
 
 extern "C" int resultdebug;
 extern "C" int resultlineno;	/* Line number of current parse line in input file */
@@ -427,6 +429,15 @@ static bool print_rms_error_only 	= false;
 static bool print_solver_information	= false;
 static bool print_total_rms_error 	= true;
 static bool print_totals_only 		= false;
+static bool print_paired_differences	= false;
+
+/*
+ * Differences between the second and the first file of each pair, by
+ * result and row, for --paired-differences.
+ */
+
+static std::vector<std::pair<std::string,stats_buf>> paired_differences;
+static std::map<std::pair<int,std::string>,size_t> paired_row;
 
 static bool ignore_invalid_result_error = false;
 
@@ -507,6 +518,7 @@ static struct {
     { "debug-srvn",		 512+'s', false, no_argument,	    "Output debugging information while parsing SRVN results", nullptr },
     { "no-replication",		 512+'r', false, no_argument,       "Strip replicas from \"flattend\" model from comparison", nullptr },
     { "no-warnings",		 512+'w', false, no_argument,       "Ignore warnings when parsing results", nullptr },
+    { "paired-differences",	 512+'p', false, no_argument,	    "Print the mean difference of each result over the pairs of files in two directories, with its 95% confidence interval", nullptr },
     { "verbose",                 512+'v', false, no_argument,       "Verbose output (direct differences to stderr)", nullptr },
     { nullptr, 0, 0, 0, nullptr, nullptr }
 };
@@ -588,6 +600,8 @@ static void print_task_result( const result_str_t result, const char * file_name
 static void print_information( const result_str_t result, const char * file_name, const unsigned passes );
 static void print_rms_error( const char * file_name, const result_str_t result, const std::vector<stats_buf>&, unsigned passes, const bool print_conf );
 static void print_error_totals( unsigned passes, char * const names[] );
+static void record_paired_difference( const result_str_t result, const char * format, va_list args, const double value[] );
+static void print_paired_difference_totals( char * const names[] );
 static void print_runtime_totals( unsigned passes, char * const names[] );
 static void print_iteration_totals ( const result_str_t result, unsigned passes, char * const names[] );
 static void print_total_statistics( const std::vector<stats_buf> &results, const unsigned start, const unsigned passes, const char * cat_string, const char * type_str, output_func_ptr print_func, const unsigned bits );
@@ -968,6 +982,10 @@ main (int argc, char * const argv[])
 	case (512+'c'):
 	    print_comment = true;
 	    break;
+
+	case (512+'p'):
+	    print_paired_differences = true;
+	    break;
 	
 	case '?':
 	    print_solver_information = true;
@@ -1417,6 +1435,9 @@ done:
 	 && dir_list[FILE1].gl_pathc >= 2 ) {
 	print_error_totals( n, dirs );
     }
+    if ( print_paired_differences && n == 2 && !print_quiet ) {
+	print_paired_difference_totals( dirs );
+    }
 
     if ( print_runtimes && total[REAL_TIME][P_RUNTIME][0].n() > 1 ) {
 	print_runtime_totals( n, dirs );
@@ -2732,6 +2753,12 @@ print_entry ( const result_str_t result, const unsigned passes, unsigned i, unsi
 	difference = std::max( print_entry_activity( value, conf_value, passes, j, delta ), difference );
     }
 
+    if ( print_paired_differences && passes == 2 ) {
+	va_start( args, delta );
+	record_paired_difference( result, *result_str[(int)result].format, args, value );
+	va_end( args );
+    }
+
     va_start( args, delta );
     if ( verbose_flag && difference > error_threshold ) {
 	(void) vfprintf( stderr, *result_str[(int)result].format, args );
@@ -2780,6 +2807,12 @@ print_activity ( const result_str_t result, const unsigned passes, unsigned i, u
 	print_entry_activity( value, conf_value, passes, j, delta );
     }
 
+    if ( print_paired_differences && passes == 2 ) {
+	va_start( args, delta );
+	record_paired_difference( result, *result_str[(int)result].act_format, args, value );
+	va_end( args );
+    }
+
     if ( !print_rms_error_only ) {
 	if ( print_latex ) {
 	    (void) fprintf( output, " \\\\" );
@@ -2958,6 +2991,63 @@ print_error_totals ( unsigned passes, char * const names[] )
 
 
 
+/*
+ * Add the difference between the two files to the row of result
+ * labelled by format and args (as printed by print_entry() and
+ * print_activity()).
+ */
+
+static void
+record_paired_difference( const result_str_t result, const char * format, va_list args, const double value[] )
+{
+    if ( !std::isfinite( value[FILE1] ) || !std::isfinite( value[FILE2] ) ) return;
+
+    char buf[LINE_WIDTH];
+    (void) vsnprintf( buf, sizeof( buf ), format, args );
+    std::string label( buf );
+    label.erase( label.find_last_not_of( ' ' ) + 1 );
+
+    const std::pair<int,std::string> key( static_cast<int>(result), label );
+    std::map<std::pair<int,std::string>,size_t>::const_iterator row = paired_row.find( key );
+    if ( row == paired_row.end() ) {
+	row = paired_row.emplace( key, paired_differences.size() ).first;
+	paired_differences.emplace_back( std::string( result_str[(int)result].string ) + " " + label, stats_buf() );
+    }
+    paired_differences[row->second].second.update( value[FILE2] - value[FILE1] );
+}
+
+
+
+/*
+ * Print the mean of the paired differences of each row with its 95%
+ * confidence interval, t * s / sqrt(n), where s is the sample standard
+ * deviation.  Files with the same name in the two directories are
+ * pairs, such as runs of two variants of a model with the same seeds
+ * and common random numbers, so the interval is usually much smaller
+ * than the one for the difference of independent means.
+ */
+
+static void
+print_paired_difference_totals( char * const names[] )
+{
+    if ( paired_differences.empty() ) return;
+
+    (void) fprintf( output, "\nPaired differences (%s - %s), 95%% confidence:\n", names[FILE2], names[FILE1] );
+    for ( std::vector<std::pair<std::string,stats_buf>>::const_iterator row = paired_differences.begin(); row != paired_differences.end(); ++row ) {
+	const stats_buf& stats = row->second;
+	const unsigned n = static_cast<unsigned>(stats.n());
+	const double half_width = n >= 2 ? LQIO::ConfidenceIntervals::get_t_value( n, LQIO::ConfidenceIntervals::CONF_95 ) * stats.stddev() / sqrt( static_cast<double>(n - 1) ) : 0.0;
+	(void) fprintf( output, "%-48.48s %4u", row->first.c_str(), n );
+	(void) fprintf( output, "%s", separator_format );
+	(void) fprintf( output, result_format, stats.mean() );
+	(void) fprintf( output, "%s", separator_format );
+	(void) fprintf( output, confidence_format, half_width );
+	(void) fputc( '\n', output );
+    }
+}
+
+
+
 /*
  * Print RMS errors.
  */